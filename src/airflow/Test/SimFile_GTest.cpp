@@ -0,0 +1,124 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#include <gtest/gtest.h>
+#include "AirflowFixture.hpp"
+
+#include "../contam/SimFile.hpp"
+
+#include "../../utilities/core/Filesystem.hpp"
+
+static void writeResults(const openstudio::path& path, const std::string& header, const std::vector<std::string>& rows)
+{
+  openstudio::filesystem::ofstream file(path);
+  ASSERT_TRUE(file.is_open());
+  file << header << "\n";
+  for(const auto& row : rows) {
+    file << row << "\n";
+  }
+  file.close();
+}
+
+TEST_F(AirflowFixture, SimFile_StreamedColumns) {
+  openstudio::path simPath = openstudio::toPath("./SimFile_StreamedColumns.sim");
+  openstudio::path lfrPath = openstudio::toPath("./SimFile_StreamedColumns.lfr");
+  openstudio::path nfrPath = openstudio::toPath("./SimFile_StreamedColumns.nfr");
+
+  writeResults(lfrPath, "day\ttime\tP#\tdP\tF0\tF1",
+    {"1/1\t00:00:00\t1\t1.0\t0.1\t0.0",
+     "1/1\t00:00:00\t2\t2.0\t-0.2\t0.0",
+     "1/1\t01:00:00\t1\t3.0\t0.3\t0.1",
+     "1/1\t01:00:00\t2\t4.0\t-0.4\t0.0",
+     "1/1\t02:00:00\t1\t5.0\t0.5\t0.1",
+     "1/1\t02:00:00\t2\t6.0\t-0.6\t0.0"});
+  writeResults(nfrPath, "day\ttime\tZ#\tT\tP\tD",
+    {"1/1\t00:00:00\t0\t293.15\t0.0\t-",
+     "1/1\t00:00:00\t1\t294.15\t1.0\t1.2",
+     "1/1\t01:00:00\t0\t295.15\t0.0\t-",
+     "1/1\t01:00:00\t1\t296.15\t3.0\t1.2",
+     "1/1\t02:00:00\t0\t297.15\t0.0\t-",
+     "1/1\t02:00:00\t1\t298.15\t5.0\t1.2"});
+
+  openstudio::contam::SimFile sim(simPath);
+  EXPECT_EQ(3u, sim.fileDateTimes().size());
+  ASSERT_EQ(2u, sim.dateTimes().size());
+  ASSERT_EQ(2u, sim.pathNrs().size());
+  EXPECT_EQ(1, sim.pathNrs()[0]);
+  EXPECT_EQ(2, sim.pathNrs()[1]);
+  ASSERT_EQ(2u, sim.nodeNrs().size());
+
+  boost::optional<openstudio::TimeSeries> dP = sim.pathDeltaP(2);
+  ASSERT_TRUE(dP);
+  ASSERT_EQ(2u, dP->values().size());
+  EXPECT_DOUBLE_EQ(3.0, dP->values()[0]);
+  EXPECT_DOUBLE_EQ(5.0, dP->values()[1]);
+
+  boost::optional<openstudio::TimeSeries> flow = sim.pathFlow(1);
+  ASSERT_TRUE(flow);
+  EXPECT_DOUBLE_EQ(0.25, flow->values()[0]);
+  EXPECT_DOUBLE_EQ(0.5, flow->values()[1]);
+
+  EXPECT_FALSE(sim.pathFlow(3));
+
+  std::vector<boost::optional<openstudio::TimeSeries> > flows = sim.pathFlows({2, 3, 1});
+  ASSERT_EQ(3u, flows.size());
+  ASSERT_TRUE(flows[0]);
+  EXPECT_FALSE(flows[1]);
+  ASSERT_TRUE(flows[2]);
+  EXPECT_DOUBLE_EQ(-0.3, flows[0]->values()[0]);
+  EXPECT_DOUBLE_EQ(flow->values()[1], flows[2]->values()[1]);
+
+  // Repeated paths are read once and returned at each position
+  flows = sim.pathFlows({1, 2, 1});
+  ASSERT_EQ(3u, flows.size());
+  ASSERT_TRUE(flows[0]);
+  ASSERT_TRUE(flows[1]);
+  ASSERT_TRUE(flows[2]);
+  EXPECT_DOUBLE_EQ(-0.3, flows[1]->values()[0]);
+  EXPECT_EQ(flows[0]->values().size(), flows[2]->values().size());
+  EXPECT_DOUBLE_EQ(flows[0]->values()[1], flows[2]->values()[1]);
+
+  boost::optional<openstudio::TimeSeries> temperature = sim.nodeTemperature(1);
+  ASSERT_TRUE(temperature);
+  EXPECT_DOUBLE_EQ(295.15, temperature->values()[0]);
+
+  // The ambient node has no density
+  boost::optional<openstudio::TimeSeries> density = sim.nodeDensity(0);
+  ASSERT_TRUE(density);
+  EXPECT_DOUBLE_EQ(0.0, density->values()[0]);
+
+  std::vector<std::vector<double> > F0 = sim.F0();
+  ASSERT_EQ(2u, F0.size());
+  ASSERT_EQ(3u, F0[1].size());
+  EXPECT_DOUBLE_EQ(-0.6, F0[1][2]);
+
+  openstudio::filesystem::remove(lfrPath);
+  openstudio::filesystem::remove(nfrPath);
+}
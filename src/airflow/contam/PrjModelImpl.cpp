@@ -1186,15 +1186,23 @@ std::vector<TimeSeries> IndexModelImpl::zoneInfiltration(SimFile *sim)
   std::vector<TimeSeries> results;
   std::vector<std::vector<int> > paths = zoneExteriorFlowPaths();
   unsigned int ntimes = sim->dateTimes().size();
+  // Read all of the needed flows in one pass through the results
+  std::vector<int> pathNrs;
+  for(const auto& zonePaths : paths)
+  {
+    pathNrs.insert(pathNrs.end(), zonePaths.begin(), zonePaths.end());
+  }
+  std::vector<boost::optional<openstudio::TimeSeries> > flows = sim->pathFlows(pathNrs);
+  unsigned int flowIndex = 0;
   for(unsigned int i=0; i<m_zones.size(); i++)
   {
     // This is lame, but I can't tell for sure if the values of a Vector are actually zero.
     Vector inf = createVector(std::vector<double>(ntimes,0));
     for(unsigned int j=0; j<paths[i].size(); j++)
     {
+      const boost::optional<openstudio::TimeSeries>& optFlow = flows[flowIndex++];
       if(paths[i][j] > 0) // Positive values are infiltration
       {
-        boost::optional<openstudio::TimeSeries> optFlow = sim->pathFlow(paths[i][j]);
         if(optFlow)
         {
           Vector flow = optFlow.get().values();
@@ -1215,7 +1223,6 @@ std::vector<TimeSeries> IndexModelImpl::zoneInfiltration(SimFile *sim)
       }
       else // Negative values are infiltration
       {
-        boost::optional<openstudio::TimeSeries> optFlow = sim->pathFlow(paths[i][j]);
         if(optFlow)
         {
           Vector flow = optFlow.get().values();
@@ -1252,6 +1259,17 @@ std::vector<TimeSeries> IndexModelImpl::pathInfiltration(std::vector<int> pathNr
     ntimes = sim->dateTimes().size()-1;
     dateTimes = std::vector<DateTime>(dateTimes.begin() + 1,dateTimes.end());
   }
+  // Read all of the needed flows in one pass through the results
+  std::vector<int> flowNrs;
+  for(unsigned int i=0; i<pathNrs.size(); i++)
+  {
+    if(pathNrs[i] > 0 && (unsigned)pathNrs[i] <= m_paths.size())
+    {
+      flowNrs.push_back(m_paths[pathNrs[i]-1].nr());
+    }
+  }
+  std::vector<boost::optional<openstudio::TimeSeries> > flows = sim->pathFlows(flowNrs);
+  unsigned int flowIndex = 0;
   for(unsigned int i=0; i<pathNrs.size(); i++)
   {
     Vector inf = createVector(std::vector<double>(ntimes,0.0));
@@ -1262,10 +1280,10 @@ std::vector<TimeSeries> IndexModelImpl::pathInfiltration(std::vector<int> pathNr
     else
     {
       contam::AirflowPath path = m_paths[pathNrs[i]-1];
+      const boost::optional<openstudio::TimeSeries>& optFlow = flows[flowIndex++];
       if(path.pzn() == -1)
       {
         // This flow path is negative for flow into zone
-        boost::optional<openstudio::TimeSeries> optFlow = sim->pathFlow(path.nr());
         if(optFlow)
         {
           Vector flow = optFlow.get().values();
@@ -1287,7 +1305,6 @@ std::vector<TimeSeries> IndexModelImpl::pathInfiltration(std::vector<int> pathNr
       else if(path.pzm() == -1)
       {
         // This flow path is positive for flow into zone
-        boost::optional<openstudio::TimeSeries> optFlow = sim->pathFlow(path.nr());
         if(optFlow)
         {
           Vector flow = optFlow.get().values();
@@ -32,6 +32,10 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/classification.hpp>
 
+#include <cstdlib>
+#include <map>
+#include <set>
+
 namespace openstudio {
 namespace contam {
 
@@ -44,6 +48,56 @@ int indexOf(const std::vector<int>& list, int target) {
   return -1;
 }
 
+// The LFR and NFR files are tab-delimited with columns day, time, nr, and three values
+static const unsigned ncols = 6;
+
+// Locate the tab-delimited fields of a line without copying them, returns the number of fields
+static unsigned splitFields(const std::string& line, std::vector<std::pair<size_t, size_t> >& fields)
+{
+  fields.clear();
+  size_t begin = 0;
+  size_t end = line.find('\t');
+  while(end != std::string::npos)
+  {
+    fields.push_back(std::make_pair(begin, end));
+    begin = end + 1;
+    end = line.find('\t', begin);
+  }
+  end = line.size();
+  if(end > begin && line[end-1] == '\r')
+  {
+    --end;
+  }
+  fields.push_back(std::make_pair(begin, end));
+  return fields.size();
+}
+
+static bool parseInt(const std::string& line, const std::pair<size_t, size_t>& field, int& value)
+{
+  const char* begin = line.c_str() + field.first;
+  char* end = nullptr;
+  long result = std::strtol(begin, &end, 10);
+  if(end == begin)
+  {
+    return false;
+  }
+  value = static_cast<int>(result);
+  return true;
+}
+
+static bool parseDouble(const std::string& line, const std::pair<size_t, size_t>& field, double& value)
+{
+  const char* begin = line.c_str() + field.first;
+  char* end = nullptr;
+  double result = std::strtod(begin, &end);
+  if(end == begin)
+  {
+    return false;
+  }
+  value = result;
+  return true;
+}
+
 SimFile::SimFile(openstudio::path path)
 {
   m_hasLfr = false;
@@ -52,9 +106,9 @@ SimFile::SimFile(openstudio::path path)
   // For now, we need to cheat and assume that the .lfr etc. actually exist
   // This means that simread has to have been run for this to work
   openstudio::path lfrPath = path.replace_extension(openstudio::toPath("lfr").string());
-  m_hasLfr = readLfr(openstudio::toString(lfrPath));
+  m_hasLfr = indexLfr(lfrPath);
   openstudio::path nfrPath = path.replace_extension(openstudio::toPath("nfr").string());
-  m_hasNfr = readNfr(openstudio::toString(nfrPath));
+  m_hasNfr = indexNfr(nfrPath);
 }
 
 bool SimFile::computeDateTimes(const std::vector<std::string>& day, const std::vector<std::string>& time)
@@ -88,133 +142,81 @@ bool SimFile::computeDateTimes(const std::vector<std::string>& day, const std::v
   return true;
 }
 
-void SimFile::clearLfr()
+bool SimFile::indexFile(const openstudio::path& path, const std::string& type, bool allowExtraColumns, std::vector<int>& nrs,
+  std::vector<std::string>& day, std::vector<std::string>& time)
 {
-  m_dP.clear();
-  m_F0.clear();
-  m_F1.clear();
-}
-
-bool SimFile::readLfr(const std::string& fileName)
-{
-  clearLfr();
-  std::vector<std::string> day;
-  std::vector<std::string> time;
-  openstudio::filesystem::ifstream file(openstudio::toPath(fileName));
+  nrs.clear();
+  openstudio::filesystem::ifstream file(path);
   if(!file.is_open())
   {
-    LOG(Error,"Failed to open LFR file '" << fileName << "'");
+    LOG(Error,"Failed to open " << type << " file '" << openstudio::toString(path) << "'");
     return false;
   }
-  std::map<int,int> nrMap;
   // Read the header
-  std::string headerstr;
-  std::getline(file, headerstr);
-  std::string header = headerstr;
-  if(header.empty())
+  std::string line;
+  std::getline(file, line);
+  if(line.empty())
   {
-    LOG(Error,"No data in LFR file '" << fileName << "'");
+    LOG(Error,"No data in " << type << " file '" << openstudio::toString(path) << "'");
     return false;
   }
-  std::vector<std::string> row;
-  boost::split(row, header, boost::is_any_of("\t"));
-  unsigned ncols = 6;
-  if(row.size() != ncols)
+  std::vector<std::pair<size_t, size_t> > fields;
+  unsigned n = splitFields(line, fields);
+  if(n != ncols && !(allowExtraColumns && n == ncols+2))
   {
-    LOG(Error,"LFR file has " << row.size() << " columns, not the expected " << ncols);
+    LOG(Error,type << " file has " << n << " columns, not the expected " << ncols);
     return false;
   }
-  // Read the data
-  while(file.good())
+  // Scan the data, only the times and the indices are kept
+  std::set<int> seen;
+  while(std::getline(file, line))
   {
-    std::string linestr;
-    std::getline(file, linestr);
-    std::string line = linestr;
-    std::vector<std::string> row;
-    boost::split(row, line, boost::is_any_of("\t"));
-    if(row.size() != ncols)
+    if(line.empty())
     {
-      clearLfr();
-      LOG(Error,"LFR data line has " << row.size() << " columns, not the expected " << ncols);
-      return false;
+      continue;
     }
-    if(time.size())
+    n = splitFields(line, fields);
+    if(n != ncols && !(allowExtraColumns && n == ncols+2))
     {
-      if(time[time.size()-1] != row[1])
-      {
-        day.push_back(row[0]);
-        time.push_back(row[1]);
-      }
+      nrs.clear();
+      LOG(Error,type << " data line has " << n << " columns, not the expected " << ncols);
+      return false;
     }
-    else
+    std::string lineTime = line.substr(fields[1].first, fields[1].second - fields[1].first);
+    if(time.empty() || time.back() != lineTime)
     {
-      day.push_back(row[0]);
-      time.push_back(row[1]);
+      day.push_back(line.substr(fields[0].first, fields[0].second - fields[0].first));
+      time.push_back(lineTime);
     }
 
     int nr = 0;
-    try {
-      nr = std::stoi(row[2]);
-    }catch(const std::exception&){
-      clearLfr();
-      LOG(Error,"Invalid link number '" << row[2] << "'");
-      return false;
-    }
-    if(nrMap.find(nr) == nrMap.end())
+    if(!parseInt(line, fields[2], nr))
     {
-      int sz = nrMap.size();
-      nrMap[nr] = sz;
-      m_dP.resize(sz+1);
-      m_F0.resize(sz+1);
-      m_F1.resize(sz+1);
-    }
-    double dP = 0;
-    try {
-      dP = std::stod(row[3]);
-    }catch(const std::exception&){
-      clearLfr();
-      LOG(Error,"Invalid pressure difference '" << row[3] << "'");
+      nrs.clear();
+      LOG(Error,"Invalid " << type << " index '" << line.substr(fields[2].first, fields[2].second - fields[2].first) << "'");
       return false;
     }
-
-    double F0 = 0;
-    try {
-      F0 = std::stod(row[4]);
-    } catch (const std::exception&) {
-      clearLfr();
-      LOG(Error,"Invalid flow 0 '" << row[4] << "'");
-      return false;
-    }
-
-    double F1 = 0;
-    try {
-      F1 = std::stod(row[5]);
-    } catch (const std::exception&) {
-      clearLfr();
-      LOG(Error,"Invalid flow 1 '" << row[5] << "'");
-      return false;
+    if(seen.insert(nr).second)
+    {
+      nrs.push_back(nr);
     }
-
-    m_dP[nrMap[nr]].push_back(dP);
-    m_F0[nrMap[nr]].push_back(F0);
-    m_F1[nrMap[nr]].push_back(F1);
-
-  }
-  // Unwind the zone number map;
-  std::vector<int> keys;
-  for (const auto& pair : nrMap) {
-    keys.push_back(pair.first);
   }
-  m_pathNr.resize(keys.size());
-  for(std::vector<int>::size_type i=0; i < keys.size(); ++i)
+  return true;
+}
+
+bool SimFile::indexLfr(const openstudio::path& path)
+{
+  m_lfrPath = path;
+  std::vector<std::string> day;
+  std::vector<std::string> time;
+  if(!indexFile(path, "LFR", false, m_pathNr, day, time))
   {
-    m_pathNr[nrMap[keys[i]]] = keys[i];
+    return false;
   }
-  file.close();
   // Compute the required date/time objects - this needs to be moved elsewhere if the NCR and NFR are also read
   if(!computeDateTimes(day,time))
   {
-    clearLfr();
+    m_pathNr.clear();
     m_dateTimes.clear();
     LOG(Error,"Failed to compute date and time objects from LFR input");
     return false;
@@ -222,252 +224,279 @@ bool SimFile::readLfr(const std::string& fileName)
   return true;
 }
 
-void SimFile::clearNfr()
+bool SimFile::indexNfr(const openstudio::path& path)
 {
-  m_T.clear();
-  m_P.clear();
-  m_D.clear();
-}
-
-bool SimFile::readNfr(const std::string& fileName)
-{
-  clearNfr();
+  m_nfrPath = path;
   std::vector<std::string> day;
   std::vector<std::string> time;
-  openstudio::filesystem::ifstream file(openstudio::toPath(fileName));
-  if(file.is_open())
+  if(!indexFile(path, "NFR", true, m_nodeNr, day, time))
   {
-    LOG(Error,"Failed to open NFR file '" << fileName << "'");
     return false;
   }
+  // Something should probably be done here to make sure that the times here match up with what we
+  // already have. For now, if nothing is known about the dates, then try to compute it
+  if(m_dateTimes.size() == 0)
+  {
+    if(!computeDateTimes(day,time))
+    {
+      m_nodeNr.clear();
+      m_dateTimes.clear();
+      LOG(Error,"Failed to compute date and time objects from NFR input");
+      return false;
+    }
+  }
+  return true;
+}
 
-  std::map<int,int> nrMap;
-  // Read the header
-  std::string headerstr;
-  std::getline(file, headerstr);
-  std::string header = headerstr;
-  if(header.empty())
+bool SimFile::readColumns(const openstudio::path& path, const std::vector<int>& nrs, const std::vector<unsigned>& columns,
+  std::vector<std::vector<double> >& values) const
+{
+  // Values are returned with the columns for each index together, i.e. values[i*columns.size() + j]
+  values.clear();
+  std::map<int, size_t> slots;
+  for(size_t i = 0; i < nrs.size(); ++i)
   {
-    LOG(Error,"No data in LFR file '" << fileName << "'");
-    return false;
+    slots[nrs[i]] = i;
+  }
+  values.resize(nrs.size()*columns.size());
+  for(auto& column : values)
+  {
+    column.reserve(m_dateTimes.size());
   }
-  std::vector<std::string> row;
-  boost::split(row, header, boost::is_any_of("\t"));
-  unsigned ncols = 6;
-  if(row.size() != ncols && row.size() != ncols+2)
+
+  openstudio::filesystem::ifstream file(path);
+  if(!file.is_open())
   {
-    LOG(Error,"NFR file has " << row.size() << " columns, not the expected " << ncols);
+    values.clear();
+    LOG(Error,"Failed to open results file '" << openstudio::toString(path) << "'");
     return false;
   }
-  // Read the data
-  while(file.good())
+  std::string line;
+  std::getline(file, line); // Skip the header
+  std::vector<std::pair<size_t, size_t> > fields;
+  while(std::getline(file, line))
   {
-    std::string linestr;
-    std::getline(file, linestr);
-    std::string line = linestr;
-
-    std::vector<std::string> row;
-    boost::split(row, line, boost::is_any_of("\t"));
-    if(row.size() != ncols && row.size() != ncols+2)
-    {
-      clearNfr();
-      LOG(Error,"NFR data line has " << row.size() << " columns, not the expected " << ncols);
-      return false;
-    }
-    if(time.size())
-    {
-      if(time[time.size()-1] != row[1])
-      {
-        day.push_back(row[0]);
-        time.push_back(row[1]);
-      }
-    }
-    else
+    if(line.empty())
     {
-      day.push_back(row[0]);
-      time.push_back(row[1]);
+      continue;
     }
-
+    unsigned n = splitFields(line, fields);
     int nr = 0;
-    try {
-      nr = std::stoi(row[2]);
-    } catch(const std::exception&){
-      clearNfr();
-      LOG(Error,"Invalid node number '" << row[2] << "'");
-      return false;
-    }
-    if(nrMap.find(nr) == nrMap.end())
+    if(n < ncols || !parseInt(line, fields[2], nr))
     {
-      int sz = nrMap.size();
-      nrMap[nr] = sz;
-      m_T.resize(sz+1);
-      m_P.resize(sz+1);
-      m_D.resize(sz+1);
-    }
-    double T = 0;
-    try {
-      T = std::stod(row[3]);
-    }catch(const std::exception&){
-      clearNfr();
-      LOG(Error,"Invalid temperature '" << row[3] << "'");
+      values.clear();
+      LOG(Error,"Invalid data line '" << line << "' in results file '" << openstudio::toString(path) << "'");
       return false;
     }
-
-    double P = 0;
-    try {
-      P = std::stod(row[4]);
-    } catch (const std::exception&) {
-      clearNfr();
-      LOG(Error,"Invalid pressure '" << row[4] << "'");
-      return false;
+    auto slot = slots.find(nr);
+    if(slot == slots.end())
+    {
+      continue;
     }
-
-    double D = 0;
-    try {
-      D = std::stod(row[5]);
-    } catch (const std::exception&) {
-      if(nr==0)
-      {
-        D=0.0;
-      }
-      else
+    for(size_t j = 0; j < columns.size(); ++j)
+    {
+      double value = 0;
+      if(!parseDouble(line, fields[columns[j]], value))
       {
-        clearNfr();
-        LOG(Error,"Invalid density '" << row[5] << "'");
-        return false;
+        // The ambient node may not have a density
+        if(nr == 0 && columns[j] == 5 && path == m_nfrPath)
+        {
+          value = 0.0;
+        }
+        else
+        {
+          values.clear();
+          LOG(Error,"Invalid value '" << line.substr(fields[columns[j]].first, fields[columns[j]].second - fields[columns[j]].first)
+            << "' in results file '" << openstudio::toString(path) << "'");
+          return false;
+        }
       }
+      values[slot->second*columns.size() + j].push_back(value);
     }
-    m_T[nrMap[nr]].push_back(T);
-    m_P[nrMap[nr]].push_back(P);
-    m_D[nrMap[nr]].push_back(D);
-
   }
-  // Unwind the zone number map;
-  std::vector<int> keys;
-  for (const auto& pair : nrMap) {
-    keys.push_back(pair.first);
-  }
-  m_nodeNr.resize(keys.size());
-  for(std::vector<int>::size_type i=0; i < keys.size(); ++i)
-  {
-    m_nodeNr[nrMap[keys[i]]] = keys[i];
-  }
-  file.close();
-  // Something should probably be done here to make sure that the times here match up with what we
-  // already have. For now, if nothing is known about the dates, then try to compute it
-  if(m_dateTimes.size() == 0)
+  return true;
+}
+
+std::vector<std::vector<double> > SimFile::readAll(const openstudio::path& path, const std::vector<int>& nrs, unsigned column) const
+{
+  std::vector<std::vector<double> > values;
+  if(!nrs.empty())
   {
-    if(!computeDateTimes(day,time))
-    {
-      clearLfr();
-      m_dateTimes.clear();
-      LOG(Error,"Failed to compute date and time objects from NFR input");
-      return false;
-    }
+    readColumns(path, nrs, std::vector<unsigned>(1, column), values);
   }
-  return true;
+  return values;
+}
+
+std::vector<std::vector<double> > SimFile::dP() const
+{
+  return readAll(m_lfrPath, m_pathNr, 3);
+}
+
+std::vector<std::vector<double> > SimFile::F0() const
+{
+  return readAll(m_lfrPath, m_pathNr, 4);
+}
+
+std::vector<std::vector<double> > SimFile::F1() const
+{
+  return readAll(m_lfrPath, m_pathNr, 5);
+}
+
+std::vector<std::vector<double> > SimFile::T() const
+{
+  return readAll(m_nfrPath, m_nodeNr, 3);
+}
+
+std::vector<std::vector<double> > SimFile::P() const
+{
+  return readAll(m_nfrPath, m_nodeNr, 4);
+}
+
+std::vector<std::vector<double> > SimFile::D() const
+{
+  return readAll(m_nfrPath, m_nodeNr, 5);
 }
 
-static openstudio::TimeSeries convertData(std::vector<openstudio::DateTime> inputDateTimes,
-                                          std::vector<double> inputValues, std::string units)
+static openstudio::TimeSeries convertData(const std::vector<openstudio::DateTime>& inputDateTimes,
+                                          const std::vector<double>& inputValues, const std::string& units)
 {
   // Use a per-interval trapezoidal approximation to convert the CONTAM point data into E+ interval data
-  std::vector<openstudio::DateTime> dateTimes;
-  std::vector<double> values;
   if(inputDateTimes.size()==1) // Account for steady simulation results
   {
     return openstudio::TimeSeries(inputDateTimes,createVector(inputValues),units);
   }
+  std::vector<openstudio::DateTime> dateTimes(inputDateTimes.begin()+1, inputDateTimes.end());
+  Vector values(dateTimes.size());
   for(unsigned i=1;i<inputDateTimes.size();i++)
   {
-    dateTimes.push_back(inputDateTimes[i]);
-    values.push_back(0.5*(inputValues[i-1]+inputValues[i]));
+    values[i-1] = 0.5*(inputValues[i-1]+inputValues[i]);
   }
-  return openstudio::TimeSeries(dateTimes,createVector(values),units);
+  return openstudio::TimeSeries(dateTimes,values,units);
 }
 
-
-boost::optional<openstudio::TimeSeries> SimFile::pathDeltaP(int nr) const
+boost::optional<openstudio::TimeSeries> SimFile::pathSeries(int nr, const std::vector<unsigned>& columns, const std::string& units) const
 {
-  int index = indexOf(m_pathNr, nr);
-  if(index == -1)
+  if(indexOf(m_pathNr, nr) == -1)
+  {
+    return boost::optional<openstudio::TimeSeries>();
+  }
+  std::vector<std::vector<double> > values;
+  if(!readColumns(m_lfrPath, std::vector<int>(1, nr), columns, values))
+  {
+    return boost::optional<openstudio::TimeSeries>();
+  }
+  // Sum the requested columns into the first one
+  for(size_t j = 1; j < values.size(); ++j)
+  {
+    for(size_t i = 0; i < values[0].size() && i < values[j].size(); ++i)
+    {
+      values[0][i] += values[j][i];
+    }
+  }
+  if(values[0].size() != m_dateTimes.size())
   {
+    LOG(Error,"Path " << nr << " has " << values[0].size() << " results, not the expected " << m_dateTimes.size());
     return boost::optional<openstudio::TimeSeries>();
   }
-  openstudio::TimeSeries series = convertData(m_dateTimes,m_dP[index],"Pa");
-  return boost::optional<openstudio::TimeSeries>(series);
+  return boost::optional<openstudio::TimeSeries>(convertData(m_dateTimes,values[0],units));
 }
 
-boost::optional<openstudio::TimeSeries> SimFile::pathFlow0(int nr) const
+boost::optional<openstudio::TimeSeries> SimFile::nodeSeries(int nr, unsigned column, const std::string& units) const
 {
-  int index = indexOf(m_pathNr, nr);
-  if(index == -1)
+  if(indexOf(m_nodeNr, nr) == -1)
+  {
+    return boost::optional<openstudio::TimeSeries>();
+  }
+  std::vector<std::vector<double> > values;
+  if(!readColumns(m_nfrPath, std::vector<int>(1, nr), std::vector<unsigned>(1, column), values))
+  {
+    return boost::optional<openstudio::TimeSeries>();
+  }
+  if(values[0].size() != m_dateTimes.size())
   {
+    LOG(Error,"Node " << nr << " has " << values[0].size() << " results, not the expected " << m_dateTimes.size());
     return boost::optional<openstudio::TimeSeries>();
   }
-  openstudio::TimeSeries series = convertData(m_dateTimes,m_F0[index],"kg/s");
-  return boost::optional<openstudio::TimeSeries>(series);
+  return boost::optional<openstudio::TimeSeries>(convertData(m_dateTimes,values[0],units));
+}
+
+boost::optional<openstudio::TimeSeries> SimFile::pathDeltaP(int nr) const
+{
+  return pathSeries(nr, std::vector<unsigned>(1, 3), "Pa");
+}
+
+boost::optional<openstudio::TimeSeries> SimFile::pathFlow0(int nr) const
+{
+  return pathSeries(nr, std::vector<unsigned>(1, 4), "kg/s");
 }
 
 boost::optional<openstudio::TimeSeries> SimFile::pathFlow1(int nr) const
 {
-  int index = indexOf(m_pathNr, nr);
-  if(index == -1)
-  {
-    return boost::optional<openstudio::TimeSeries>();
-  }
-  openstudio::TimeSeries series = convertData(m_dateTimes,m_F1[index],"kg/s");
-  return boost::optional<openstudio::TimeSeries>(series);
+  return pathSeries(nr, std::vector<unsigned>(1, 5), "kg/s");
 }
 
 boost::optional<openstudio::TimeSeries> SimFile::pathFlow(int nr) const
 {
-  int index = indexOf(m_pathNr, nr);
-  if(index == -1)
+  // Need to confirm that the total flow is F0+F1, since it also could be F0-F1
+  return pathSeries(nr, {4, 5}, "kg/s");
+}
+
+std::vector<boost::optional<openstudio::TimeSeries> > SimFile::pathFlows(const std::vector<int>& nrs) const
+{
+  std::vector<boost::optional<openstudio::TimeSeries> > results(nrs.size());
+  // Index the known and requested paths once rather than searching the lists for each path
+  std::set<int> known(m_pathNr.begin(), m_pathNr.end());
+  std::map<int, size_t> slots;
+  std::vector<int> available;
+  for(int nr : nrs)
   {
-    return boost::optional<openstudio::TimeSeries>();
+    if(known.count(nr) && slots.insert(std::make_pair(nr, available.size())).second)
+    {
+      available.push_back(nr);
+    }
   }
-  std::vector<double> flow(m_dateTimes.size());
-  for(unsigned i=0;i<m_dateTimes.size();i++)
+  std::vector<std::vector<double> > values;
+  if(available.empty() || !readColumns(m_lfrPath, available, {4, 5}, values))
   {
-    flow[i] = m_F0[index][i] + m_F1[index][i];
+    return results;
   }
-  // Need to confirm that the total flow is F0+F1, since it also could be F0-F1
-  openstudio::TimeSeries series = convertData(m_dateTimes,flow,"kg/s");
-  return boost::optional<openstudio::TimeSeries>(series);
+  for(size_t i = 0; i < nrs.size(); ++i)
+  {
+    auto slot = slots.find(nrs[i]);
+    if(slot == slots.end())
+    {
+      continue;
+    }
+    std::vector<double>& F0 = values[2*slot->second];
+    const std::vector<double>& F1 = values[2*slot->second + 1];
+    if(F0.size() != m_dateTimes.size() || F1.size() != m_dateTimes.size())
+    {
+      LOG(Error,"Path " << nrs[i] << " has " << F0.size() << " results, not the expected " << m_dateTimes.size());
+      continue;
+    }
+    std::vector<double> flow(F0.size());
+    for(size_t k = 0; k < F0.size(); ++k)
+    {
+      flow[k] = F0[k] + F1[k];
+    }
+    results[i] = convertData(m_dateTimes,flow,"kg/s");
+  }
+  return results;
 }
 
 boost::optional<openstudio::TimeSeries> SimFile::nodeTemperature(int nr) const
 {
-  int index = indexOf(m_nodeNr, nr);
-  if(index == -1)
-  {
-    return boost::optional<openstudio::TimeSeries>();
-  }
-  openstudio::TimeSeries series = convertData(m_dateTimes,m_T[index],"K");
-  return boost::optional<openstudio::TimeSeries>(series);
+  return nodeSeries(nr, 3, "K");
 }
 
 boost::optional<openstudio::TimeSeries> SimFile::nodePressure(int nr) const
 {
-  int index = indexOf(m_nodeNr, nr);
-  if(index == -1)
-  {
-    return boost::optional<openstudio::TimeSeries>();
-  }
-  openstudio::TimeSeries series = convertData(m_dateTimes,m_P[index],"Pa");
-  return boost::optional<openstudio::TimeSeries>(series);
+  return nodeSeries(nr, 4, "Pa");
 }
 
 boost::optional<openstudio::TimeSeries> SimFile::nodeDensity(int nr) const
 {
-  int index = indexOf(m_nodeNr, nr);
-  if(index == -1)
-  {
-    return boost::optional<openstudio::TimeSeries>();
-  }
-  openstudio::TimeSeries series = convertData(m_dateTimes,m_D[index],"kg/m^3");
-  return boost::optional<openstudio::TimeSeries>(series);
+  return nodeSeries(nr, 5, "kg/m^3");
 }
 
 std::vector<openstudio::DateTime> SimFile::dateTimes() const
@@ -40,37 +40,33 @@
 namespace openstudio {
 namespace contam {
 
+/** SimFile provides access to the text results (.lfr and .nfr) produced by simread. The files are
+ *  indexed once on construction, and the values for individual paths and nodes are streamed from the
+ *  files on request so that memory use is bounded by the size of the requested results rather than
+ *  the size of the files. */
 class AIRFLOW_API SimFile {
 public:
   explicit SimFile(openstudio::path path);
 
-  // These are provided for advanced use
-  std::vector<std::vector<double> > dP() const
-  {
-    return m_dP;
-  }
-  std::vector<std::vector<double> > F0() const
-  {
-    return m_F0;
-  }
-  std::vector<std::vector<double> > F1() const
-  {
-    return m_F1;
-  }
-  std::vector<std::vector<double> > T() const
-  {
-    return m_T;
-  }
-  std::vector<std::vector<double> > P() const
+  // These are provided for advanced use, each reads all of the corresponding results into memory
+  std::vector<std::vector<double> > dP() const;
+  std::vector<std::vector<double> > F0() const;
+  std::vector<std::vector<double> > F1() const;
+  std::vector<std::vector<double> > T() const;
+  std::vector<std::vector<double> > P() const;
+  std::vector<std::vector<double> > D() const;
+
+  /** Returns the CONTAM path indices that have results, in file order. */
+  std::vector<int> pathNrs() const
   {
-    return m_P;
+    return m_pathNr;
   }
-  std::vector<std::vector<double> > D() const
+  /** Returns the CONTAM node indices that have results, in file order. */
+  std::vector<int> nodeNrs() const
   {
-    return m_D;
+    return m_nodeNr;
   }
 
-
   // Most use should be confined to these
   boost::optional<openstudio::TimeSeries> pathDeltaP(int nr) const;
   boost::optional<openstudio::TimeSeries> pathFlow0(int nr) const;
@@ -79,6 +75,8 @@ public:
   boost::optional<openstudio::TimeSeries> nodeTemperature(int nr) const;
   boost::optional<openstudio::TimeSeries> nodePressure(int nr) const;
   boost::optional<openstudio::TimeSeries> nodeDensity(int nr) const;
+  /** Returns the total flow for each of the requested paths, reading the LFR file only once. */
+  std::vector<boost::optional<openstudio::TimeSeries> > pathFlows(const std::vector<int>& nrs) const;
   /** Returns a vector of DateTime objects that give the EnergyPlus-style
    *  end of interval times. These are not the actual times in the SIM file */
   std::vector<openstudio::DateTime> dateTimes() const;
@@ -92,20 +90,21 @@ public:
   }
 
 private:
-  void clearLfr();
-  bool readLfr(const std::string& fileName);
-  void clearNfr();
-  bool readNfr(const std::string& fileName);
+  bool indexLfr(const openstudio::path& path);
+  bool indexNfr(const openstudio::path& path);
+  bool indexFile(const openstudio::path& path, const std::string& type, bool allowExtraColumns, std::vector<int>& nrs,
+    std::vector<std::string>& day, std::vector<std::string>& time);
+  bool readColumns(const openstudio::path& path, const std::vector<int>& nrs, const std::vector<unsigned>& columns,
+    std::vector<std::vector<double> >& values) const;
+  std::vector<std::vector<double> > readAll(const openstudio::path& path, const std::vector<int>& nrs, unsigned column) const;
+  boost::optional<openstudio::TimeSeries> pathSeries(int nr, const std::vector<unsigned>& columns, const std::string& units) const;
+  boost::optional<openstudio::TimeSeries> nodeSeries(int nr, unsigned column, const std::string& units) const;
   bool computeDateTimes(const std::vector<std::string>& day, const std::vector<std::string>& time);
 
+  openstudio::path m_lfrPath;
   std::vector<int> m_pathNr;  // the CONTAM path index
-  std::vector<std::vector<double> > m_dP;
-  std::vector<std::vector<double> > m_F0;
-  std::vector<std::vector<double> > m_F1;
+  openstudio::path m_nfrPath;
   std::vector<int> m_nodeNr;  // the CONTAM node index
-  std::vector<std::vector<double> > m_T;
-  std::vector<std::vector<double> > m_P;
-  std::vector<std::vector<double> > m_D;
   std::vector<openstudio::DateTime> m_dateTimes;
 
   bool m_hasLfr;
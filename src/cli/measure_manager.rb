@@ -29,6 +29,7 @@
 
 require 'json'
 require 'erb'
+require 'monitor'
 require 'openstudio'
 
 class MeasureInfoBinding
@@ -77,12 +78,24 @@ end
 
 class MeasureManager
 
-  attr_reader :osms, :measures, :measure_info
+  # rough size in memory of a loaded model and its translated workspace relative to the size of the file on disk
+  MODEL_MEMORY_FACTOR = 10
 
-  def initialize(logger=nil)
+  # default memory budget for cached models and workspaces
+  DEFAULT_MAX_CACHE_BYTES = 2 * 1024 * 1024 * 1024
+
+  attr_reader :osms, :idfs, :measures, :measure_info, :max_cache_bytes
+
+  def initialize(logger=nil, max_cache_bytes=nil)
     @logger = logger
-    @osms = {} # osm_path => {:checksum, :model, :workspace}
-    @idfs = {} # idf_path => {:checksum, :workspace}
+    @max_cache_bytes = max_cache_bytes ? max_cache_bytes : DEFAULT_MAX_CACHE_BYTES
+    @lock = Monitor.new # guards all of the hashes below
+    @key_locks = {} # measure_dir, osm_path or idf_path => Monitor, only one thread loads a given measure or model
+    @script_lock = Monitor.new # infoExtractor finds the measure by diffing ObjectSpace, only run one at a time
+    @osms = {} # osm_path => {:checksum}
+    @idfs = {} # idf_path => {:checksum}
+    @models = {} # "osm:checksum" or "idf:checksum" => {:model, :workspace, :bytes}, least recently used first
+    @cache_bytes = 0
     @measures = {} # measure_dir => BCLMeasure
     @measure_info = {} # measure_dir => {osm_path => RubyUserScriptInfo}
 
@@ -119,276 +132,359 @@ class MeasureManager
   end
 
   def reset
-    @osms = {}
-    @idfs = {}
-    @measures = {}
-    @measure_info = {}
+    @lock.synchronize do
+      @osms = {}
+      @idfs = {}
+      @models = {}
+      @cache_bytes = 0
+      @measures = {}
+      @measure_info = {}
+    end
+  end
+
+  # yields while holding the lock for key, requests for different measures or models run concurrently
+  def with_key_lock(key)
+    key_lock = @lock.synchronize { @key_locks[key] ||= Monitor.new }
+    key_lock.synchronize { yield }
+  end
+
+  # yields while holding the lock that guards osms, idfs, measures and measure_info, use while iterating them
+  def synchronize
+    @lock.synchronize { yield }
+  end
+
+  # returns {:models, :bytes, :max_bytes} describing the model cache
+  def cache_state
+    @lock.synchronize do
+      {:models => @models.size, :bytes => @cache_bytes, :max_bytes => @max_cache_bytes}
+    end
+  end
+
+  # returns nil or the cached value for key, marking it as most recently used
+  def cache_get(key)
+    @lock.synchronize do
+      value = @models.delete(key)
+      @models[key] = value if value
+      value
+    end
+  end
+
+  # caches value for key, evicting least recently used values until the cache fits in its memory budget
+  def cache_put(key, value, bytes)
+    @lock.synchronize do
+      old_value = @models.delete(key)
+      @cache_bytes -= old_value[:bytes] if old_value
+      @models[key] = value.merge(:bytes => bytes)
+      @cache_bytes += bytes
+
+      # always keep the value just added
+      while @cache_bytes > @max_cache_bytes && @models.size > 1
+        evicted_key, evicted_value = @models.shift
+        @cache_bytes -= evicted_value[:bytes]
+        print_message("Evicting cached model '#{evicted_key}'")
+      end
+    end
+  end
+
+  # estimated memory used by the model loaded from path
+  def model_bytes(path)
+    File.size(path) * MODEL_MEMORY_FACTOR
+  rescue StandardError
+    0
   end
 
   # returns nil or [OpenStudio::Model::Model, OpenStudio::Workspace]
+  # models are shared by checksum, callers must clone the model and workspace before changing them
   # force_reload forces the model to be read from disk, should never be needed
   def get_model(osm_path, force_reload)
+    with_key_lock(osm_path) do
+
+      # check if model exists on disk
+      if !File.exist?(osm_path)
+        print_message("Model '#{osm_path}' does not exist")
+        @lock.synchronize do
+          @osms[osm_path] = nil
+          @measure_info.each_value {|value| value[osm_path] = nil}
+        end
+        force_reload = true
+      end
 
-    # check if model exists on disk
-    if !File.exist?(osm_path)
-      print_message("Model '#{osm_path}' does not exist")
-      @osms[osm_path] = nil
-      @measure_info.each_value {|value| value[osm_path] = nil}
-      force_reload = true
-    end
+      current_checksum = OpenStudio::checksum(OpenStudio::toPath(osm_path))
+      cache_key = "osm:#{current_checksum}"
 
-    current_checksum = OpenStudio::checksum(OpenStudio::toPath(osm_path))
+      last = @lock.synchronize { @osms[osm_path] }
+      if last && last[:checksum] != current_checksum
+        print_message("Checksum of cached model does not match current checksum for '#{osm_path}'")
+      end
 
-    result = nil
-    if !force_reload
-      # load from cache
-      temp = @osms[osm_path]
-      if temp
-        last_checksum = temp[:checksum]
-        if last_checksum && current_checksum == last_checksum
+      result = nil
+      if !force_reload
+        # load from cache
+        temp = cache_get(cache_key)
+        if temp
           model = temp[:model]
           workspace = temp[:workspace]
           if model && workspace
             result = [model, workspace]
             print_message("Using cached model '#{osm_path}'")
           end
+        end
+      end
+
+      if !result
+        # load from disk
+        print_message("Attempting to load model '#{osm_path}'")
+        vt = OpenStudio::OSVersion::VersionTranslator.new
+        model = vt.loadModel(osm_path)
+
+        if model.empty?
+          print_message("Failed to load model '#{osm_path}'")
         else
-          print_message("Checksum of cached model does not match current checksum for '#{osm_path}'")
+          print_message("Successfully loaded model '#{osm_path}'")
+          model = model.get
+          ft = OpenStudio::EnergyPlus::ForwardTranslator.new
+          workspace = ft.translateModel(model)
+          cache_put(cache_key, {:model => model, :workspace => workspace}, model_bytes(osm_path))
+          result = [model, workspace]
         end
       end
-    end
 
-    if !result
-      # load from disk
-      print_message("Attempting to load model '#{osm_path}'")
-      vt = OpenStudio::OSVersion::VersionTranslator.new
-      model = vt.loadModel(osm_path)
-
-      if model.empty?
-        print_message("Failed to load model '#{osm_path}'")
-        @osms[osm_path] = nil
-      else
-        print_message("Successfully loaded model '#{osm_path}'")
-        model = model.get
-        ft = OpenStudio::EnergyPlus::ForwardTranslator.new
-        workspace = ft.translateModel(model)
-        @osms[osm_path] = {:checksum => current_checksum, :model => model, :workspace => workspace}
-        result = [model, workspace]
+      @lock.synchronize do
+        # measure info computed for a different version of this model is out of date
+        if !result || force_reload || last.nil? || last[:checksum] != current_checksum
+          @measure_info.each_value {|value| value[osm_path] = nil}
+        end
+        @osms[osm_path] = result ? {:checksum => current_checksum} : nil
       end
 
-      @measure_info.each_value {|value| value[osm_path] = nil}
+      result
     end
-
-    return result
   end
 
   # returns nil or OpenStudio::Workspace
+  # workspaces are shared by checksum, callers must clone the workspace before changing it
   # force_reload forces the idf to be read from disk, should never be needed
   def get_idf(idf_path, force_reload)
+    with_key_lock(idf_path) do
 
-    # check if model exists on disk
-    if !File.exist?(idf_path)
-      print_message("Idf '#{idf_path}' does not exist")
-      @idfs[idf_path] = nil
-      @measure_info.each_value {|value| value[idf_path] = nil}
-      force_reload = true
-    end
+      # check if model exists on disk
+      if !File.exist?(idf_path)
+        print_message("Idf '#{idf_path}' does not exist")
+        @lock.synchronize do
+          @idfs[idf_path] = nil
+          @measure_info.each_value {|value| value[idf_path] = nil}
+        end
+        force_reload = true
+      end
 
-    current_checksum = OpenStudio::checksum(OpenStudio::toPath(idf_path))
+      current_checksum = OpenStudio::checksum(OpenStudio::toPath(idf_path))
+      cache_key = "idf:#{current_checksum}"
 
-    result = nil
-    if !force_reload
-      # load from cache
-      temp = @osms[idf_path]
-      if temp
-        last_checksum = temp[:checksum]
-        if last_checksum && current_checksum == last_checksum
+      last = @lock.synchronize { @idfs[idf_path] }
+      if last && last[:checksum] != current_checksum
+        print_message("Checksum of cached workspace does not match current checksum for '#{idf_path}'")
+      end
+
+      result = nil
+      if !force_reload
+        # load from cache
+        temp = cache_get(cache_key)
+        if temp
           workspace = temp[:workspace]
           if workspace
             result = workspace
             print_message("Using cached workspace '#{idf_path}'")
           end
-        else
-          print_message("Checksum of cached workspace does not match current checksum for '#{idf_path}'")
         end
       end
-    end
-
-    if !result
-      # load from disk
-      print_message("Attempting to load idf '#{idf_path}'")
-      workspace = OpenStudio::Workspace.load(idf_path, "EnergyPlus".to_IddFileType)
 
-      if workspace.empty?
-        print_message("Failed to load idf '#{idf_path}'")
-        @idfs[idf_path] = nil
-      else
-        print_message("Successfully loaded idf '#{idf_path}'")
-        workspace = workspace.get
+      if !result
+        # load from disk
+        print_message("Attempting to load idf '#{idf_path}'")
+        workspace = OpenStudio::Workspace.load(idf_path, "EnergyPlus".to_IddFileType)
 
-        if !workspace.isValid('Draft'.to_StrictnessLevel)
-          print_message("Workspace loaded from '#{idf_path}' is not valid")
-          @idfs[idf_path] = nil
+        if workspace.empty?
+          print_message("Failed to load idf '#{idf_path}'")
         else
-          @idfs[idf_path] = {:checksum => current_checksum, :workspace => workspace}
-          result = workspace
+          print_message("Successfully loaded idf '#{idf_path}'")
+          workspace = workspace.get
+
+          if !workspace.isValid('Draft'.to_StrictnessLevel)
+            print_message("Workspace loaded from '#{idf_path}' is not valid")
+          else
+            cache_put(cache_key, {:workspace => workspace}, model_bytes(idf_path))
+            result = workspace
+          end
         end
       end
 
-      @measure_info.each_value {|value| value[idf_path] = nil}
-    end
+      @lock.synchronize do
+        # measure info computed for a different version of this idf is out of date
+        if !result || force_reload || last.nil? || last[:checksum] != current_checksum
+          @measure_info.each_value {|value| value[idf_path] = nil}
+        end
+        @idfs[idf_path] = result ? {:checksum => current_checksum} : nil
+      end
 
-    return result
+      result
+    end
   end
 
   # returns nil or OpenStudio::BCLMeasure from path
   # force_reload forces the measure.xml to be read from disk, should only be needed if user has edited the xml
   def get_measure(measure_dir, force_reload)
-
-    # check if measure exists on disk
-    if !File.exist?(measure_dir) || !File.exist?(File.join(measure_dir, 'measure.xml'))
-      print_message("Measure '#{measure_dir}' does not exist")
-      @measures[measure_dir] = nil
-      @measure_info[measure_dir] = {}
-      force_reload = true
-    end
-
-    result = nil
-    if !force_reload
-      # load from cache
-      result = @measures[measure_dir]
-      if result
-        print_message("Using cached measure '#{measure_dir}'")
+    with_key_lock(measure_dir) do
+
+      # check if measure exists on disk
+      if !File.exist?(measure_dir) || !File.exist?(File.join(measure_dir, 'measure.xml'))
+        print_message("Measure '#{measure_dir}' does not exist")
+        @lock.synchronize do
+          @measures[measure_dir] = nil
+          @measure_info[measure_dir] = {}
+        end
+        force_reload = true
       end
-    end
 
-    if !result
-      # load from disk
-      print_message("Attempting to load measure '#{measure_dir}'")
-
-      measure = OpenStudio::BCLMeasure.load(measure_dir)
-      if measure.empty?
-        print_message("Failed to load measure '#{measure_dir}'")
-        @measures[measure_dir] = nil
-      else
-        print_message("Successfully loaded measure '#{measure_dir}'")
-        result = measure.get
-        @measures[measure_dir] = result
+      result = nil
+      if !force_reload
+        # load from cache
+        result = @lock.synchronize { @measures[measure_dir] }
+        if result
+          print_message("Using cached measure '#{measure_dir}'")
+        end
       end
 
-      @measure_info[measure_dir] = {}
-    end
-
-    if result
-      # see if there are updates, want to make sure to perform both checks so do outside of conditional
-      file_updates = result.checkForUpdatesFiles # checks if any files have been updated
-      xml_updates = result.checkForUpdatesXML # only checks if xml as loaded has been changed since last save
+      if !result
+        # load from disk
+        print_message("Attempting to load measure '#{measure_dir}'")
 
-      readme_in_path = File.join(measure_dir, "README.md.erb")
-      readme_out_path = File.join(measure_dir, "README.md")
+        measure = OpenStudio::BCLMeasure.load(measure_dir)
+        if measure.empty?
+          print_message("Failed to load measure '#{measure_dir}'")
+          @lock.synchronize { @measures[measure_dir] = nil }
+        else
+          print_message("Successfully loaded measure '#{measure_dir}'")
+          result = measure.get
+          @lock.synchronize { @measures[measure_dir] = result }
+        end
 
-      readme_out_of_date = false
-      if File.exists?(readme_in_path) && !File.exists?(readme_out_path)
-        readme_out_of_date = true
+        @lock.synchronize { @measure_info[measure_dir] = {} }
       end
 
-      missing_fields = false
-      begin
-        missing_fields = result.missingRequiredFields
-      rescue
-      end
+      if result
+        # see if there are updates, want to make sure to perform both checks so do outside of conditional
+        file_updates = result.checkForUpdatesFiles # checks if any files have been updated
+        xml_updates = result.checkForUpdatesXML # only checks if xml as loaded has been changed since last save
 
-      if file_updates || xml_updates || missing_fields || readme_out_of_date
-        print_message("Changes detected, updating '#{measure_dir}'")
+        readme_in_path = File.join(measure_dir, "README.md.erb")
+        readme_out_path = File.join(measure_dir, "README.md")
 
-        # clear cache before calling get_measure_info
-        @measure_info[measure_dir] = {}
+        readme_out_of_date = false
+        if File.exists?(readme_in_path) && !File.exists?(readme_out_path)
+          readme_out_of_date = true
+        end
 
-        # try to load the ruby measure
-        info = get_measure_info(measure_dir, result, "", OpenStudio::Model::OptionalModel.new, OpenStudio::OptionalWorkspace.new)
-        info.update(result)
+        missing_fields = false
+        begin
+          missing_fields = result.missingRequiredFields
+        rescue
+        end
 
-        # update README.md.erb
-        if File.exists?(readme_in_path)
+        if file_updates || xml_updates || missing_fields || readme_out_of_date
+          print_message("Changes detected, updating '#{measure_dir}'")
 
-          begin
-            # delete README.md if it exists
-            File.delete(readme_out_path) if File.exists?(readme_out_path)
+          # clear cache before calling get_measure_info
+          @lock.synchronize { @measure_info[measure_dir] = {} }
 
-            readme_in = nil
-            File.open(readme_in_path, 'r') do |file|
-              readme_in = file.read
-            end
+          # try to load the ruby measure
+          info = get_measure_info(measure_dir, result, "", OpenStudio::Model::OptionalModel.new, OpenStudio::OptionalWorkspace.new)
+          info.update(result)
 
-            result_hash = measure_hash(measure_dir, result, info)
+          # update README.md.erb
+          if File.exists?(readme_in_path)
 
-            renderer = ERB.new(readme_in)
-            result_binding = MeasureInfoBinding.new(info, result_hash)
-            readme_out = renderer.result(result_binding.get_binding)
+            begin
+              # delete README.md if it exists
+              File.delete(readme_out_path) if File.exists?(readme_out_path)
 
-            # write README.me file
-            File.open(readme_out_path, 'w') do |file|
-              file << readme_out
-              # make sure data is written to the disk one way or the other
-              begin
-                file.fsync
-              rescue StandardError
-                file.flush
+              readme_in = nil
+              File.open(readme_in_path, 'r') do |file|
+                readme_in = file.read
+              end
+
+              result_hash = measure_hash(measure_dir, result, info)
+
+              renderer = ERB.new(readme_in)
+              result_binding = MeasureInfoBinding.new(info, result_hash)
+              readme_out = renderer.result(result_binding.get_binding)
+
+              # write README.me file
+              File.open(readme_out_path, 'w') do |file|
+                file << readme_out
+                # make sure data is written to the disk one way or the other
+                begin
+                  file.fsync
+                rescue StandardError
+                  file.flush
+                end
               end
-            end
 
-            # update the files
-            result.checkForUpdatesFiles
+              # update the files
+              result.checkForUpdatesFiles
 
-          rescue => e
-            # update error in info
-            info = OpenStudio::Ruleset::RubyUserScriptInfo.new(e.message)
-            info.update(result)
+            rescue => e
+              # update error in info
+              info = OpenStudio::Ruleset::RubyUserScriptInfo.new(e.message)
+              info.update(result)
+            end
+
+            # check for file updates
+            file_updates = result.checkForUpdatesFiles
           end
 
-          # check for file updates
-          file_updates = result.checkForUpdatesFiles
+          result.save
+          @lock.synchronize { @measures[measure_dir] = result }
         end
-
-        result.save
-        @measures[measure_dir] = result
       end
-    end
 
-    return result
+      result
+    end
   end
 
   # returns OpenStudio::Ruleset::RubyUserScriptInfo
   def get_measure_info(measure_dir, measure, osm_path, model, workspace)
+    with_key_lock(measure_dir) do
 
-    result = nil
+      result = nil
 
-    # load from cache
-    temp = @measure_info[measure_dir]
-    if temp
-      result = temp[osm_path]
+      # load from cache
+      result = @lock.synchronize { (@measure_info[measure_dir] || {})[osm_path] }
       if result
         print_message("Using cached measure info for '#{measure_dir}', '#{osm_path}'")
       end
-    end
 
-    # try to load the ruby measure
-    if !result
+      # try to load the ruby measure
+      if !result
+
+        # DLM: this is where we are executing user's arbitrary Ruby code
+        # might need some timeouts or additional protection
+        print_message("Loading measure info for '#{measure_dir}', '#{osm_path}'")
+        @script_lock.synchronize do
+          begin
+            result = OpenStudio::Ruleset.getInfo(measure, model, workspace)
+          rescue Exception => e
+            result = OpenStudio::Ruleset::RubyUserScriptInfo.new(e.message)
+          end
+        end
 
-      # DLM: this is where we are executing user's arbitrary Ruby code
-      # might need some timeouts or additional protection
-      print_message("Loading measure info for '#{measure_dir}', '#{osm_path}'")
-      begin
-        result = OpenStudio::Ruleset.getInfo(measure, model, workspace)
-      rescue Exception => e
-        result = OpenStudio::Ruleset::RubyUserScriptInfo.new(e.message)
+        @lock.synchronize do
+          @measure_info[measure_dir] = {} if @measure_info[measure_dir].nil?
+          @measure_info[measure_dir][osm_path] = result
+        end
       end
 
-      @measure_info[measure_dir] = {} if @measure_info[measure_dir].nil?
-      @measure_info[measure_dir][osm_path] = result
+      result
     end
-
-    return result
   end
 
   def get_arguments_from_measure(measure_dir, measure)
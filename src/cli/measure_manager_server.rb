@@ -36,18 +36,42 @@ class MeasureManagerServlet < WEBrick::HTTPServlet::AbstractServlet
 
   @@instance = nil
 
-  def initialize(server)
+  # WEBrick serves each request on its own thread, MeasureManager locks per measure and per model
+  # so that requests for different measures and models run concurrently
+  def initialize(server, max_cache_bytes = nil)
     super
-    @mutex = Mutex.new
-    #print_message("new @mutex = #{@mutex}")
-    @measure_manager = MeasureManager.new
+    @measure_manager = MeasureManager.new(nil, max_cache_bytes)
     @my_measures_dir = File.join(Dir.home, "OpenStudio/Measures/").to_s
+    @metrics_mutex = Mutex.new
+    @metrics = {} # "METHOD /path" => {:count, :total_ms, :max_ms, :last_ms}
   end
 
   def print_message(message)
     puts message
   end
 
+  # records how long a request took
+  def record_latency(method, path, start_time)
+    elapsed_ms = 1000.0 * (Process.clock_gettime(Process::CLOCK_MONOTONIC) - start_time)
+    @metrics_mutex.synchronize do
+      metric = (@metrics["#{method} #{path}"] ||= {:count => 0, :total_ms => 0.0, :max_ms => 0.0, :last_ms => 0.0})
+      metric[:count] += 1
+      metric[:total_ms] += elapsed_ms
+      metric[:max_ms] = elapsed_ms if elapsed_ms > metric[:max_ms]
+      metric[:last_ms] = elapsed_ms
+    end
+  end
+
+  # returns latency metrics for each endpoint that has been requested
+  def metrics
+    @metrics_mutex.synchronize do
+      @metrics.map do |endpoint, metric|
+        {:endpoint => endpoint, :count => metric[:count], :mean_ms => metric[:total_ms] / metric[:count],
+         :max_ms => metric[:max_ms], :last_ms => metric[:last_ms]}
+      end
+    end
+  end
+
   def self.get_instance(server, *options)
     @@instance = self.new(server, *options) if @@instance.nil?
     return @@instance
@@ -55,11 +79,8 @@ class MeasureManagerServlet < WEBrick::HTTPServlet::AbstractServlet
 
   def do_GET(request, response)
 
+    start_time = Process.clock_gettime(Process::CLOCK_MONOTONIC)
     begin
-      #print_message("waiting for @mutex = #{@mutex}")
-      @mutex.lock
-      #print_message("locked @mutex = #{@mutex}")
-
       response.status = 200
       response.content_type = 'application/json'
 
@@ -72,25 +93,35 @@ class MeasureManagerServlet < WEBrick::HTTPServlet::AbstractServlet
 
       when "/internal_state"
 
+        # copy the state so that measure_hash is computed without holding the manager's lock
+        osm_state = nil
+        measure_state = nil
+        measure_info_state = nil
+        @measure_manager.synchronize do
+          osm_state = @measure_manager.osms.to_a
+          measure_state = @measure_manager.measures.dup
+          measure_info_state = @measure_manager.measure_info.map { |measure_dir, value| [measure_dir, value ? value.to_a : nil] }
+        end
+
         osms = []
-        @measure_manager.osms.each_pair do |osm_path, value|
+        osm_state.each do |osm_path, value|
           if value
             osms << {:osm_path => osm_path, :checksum => value[:checksum]}
           end
         end
 
         measures = []
-        @measure_manager.measures.each_pair do |measure_dir, measure|
+        measure_state.each_pair do |measure_dir, measure|
           if measure
             measures << @measure_manager.measure_hash(measure_dir, measure)
           end
         end
 
         measure_info = []
-        @measure_manager.measure_info.each_pair do |measure_dir, value|
-          measure = @measure_manager.measures[measure_dir]
+        measure_info_state.each do |measure_dir, value|
+          measure = measure_state[measure_dir]
           if measure && value
-            value.each_pair do |osm_path, info|
+            value.each do |osm_path, info|
               if info
                 temp = @measure_manager.measure_hash(measure_dir, measure, info)
                 measure_info << {:measure_dir => measure_dir, :osm_path => osm_path, :arguments => temp[:arguments]}
@@ -102,6 +133,14 @@ class MeasureManagerServlet < WEBrick::HTTPServlet::AbstractServlet
         result[:osms] = osms
         result[:measures] = measures
         result[:measure_info] = measure_info
+        result[:model_cache] = @measure_manager.cache_state
+
+        response.body = JSON.generate(result)
+
+      when "/metrics"
+
+        result[:model_cache] = @measure_manager.cache_state
+        result[:endpoints] = metrics
 
         response.body = JSON.generate(result)
 
@@ -117,17 +156,14 @@ class MeasureManagerServlet < WEBrick::HTTPServlet::AbstractServlet
       print_message(e.message)
       print_message(e.backtrace.inspect)
     ensure
-      @mutex.unlock
+      record_latency("GET", request.path, start_time)
     end
   end
 
   def do_POST (request, response)
 
+    start_time = Process.clock_gettime(Process::CLOCK_MONOTONIC)
     begin
-      #print_message("waiting for @mutex = #{@mutex}")
-      @mutex.lock
-      #print_message("locked @mutex = #{@mutex}")
-
       response.status = 200
       response.content_type = 'application/json'
 
@@ -357,7 +393,7 @@ class MeasureManagerServlet < WEBrick::HTTPServlet::AbstractServlet
       print_message(e.backtrace.inspect)
 
     ensure
-      @mutex.unlock
+      record_latency("POST", request.path, start_time)
     end
   end
 
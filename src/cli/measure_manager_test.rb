@@ -190,6 +190,22 @@ def duplicate_measure(old_measure_dir, measure_dir, name, class_name, taxonomy_t
   return result
 end
 
+def metrics
+
+  result = {}
+
+  begin
+    request = RestClient::Resource.new("#{@host}/metrics", user: @user, password: @pass)
+    response = request.get(accept: :json)
+    result = JSON.parse(response.body, :symbolize_names => true)
+  rescue Exception => e
+    puts "metrics failed"
+    puts e.message
+  end
+
+  return result
+end
+
 if File.exist?('./output/')
   FileUtils.rm_rf('./output/')
 end
@@ -290,6 +306,16 @@ puts result
 puts
 STDOUT.flush
 
+# these will succeed, requests for different measures are computed concurrently
+puts 9.1
+threads = [measure_dir, new_measure_dir].map do |dir|
+  Thread.new { compute_arguments(dir, osm_path) }
+end
+threads.each { |thread| puts thread.value }
+puts metrics
+puts
+STDOUT.flush
+
 # this will succeed
 puts 10
 reset()
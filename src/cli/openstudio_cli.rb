@@ -1188,7 +1188,7 @@ class Measure
     # find the directory
     directory = nil
     if sub_argv.size > 1
-      unless (sub_argv[0] == '-s' || sub_argv[0] == '--start_server')
+      unless (sub_argv.include?('-s') || sub_argv.include?('--start_server'))
         directory = sub_argv.pop
         $logger.debug("Directory to examine is #{directory}")
         $logger.debug("Remaining args are #{sub_argv}")
@@ -1218,6 +1218,9 @@ class Measure
         options[:start_server] = true
         options[:start_server_port] = port
       end
+      o.on('--max_cache_mb MB', Integer, 'Memory budget in MB for models cached by the measure manager server') do |max_cache_mb|
+        options[:max_cache_mb] = max_cache_mb
+      end
       # TODO: run unit tests
     end
 
@@ -1368,9 +1371,14 @@ class Measure
         port = 1234
       end
 
+      max_cache_bytes = nil
+      if options[:max_cache_mb]
+        max_cache_bytes = options[:max_cache_mb] * 1024 * 1024
+      end
+
       server = WEBrick::HTTPServer.new(:Port => port)
 
-      server.mount "/", MeasureManagerServlet
+      server.mount "/", MeasureManagerServlet, max_cache_bytes
 
       trap("INT") {
           server.shutdown
@@ -29,15 +29,225 @@
 
 #include "ErrorFile.hpp"
 
-#include <boost/regex.hpp>
 #include <boost/algorithm/string.hpp>
 
+#include <cstring>
+#include <unordered_map>
+
 namespace openstudio {
 namespace energyplus {
 
+  namespace {
+
+    // err file lines are classified by hand rather than with regexes, each helper documents the expression it replaces
+
+    // \s
+    inline bool isSpace(char c)
+    {
+      return (c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f');
+    }
+
+    // [[:alpha:]]
+    inline bool isAlpha(char c)
+    {
+      return ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'));
+    }
+
+    std::string::size_type skipSpace(const std::string& line, std::string::size_type i)
+    {
+      while (i < line.size() && isSpace(line[i])) {
+        ++i;
+      }
+      return i;
+    }
+
+    bool hasPrefix(const std::string& line, std::string::size_type i, const char* prefix)
+    {
+      std::string::size_type n = std::strlen(prefix);
+      return (i <= line.size()) && (line.size() - i >= n) && (line.compare(i, n, prefix) == 0);
+    }
+
+    // ^\s*\**\s+\*\*
+    // fills ends with the positions just past the opening "**", in the order the regex would try them
+    unsigned markerEnds(const std::string& line, std::string::size_type ends[2])
+    {
+      unsigned result = 0;
+      std::string::size_type first = skipSpace(line, 0);
+      std::string::size_type starsEnd = line.find_first_not_of('*', first);
+      if (starsEnd == std::string::npos) {
+        starsEnd = line.size();
+      }
+
+      // all leading stars, then whitespace, e.g. "   *************  ** Warning **"
+      if (starsEnd > first) {
+        std::string::size_type i = skipSpace(line, starsEnd);
+        if ((i > starsEnd) && hasPrefix(line, i, "**")) {
+          ends[result++] = i + 2;
+        }
+      }
+
+      // no leading stars, e.g. "   ** Warning **"
+      if ((first > 0) && hasPrefix(line, first, "**")) {
+        ends[result++] = first + 2;
+      }
+
+      return result;
+    }
+
+    // ^\s*\**\s+\*\*\s*([[:alpha:]]+)\s*\*\*(.*)$
+    bool matchWarningOrError(const std::string& line, std::string& type, std::string& rest)
+    {
+      std::string::size_type ends[2];
+      unsigned n = markerEnds(line, ends);
+      for (unsigned j = 0; j < n; ++j) {
+        std::string::size_type typeBegin = skipSpace(line, ends[j]);
+        std::string::size_type typeEnd = typeBegin;
+        while (typeEnd < line.size() && isAlpha(line[typeEnd])) {
+          ++typeEnd;
+        }
+        if (typeEnd == typeBegin) {
+          continue;
+        }
+        std::string::size_type i = skipSpace(line, typeEnd);
+        if (hasPrefix(line, i, "**")) {
+          type = line.substr(typeBegin, typeEnd - typeBegin);
+          rest = line.substr(i + 2);
+          return true;
+        }
+      }
+      return false;
+    }
+
+    // ^\s*\**\s+\*\*\s*~~~\s*\*\*(.*)$
+    bool matchWarningOrErrorContinue(const std::string& line, std::string& rest)
+    {
+      std::string::size_type ends[2];
+      unsigned n = markerEnds(line, ends);
+      for (unsigned j = 0; j < n; ++j) {
+        std::string::size_type i = skipSpace(line, ends[j]);
+        if (!hasPrefix(line, i, "~~~")) {
+          continue;
+        }
+        i = skipSpace(line, i + 3);
+        if (hasPrefix(line, i, "**")) {
+          rest = line.substr(i + 2);
+          return true;
+        }
+      }
+      return false;
+    }
+
+    // [[:alnum:]_]
+    inline bool isWordChar(char c)
+    {
+      return (isAlpha(c) || (c >= '0' && c <= '9') || c == '_');
+    }
+
+    // true if the number starting at i follows "WORD ", where WORD is an upper case token such as the "ZONE" of
+    // "ZONE 1" or the "SURFACE" of "SURFACE 21"; EnergyPlus writes unquoted object names this way
+    bool followsUpperCaseWord(const std::string& message, std::string::size_type i)
+    {
+      if ((i < 2) || (message[i - 1] != ' ')) {
+        return false;
+      }
+      std::string::size_type begin = i - 1;
+      while ((begin > 0) && !isSpace(message[begin - 1]) && (message[begin - 1] != '=')) {
+        --begin;
+      }
+      bool upper = false;
+      for (std::string::size_type j = begin; j < i - 1; ++j) {
+        char c = message[j];
+        if (c >= 'A' && c <= 'Z') {
+          upper = true;
+        } else if (!((c >= '0' && c <= '9') || c == '_' || c == '-')) {
+          return false;
+        }
+      }
+      return upper;
+    }
+
+    // the key used to count repeats of a warning, the full message with the numbers that change each time the
+    // same condition recurs (time stamps, values) replaced by '#'; numbers inside double quotes, numbers that are
+    // part of a word (e.g. "window_1") and numbers that follow an upper case word (e.g. "SURFACE 21") are kept
+    // as they name the object the warning is about
+    std::string warningKey(const std::string& message)
+    {
+      std::string result;
+      result.reserve(message.size());
+      bool quoted = false;
+      std::string::size_type i = 0;
+      while (i < message.size()) {
+        char c = message[i];
+        if (c == '"') {
+          quoted = !quoted;
+        }
+        if (!quoted && (c == '.' || (c >= '0' && c <= '9')) && (i == 0 || !isWordChar(message[i - 1]))) {
+          std::string::size_type end = message.find_first_not_of("0123456789.", i);
+          if (end == std::string::npos) {
+            end = message.size();
+          }
+          bool isNumber = (message.find_first_of("0123456789", i) < end) && (end == message.size() || !isWordChar(message[end]));
+          if (isNumber && followsUpperCaseWord(message, i)) {
+            result.append(message, i, end - i);
+            i = end;
+            continue;
+          }
+          if (isNumber) {
+            result += '#';
+            i = end;
+            continue;
+          }
+        }
+        result += c;
+        ++i;
+      }
+      return result;
+    }
+
+    // ^\s*\*+ , returns the position just past the space or npos
+    std::string::size_type summaryTextBegin(const std::string& line)
+    {
+      std::string::size_type first = skipSpace(line, 0);
+      std::string::size_type starsEnd = line.find_first_not_of('*', first);
+      if ((starsEnd == std::string::npos) || (starsEnd == first) || (line[starsEnd] != ' ')) {
+        return std::string::npos;
+      }
+      return starsEnd + 1;
+    }
+
+    // ^\s*\*+ EnergyPlus Completed Successfully.*
+    // ^\s*\*+ GroundTempCalc\S* Completed Successfully.*
+    bool matchCompletedSuccessful(const std::string& line)
+    {
+      std::string::size_type i = summaryTextBegin(line);
+      if (i == std::string::npos) {
+        return false;
+      }
+      if (hasPrefix(line, i, "EnergyPlus Completed Successfully")) {
+        return true;
+      }
+      if (hasPrefix(line, i, "GroundTempCalc")) {
+        i += std::strlen("GroundTempCalc");
+        while (i < line.size() && !isSpace(line[i])) {
+          ++i;
+        }
+        return hasPrefix(line, i, " Completed Successfully");
+      }
+      return false;
+    }
+
+    // ^\s*\*+ EnergyPlus Terminated.*
+    bool matchCompletedUnsuccessful(const std::string& line)
+    {
+      std::string::size_type i = summaryTextBegin(line);
+      return (i != std::string::npos) && hasPrefix(line, i, "EnergyPlus Terminated");
+    }
+
+  } // anonymous namespace
+
   /// constructor
-  ErrorFile::ErrorFile(const openstudio::path& errPath)
-    : m_completed(false), m_completedSuccessfully(false)
+  ErrorFile::ErrorFile(const openstudio::path& errPath, bool aggregateWarnings)
+    : m_aggregateWarnings(aggregateWarnings), m_completed(false), m_completedSuccessfully(false)
   {
     openstudio::filesystem::ifstream ifs(errPath);
     parse(ifs);
@@ -50,6 +260,18 @@ namespace energyplus {
     return m_warnings;
   }
 
+  /// get the distinct warning keys
+  std::vector<std::string> ErrorFile::warningKeys() const
+  {
+    return m_warningKeys;
+  }
+
+  /// get the number of times each warning key was reported
+  std::vector<unsigned> ErrorFile::warningCounts() const
+  {
+    return m_warningCounts;
+  }
+
   /// get severe errors
   std::vector<std::string> ErrorFile::severeErrors() const
   {
@@ -78,55 +300,35 @@ namespace energyplus {
   void ErrorFile::parse(openstudio::filesystem::ifstream& is)
   {
     std::string line;
+    std::string warningOrErrorType;
+    std::string warningOrErrorString;
+    std::string temp;
 
+    // index into m_warningKeys for each key seen so far
+    std::unordered_map<std::string, std::size_t> warningKeyIndex;
 
-    // matches[1], warning/error type
-    // matches[2], rest of line
-    boost::regex warningOrError("^\\s*\\**\\s+\\*\\*\\s*([[:alpha:]]+)\\s*\\*\\*(.*)$");
-
-    // matches[1], rest of line
-    boost::regex warningOrErrorContinue("^\\s*\\**\\s+\\*\\*\\s*~~~\\s*\\*\\*(.*)$");
-
-    // completed successfully
-    boost::regex completedSuccessful("^\\s*\\*+ EnergyPlus Completed Successfully.*");
-
-    // ground temp completed successfully
-    boost::regex groundTempCompletedSuccessful("^\\s*\\*+ GroundTempCalc\\S* Completed Successfully.*");
-
-    // completed unsuccessfully
-    boost::regex completedUnsuccessful("^\\s*\\*+ EnergyPlus Terminated.*");
-
-    // repeat count
-
-
-    // read the file line by line using regexes
+    // read the file line by line, classifying each line by its prefix
     bool alreadyGotLine = false;
 
     while (alreadyGotLine || std::getline(is, line)) {
 
       alreadyGotLine = false;
-      boost::smatch matches;
-
-      LOG(Debug, "Parsing ErrorFile Line '" << line << "'");
 
       // parse the file
-      if (boost::regex_search(line, matches, warningOrError)) {
+      if (matchWarningOrError(line, warningOrErrorType, warningOrErrorString)) {
 
-        std::string warningOrErrorType = std::string(matches[1].first, matches[1].second); boost::trim(warningOrErrorType);
-        std::string warningOrErrorString = std::string(matches[2].first, matches[2].second); boost::trim(warningOrErrorString);
+        boost::trim(warningOrErrorType);
+        boost::trim(warningOrErrorString);
 
         // read the rest of the multi line warning or error
         while(true){
-          // std::streampos pos = is.tellg();
           if (!std::getline(is, line)){
             break;
           }
-          if (boost::regex_search(line, matches, warningOrErrorContinue)){
-            std::string temp = std::string(matches[1].first, matches[1].second); boost::trim_right(temp);
+          if (matchWarningOrErrorContinue(line, temp)){
+            boost::trim_right(temp);
             warningOrErrorString += "\n" + temp;
           }else{
-            // unget the line
-            // is.seekg(pos);
             // Instead of rewind then reread (which fails on Windows if you have LF line endings)
             // We just use this bool to avoid having to re-read the line.
             alreadyGotLine = true;
@@ -134,16 +336,27 @@ namespace energyplus {
           }
         }
 
-        LOG(Trace, "Error parsed: " << warningOrErrorString);
-
-
         // correctly sort warnings and errors
         try{
           ErrorLevel level(warningOrErrorType);
 
           switch(level.value()){
             case ErrorLevel::Warning:
-              m_warnings.push_back(warningOrErrorString);
+              {
+                std::string key = warningKey(warningOrErrorString);
+                auto it = warningKeyIndex.find(key);
+                if (it == warningKeyIndex.end()) {
+                  warningKeyIndex.insert(std::make_pair(key, m_warningKeys.size()));
+                  m_warningKeys.push_back(key);
+                  m_warningCounts.push_back(1u);
+                  m_warnings.push_back(warningOrErrorString);
+                } else {
+                  ++m_warningCounts[it->second];
+                  if (!m_aggregateWarnings) {
+                    m_warnings.push_back(warningOrErrorString);
+                  }
+                }
+              }
               break;
             case ErrorLevel::Severe:
               m_severeErrors.push_back(warningOrErrorString);
@@ -157,12 +370,11 @@ namespace energyplus {
           LOG(Error, "Unknown warning or error level '" << warningOrErrorType << "'");
         }
 
-      }else if (boost::regex_match(line, completedSuccessful)
-                || boost::regex_match(line, groundTempCompletedSuccessful)) {
+      }else if (matchCompletedSuccessful(line)) {
         m_completed = true;
         m_completedSuccessfully = true;
         break;
-      }else if (boost::regex_match(line, completedUnsuccessful)){
+      }else if (matchCompletedUnsuccessful(line)){
         m_completed = true;
         m_completedSuccessfully = false;
         break;
@@ -53,12 +53,20 @@ namespace energyplus {
   class ENERGYPLUS_API ErrorFile {
    public:
 
-    /// constructor
-    ErrorFile(const openstudio::path& errPath);
+    /// constructor, if aggregateWarnings is true only the first warning reported for each key is kept in warnings()
+    ErrorFile(const openstudio::path& errPath, bool aggregateWarnings = false);
 
     /// get warnings
     std::vector<std::string> warnings() const;
 
+    /// get the distinct warning keys in order of first occurrence, a key is the full warning message with time stamps and
+    /// values replaced by '#' so that a condition reported again at another time step shares its key; numbers in object
+    /// names, quoted or following an upper case word as in "SURFACE 21", are kept so different objects do not share a key
+    std::vector<std::string> warningKeys() const;
+
+    /// get the number of times each warning key was reported, parallel to warningKeys()
+    std::vector<unsigned> warningCounts() const;
+
     /// get severe errors
     std::vector<std::string> severeErrors() const;
 
@@ -77,7 +85,10 @@ namespace energyplus {
 
     void parse(openstudio::filesystem::ifstream& is);
 
+    bool m_aggregateWarnings;
     std::vector<std::string> m_warnings;
+    std::vector<std::string> m_warningKeys;
+    std::vector<unsigned> m_warningCounts;
     std::vector<std::string> m_severeErrors;
     std::vector<std::string> m_fatalErrors;
     bool m_completed;
@@ -60,10 +60,12 @@
 #include "../model/ConcreteModelObjects.hpp"
 
 #include "../utilities/idf/Workspace.hpp"
+#include "../utilities/idf/IdfWriter.hpp"
 #include "../utilities/idf/IdfExtensibleGroup.hpp"
 #include "../utilities/idf/IdfFile.hpp"
 #include "../utilities/idf/WorkspaceObjectOrder.hpp"
 #include "../utilities/core/Logger.hpp"
+#include "../utilities/core/Parallel.hpp"
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/core/FilesystemHelpers.hpp"
 #include "../utilities/geometry/BoundingBox.hpp"
@@ -84,6 +86,12 @@
 
 #include "../utilities/idd/IddEnums.hpp"
 
+#include <boost/algorithm/string/case_conv.hpp>
+
+#include <algorithm>
+#include <limits>
+
+#include <mutex>
 #include <thread>
 
 #include <sstream>
@@ -97,6 +105,8 @@ namespace openstudio {
 namespace energyplus {
 
 ForwardTranslator::ForwardTranslator()
+  : m_progressBar(nullptr),
+    m_parallelTranslation(true)
 {
   m_logSink.setLogLevel(Warn);
   m_logSink.setChannelRegex(boost::regex("openstudio\\.energyplus\\.ForwardTranslator"));
@@ -114,15 +124,9 @@ ForwardTranslator::ForwardTranslator()
 
 Workspace ForwardTranslator::translateModel( const Model & model, ProgressBar* progressBar )
 {
-  Model modelCopy = model.clone(true).cast<Model>();
+  translateModelClone(model, progressBar);
 
-  m_progressBar = progressBar;
-  if (m_progressBar){
-    m_progressBar->setMinimum(0);
-    m_progressBar->setMaximum(model.numObjects());
-  }
-
-  return translateModelPrivate(modelCopy, true);
+  return createWorkspace();
 }
 
 Workspace ForwardTranslator::translateModelObject( ModelObject & modelObject )
@@ -132,14 +136,43 @@ Workspace ForwardTranslator::translateModelObject( ModelObject & modelObject )
 
   m_progressBar = nullptr;
 
-  return translateModelPrivate(modelCopy, false);
+  translateModelPrivate(modelCopy, false);
+
+  return createWorkspace();
+}
+
+bool ForwardTranslator::translateModelToIdf( const Model & model, std::ostream& os, ProgressBar* progressBar )
+{
+  translateModelClone(model, progressBar);
+
+  return IdfWriter(IddFileType::EnergyPlus).print(m_idfObjects, os);
+}
+
+bool ForwardTranslator::translateModelToIdf( const Model & model, const openstudio::path& p, bool overwrite, ProgressBar* progressBar )
+{
+  translateModelClone(model, progressBar);
+
+  return IdfWriter(IddFileType::EnergyPlus).save(m_idfObjects, p, overwrite);
+}
+
+void ForwardTranslator::translateModelClone( const Model & model, ProgressBar* progressBar )
+{
+  Model modelCopy = model.clone(true).cast<Model>();
+
+  m_progressBar = progressBar;
+  if (m_progressBar){
+    m_progressBar->setMinimum(0);
+    m_progressBar->setMaximum(model.numObjects());
+  }
+
+  translateModelPrivate(modelCopy, true);
 }
 
 std::vector<LogMessage> ForwardTranslator::warnings() const
 {
   std::vector<LogMessage> result;
 
-  for (LogMessage logMessage : m_logSink.logMessages()){
+  for (const LogMessage& logMessage : logMessages()){
     if (logMessage.logLevel() == Warn){
       result.push_back(logMessage);
     }
@@ -152,7 +185,7 @@ std::vector<LogMessage> ForwardTranslator::errors() const
 {
   std::vector<LogMessage> result;
 
-  for (LogMessage logMessage : m_logSink.logMessages()){
+  for (const LogMessage& logMessage : logMessages()){
     if (logMessage.logLevel() > Warn){
       result.push_back(logMessage);
     }
@@ -161,6 +194,30 @@ std::vector<LogMessage> ForwardTranslator::errors() const
   return result;
 }
 
+std::vector<LogMessage> ForwardTranslator::logMessages() const
+{
+  std::string logText = m_logSink.string();
+  if (m_stagedLogMessages.empty()){
+    return LogMessage::parseLogText(logText);
+  }
+
+  std::vector<LogMessage> result;
+  std::size_t position = 0;
+  for (const auto& stagedLogMessage : m_stagedLogMessages){
+    std::size_t end = std::min(stagedLogMessage.first, logText.size());
+    if (end > position){
+      std::vector<LogMessage> logMessages = LogMessage::parseLogText(logText.substr(position, end - position));
+      result.insert(result.end(), logMessages.begin(), logMessages.end());
+      position = end;
+    }
+    result.push_back(stagedLogMessage.second);
+  }
+  std::vector<LogMessage> logMessages = LogMessage::parseLogText(logText.substr(position));
+  result.insert(result.end(), logMessages.begin(), logMessages.end());
+
+  return result;
+}
+
 // temp code
 void ForwardTranslator::setKeepRunControlSpecialDays(bool keepRunControlSpecialDays)
 {
@@ -189,7 +246,11 @@ void ForwardTranslator::setExcludeVariableDictionary(bool excludeVariableDiction
   m_excludeVariableDictionary = excludeVariableDictionary;
 }
 
-Workspace ForwardTranslator::translateModelPrivate( model::Model & model, bool fullModelTranslation )
+void ForwardTranslator::setParallelTranslation(bool parallelTranslation) {
+  m_parallelTranslation = parallelTranslation;
+}
+
+void ForwardTranslator::translateModelPrivate( model::Model & model, bool fullModelTranslation )
 {
   reset();
 
@@ -509,6 +570,11 @@ Workspace ForwardTranslator::translateModelPrivate( model::Model & model, bool f
     }
   }
 
+  // the model is not modified below this point, translate independent objects ahead of the serial translation
+  if (m_parallelTranslation){
+    stageIndependentTranslations(model);
+  }
+
   if (fullModelTranslation){
 
     // translate life cycle cost parameters
@@ -635,6 +701,103 @@ Workspace ForwardTranslator::translateModelPrivate( model::Model & model, bool f
     this->createStandardOutputRequests();
   }
 
+  OS_ASSERT(std::count_if(m_idfObjects.begin(), m_idfObjects.end(), [](const IdfObject& idfObject) {
+    return idfObject.iddObject().type() == IddObjectType::Version;
+  }) == 1);
+}
+
+void ForwardTranslator::stageIndependentTranslations( model::Model & model )
+{
+  std::vector<ModelObject> modelObjects;
+  for (const IddObjectType& iddObjectType : independentIddObjectTypes()){
+    for (const WorkspaceObject& workspaceObject : model.getObjectsByType(iddObjectType)){
+      ModelObject modelObject = workspaceObject.cast<ModelObject>();
+      // children are translated with their parent by translateAndMapModelObject, leave those to the serial translation
+      boost::optional<ParentObject> parent = modelObject.optionalCast<ParentObject>();
+      if (!parent || parent->children().empty()){
+        modelObjects.push_back(modelObject);
+      }
+    }
+  }
+
+  std::size_t numBlocks = std::min<std::size_t>(System::numberOfProcessors(), modelObjects.size() / 64);
+  if (numBlocks < 2){
+    return;
+  }
+
+  std::vector<StagedTranslation> stagedTranslations(modelObjects.size());
+  std::size_t blockSize = (modelObjects.size() + numBlocks - 1) / numBlocks;
+
+  // messages are kept with their object and added to the log when the serial translation reaches it,
+  // the first block runs on the calling thread so m_logSink must not see them now
+  m_logSink.disable();
+  try {
+    parallelFor(numBlocks, [&](std::size_t block) {
+      // each block translates into its own ForwardTranslator, the model is only read
+      ForwardTranslator translator;
+      std::size_t begin = std::min(modelObjects.size(), block * blockSize);
+      std::size_t end = std::min(modelObjects.size(), begin + blockSize);
+      for (std::size_t i = begin; i < end; ++i){
+        std::size_t numIdfObjects = translator.m_idfObjects.size();
+        stagedTranslations[i].result = translator.translateAndMapModelObject(modelObjects[i]);
+        stagedTranslations[i].idfObjects.assign(translator.m_idfObjects.begin() + numIdfObjects, translator.m_idfObjects.end());
+        if (!translator.m_logSink.string().empty()){
+          stagedTranslations[i].logMessages = translator.m_logSink.logMessages();
+          translator.m_logSink.resetStringStream();
+        }
+      }
+    }, 1);
+  } catch (...) {
+    m_logSink.enable();
+    throw;
+  }
+  m_logSink.enable();
+
+  for (std::size_t i = 0; i < modelObjects.size(); ++i){
+    m_stagedTranslations.insert(std::make_pair(modelObjects[i].handle(), std::move(stagedTranslations[i])));
+  }
+}
+
+const std::vector<IddObjectType>& ForwardTranslator::independentIddObjectTypes()
+{
+  static const std::vector<IddObjectType> result {
+    IddObjectType::OS_Curve_Bicubic,
+    IddObjectType::OS_Curve_Biquadratic,
+    IddObjectType::OS_Curve_Cubic,
+    IddObjectType::OS_Curve_DoubleExponentialDecay,
+    IddObjectType::OS_Curve_Exponent,
+    IddObjectType::OS_Curve_ExponentialDecay,
+    IddObjectType::OS_Curve_ExponentialSkewNormal,
+    IddObjectType::OS_Curve_FanPressureRise,
+    IddObjectType::OS_Curve_Functional_PressureDrop,
+    IddObjectType::OS_Curve_Linear,
+    IddObjectType::OS_Curve_Quadratic,
+    IddObjectType::OS_Curve_QuadraticLinear,
+    IddObjectType::OS_Curve_Quartic,
+    IddObjectType::OS_Curve_RectangularHyperbola1,
+    IddObjectType::OS_Curve_RectangularHyperbola2,
+    IddObjectType::OS_Curve_Sigmoid,
+    IddObjectType::OS_Curve_Triquadratic,
+    IddObjectType::OS_Material,
+    IddObjectType::OS_Material_AirGap,
+    IddObjectType::OS_Material_InfraredTransparent,
+    IddObjectType::OS_Material_NoMass,
+    IddObjectType::OS_MaterialProperty_GlazingSpectralData,
+    IddObjectType::OS_WindowMaterial_Blind,
+    IddObjectType::OS_WindowMaterial_Gas,
+    IddObjectType::OS_WindowMaterial_GasMixture,
+    IddObjectType::OS_WindowMaterial_Glazing,
+    IddObjectType::OS_WindowMaterial_Glazing_RefractionExtinctionMethod,
+    IddObjectType::OS_WindowMaterial_Screen,
+    IddObjectType::OS_WindowMaterial_Shade,
+    IddObjectType::OS_WindowMaterial_SimpleGlazingSystem,
+    IddObjectType::OS_Output_Variable
+  };
+  return result;
+}
+
+Workspace ForwardTranslator::createWorkspace()
+{
   Workspace workspace(StrictnessLevel::None, IddFileType::EnergyPlus);
   OptionalWorkspaceObject vo = workspace.versionObject();
   OS_ASSERT(vo);
@@ -648,39 +811,21 @@ Workspace ForwardTranslator::translateModelPrivate( model::Model & model, bool f
   return workspace;
 }
 
-// struct for sorting children in forward translator
-struct ChildSorter {
-  ChildSorter(std::vector<IddObjectType>& iddObjectTypes)
-    : m_iddObjectTypes(iddObjectTypes)
-  {}
-
-  // sort first by position in iddObjectTypes and then by name
-  bool operator()(const model::ModelObject& a, const model::ModelObject& b) const
-  {
-    auto ita = std::find(m_iddObjectTypes.begin(), m_iddObjectTypes.end(), a.iddObject().type());
-    auto itb = std::find(m_iddObjectTypes.begin(), m_iddObjectTypes.end(), b.iddObject().type());
-
-    if (ita < itb){
-      return true;
-    }else if (ita > itb){
-      return false;
-    }
+// sort key for children in forward translator, computed once per child
+struct ChildSortKey {
+  unsigned rank;
+  std::string upperName;
+  unsigned index;
+};
 
-    std::string aname;
-    boost::optional<std::string> oaname = a.name();
-    if (oaname){
-      aname = *oaname;
-    }
-    std::string bname;
-    boost::optional<std::string> obname = b.name();
-    if (obname){
-      bname = *obname;
-    }
-    return istringLess(aname, bname);
+// sort first by position in iddObjectsToTranslate() and then by name, case insensitive like istringLess
+static bool childSortKeyLess(const ChildSortKey& a, const ChildSortKey& b)
+{
+  if (a.rank != b.rank){
+    return a.rank < b.rank;
   }
-
-  std::vector<IddObjectType> m_iddObjectTypes;
-};
+  return std::lexicographical_compare(a.upperName.begin(), a.upperName.end(), b.upperName.begin(), b.upperName.end());
+}
 
 boost::optional<IdfObject> ForwardTranslator::translateAndMapModelObject(ModelObject & modelObject)
 {
@@ -695,6 +840,26 @@ boost::optional<IdfObject> ForwardTranslator::translateAndMapModelObject(ModelOb
 
   LOG(Trace,"Translating " << modelObject.briefDescription() << ".");
 
+  // translated ahead of time by stageIndependentTranslations, these objects have no children
+  auto staged = m_stagedTranslations.find(modelObject.handle());
+  if (staged != m_stagedTranslations.end()){
+    m_idfObjects.insert(m_idfObjects.end(), staged->second.idfObjects.begin(), staged->second.idfObjects.end());
+    if (!staged->second.logMessages.empty()){
+      std::size_t position = m_logSink.string().size();
+      for (const LogMessage& logMessage : staged->second.logMessages){
+        m_stagedLogMessages.push_back(std::make_pair(position, logMessage));
+      }
+    }
+    retVal = staged->second.result;
+    if (retVal){
+      m_map.insert(std::make_pair(modelObject.handle(), *retVal));
+      if (m_progressBar){
+        m_progressBar->setValue((int)m_map.size());
+      }
+    }
+    return retVal;
+  }
+
   switch(modelObject.iddObject().type().value())
   {
   case openstudio::IddObjectType::OS_AdditionalProperties :
@@ -3428,15 +3593,27 @@ boost::optional<IdfObject> ForwardTranslator::translateAndMapModelObject(ModelOb
   if(opo)
   {
     ModelObjectVector children = opo->children();
-    IddObjectTypeVector types = iddObjectsToTranslate();
+    const std::vector<unsigned>& ranks = iddObjectTypeRanks();
+    const unsigned notTranslated = std::numeric_limits<unsigned>::max();
 
     // sort these objects as well
-    std::sort(children.begin(), children.end(), ChildSorter(types));
+    std::vector<ChildSortKey> keys;
+    keys.reserve(children.size());
+    for (const ModelObject& child : children)
+    {
+      unsigned value = child.iddObject().type().value();
+      ChildSortKey key;
+      key.rank = (value < ranks.size()) ? ranks[value] : notTranslated;
+      key.upperName = boost::to_upper_copy(child.nameString());
+      key.index = keys.size();
+      keys.push_back(std::move(key));
+    }
+    std::sort(keys.begin(), keys.end(), childSortKeyLess);
 
-    for(auto & elem : children)
+    for(const ChildSortKey& key : keys)
     {
-      if (std::find(types.begin(),types.end(),elem.iddObject().type()) != types.end()) {
-        translateAndMapModelObject(elem);
+      if (key.rank != notTranslated) {
+        translateAndMapModelObject(children[key.index]);
       }
     }
   }
@@ -3464,6 +3641,31 @@ std::vector<IddObjectType> ForwardTranslator::iddObjectsToTranslate()
   return result;
 }
 
+const std::vector<unsigned>& ForwardTranslator::iddObjectTypeRanks()
+{
+  static std::vector<unsigned> result = iddObjectTypeRanksInitializer();
+  return result;
+}
+
+std::vector<unsigned> ForwardTranslator::iddObjectTypeRanksInitializer()
+{
+  std::vector<IddObjectType> types = iddObjectsToTranslate();
+  const unsigned notTranslated = std::numeric_limits<unsigned>::max();
+
+  int maxValue = 0;
+  for (const IddObjectType& type : types){
+    maxValue = std::max(maxValue, static_cast<int>(type.value()));
+  }
+
+  // first position wins, as std::find would
+  std::vector<unsigned> result(maxValue + 1, notTranslated);
+  for (unsigned i = types.size(); i > 0; --i){
+    result[types[i - 1].value()] = i - 1;
+  }
+
+  return result;
+}
+
 std::vector<IddObjectType> ForwardTranslator::iddObjectsToTranslateInitializer()
 {
   std::vector<IddObjectType> result;
@@ -4095,6 +4297,12 @@ void ForwardTranslator::reset()
 
   m_map.clear();
 
+  m_stagedTranslations.clear();
+
+  m_stagedLogMessages.clear();
+
+  m_fluidPropertiesNames.clear();
+
   m_anyNumberScheduleTypeLimits.reset();
 
   m_alwaysOnSchedule.reset();
@@ -4597,6 +4805,25 @@ boost::optional<IdfFile> ForwardTranslator::findIdfFile(const std::string& path)
   return IdfFile::load(ss, IddFileType::EnergyPlus);
 }
 
+const std::vector<IdfObject>& ForwardTranslator::fluidPropertiesDataSet(const std::string& path) {
+  static std::mutex mutex;
+  static std::map<std::string, std::vector<IdfObject> > dataSets;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  auto it = dataSets.find(path);
+  if (it == dataSets.end()) {
+    std::vector<IdfObject> objects;
+    if (boost::optional<IdfFile> idfFile = findIdfFile(path)) {
+      objects = idfFile->objects();
+    }
+    else {
+      LOG(Error, "Unable to load fluid properties data set '" << path << "'");
+    }
+    it = dataSets.insert(std::make_pair(path, objects)).first;
+  }
+  return it->second;
+}
+
 bool ForwardTranslator::isHVACComponentWithinUnitary(const model::HVACComponent& hvacComponent) const
 {
   if( hvacComponent.containingHVACComponent() )
@@ -4638,15 +4865,9 @@ boost::optional<IdfObject> ForwardTranslator::createFluidProperties(const std::s
   sstm << glycolType << "_" << glycolConcentration;
   std::string glycolName = sstm.str();
 
-  for( auto it = m_idfObjects.begin();
-     it != m_idfObjects.end();
-     ++it )
-  {
-    if(it->iddObject().type().value() == openstudio::IddObjectType::FluidProperties_Name) {
-      if(istringEqual(it->getString(FluidProperties_NameFields::FluidName,true).get(), glycolName)) {
-        return *it;
-      }
-    }
+  auto existing = m_fluidPropertiesNames.find(boost::to_lower_copy(glycolName));
+  if (existing != m_fluidPropertiesNames.end()) {
+    return existing->second;
   }
 
   // TODO: JM 2019-03-22 I am not sure you need this one
@@ -4671,6 +4892,7 @@ boost::optional<IdfObject> ForwardTranslator::createFluidProperties(const std::s
 
   m_idfObjects.push_back(fluidPropName);
   m_idfObjects.push_back(fluidPropGlyConcentration);
+  m_fluidPropertiesNames.insert(std::make_pair(boost::to_lower_copy(glycolName), fluidPropName));
 
   return fluidPropName;
 }
@@ -4678,42 +4900,27 @@ boost::optional<IdfObject> ForwardTranslator::createFluidProperties(const std::s
 boost::optional<IdfObject> ForwardTranslator::createFluidProperties(const std::string& fluidType) {
 
   boost::optional<IdfObject> idfObject;
-  boost::optional<IdfFile> idfFile;
 
-  for( auto it = m_idfObjects.begin();
-     it != m_idfObjects.end();
-     ++it )
-  {
-    if(it->iddObject().type().value() == openstudio::IddObjectType::FluidProperties_Name) {
-      if(istringEqual(it->getString(FluidProperties_NameFields::FluidName,true).get(), fluidType)) {
-        return *it;
-      }
-    }
+  auto existing = m_fluidPropertiesNames.find(boost::to_lower_copy(fluidType));
+  if (existing != m_fluidPropertiesNames.end()) {
+    return existing->second;
   }
 
   FluidPropertiesMap::const_iterator objInMap = m_fluidPropertiesMap.find( fluidType );
-  if( objInMap != m_fluidPropertiesMap.end() )
-  {
-    idfFile = findIdfFile(objInMap->second);
-  }
-  else
+  if( objInMap == m_fluidPropertiesMap.end() )
   {
     LOG(Warn, "Fluid Type not valid choice: '" << fluidType << "'");
     return boost::none;
   }
 
-  if(idfFile){
-    std::vector<IdfObject> fluidObjects = idfFile->objects();
-
-    for( auto it = fluidObjects.begin();
-       it != fluidObjects.end();
-       ++it )
-    {
-      if(it->iddObject().type().value() == openstudio::IddObjectType::FluidProperties_Name) {
-        idfObject = *it;
-      }
-      m_idfObjects.push_back(*it);
+  // copy the shared data set, the copies belong to this translation
+  for (const IdfObject& fluidObject : fluidPropertiesDataSet(objInMap->second)) {
+    IdfObject clone = fluidObject.clone();
+    if(clone.iddObject().type().value() == openstudio::IddObjectType::FluidProperties_Name) {
+      idfObject = clone;
+      m_fluidPropertiesNames.insert(std::make_pair(boost::to_lower_copy(clone.getString(FluidProperties_NameFields::FluidName,true).get()), clone));
     }
+    m_idfObjects.push_back(clone);
   }
 
   return idfObject;
@@ -37,6 +37,7 @@
 #include "../utilities/idf/Workspace.hpp"
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/StringStreamLogSink.hpp"
+#include "../utilities/core/Path.hpp"
 #include "../utilities/time/Time.hpp"
 
 namespace openstudio {
@@ -474,6 +475,19 @@ class ENERGYPLUS_API ForwardTranslator {
    */
   Workspace translateModelObject( model::ModelObject & modelObject );
 
+  /** Translates the given Model and prints the EnergyPlus objects to os, without building the
+   *  intermediate Workspace that translateModel returns. The objects are written by an IdfWriter,
+   *  so the text is what translateModel(model).toIdfFile().print(os) gives, in the same order and
+   *  with the same fast naming. Returns false if os is not good after writing.
+   */
+  bool translateModelToIdf( const model::Model & model, std::ostream& os, ProgressBar* progressBar=nullptr );
+
+  /** Translates the given Model and saves the EnergyPlus objects to p without building an
+   *  intermediate Workspace, see translateModelToIdf above. Returns false if the file could not be
+   *  written, or if p exists and overwrite is false.
+   */
+  bool translateModelToIdf( const model::Model & model, const openstudio::path& p, bool overwrite=false, ProgressBar* progressBar=nullptr );
+
   /** Get warning messages generated by the last translation.
    */
   std::vector<LogMessage> warnings() const;
@@ -510,12 +524,18 @@ class ENERGYPLUS_API ForwardTranslator {
    *  Use this at your own risks */
   void setExcludeVariableDictionary(bool excludeVariableDictionary);
 
+  /** If parallelTranslation, objects that translate independently of the rest of the model (curves,
+   *  materials, window materials and output variables) are translated on several threads before the
+   *  serial translation, which then uses those results in place. The translated objects are the same
+   *  and in the same order either way. Defaults to true. */
+  void setParallelTranslation(bool parallelTranslation);
+
  private:
 
   REGISTER_LOGGER("openstudio.energyplus.ForwardTranslator");
 
-  /** Translates the given Model to a workspace.  If fullModelTranslation is true
-   *  various "front matter" objects (such as global geometry rules and others) are added to the workspace so that it is fully
+  /** Translates the given Model into m_idfObjects.  If fullModelTranslation is true
+   *  various "front matter" objects (such as global geometry rules and others) are added so that the objects are fully
    *  prepared for simulation.
    *
    *  The method translateModelPrivate() carries out its work by explicitly translating the highest level objects in
@@ -529,7 +549,29 @@ class ENERGYPLUS_API ForwardTranslator {
    *  concern of translating a model object twice, provided that model objects are always translated using the
    *  translateAndMapModelObject() interface as opposed to the type specific translators.
    */
-  Workspace translateModelPrivate( model::Model& model, bool fullModelTranslation );
+  void translateModelPrivate( model::Model& model, bool fullModelTranslation );
+
+  /** Translates a clone of the given Model into m_idfObjects, reporting progress to progressBar.
+   */
+  void translateModelClone( const model::Model& model, ProgressBar* progressBar );
+
+  /** Adds m_idfObjects to a new Workspace with fast naming.
+   */
+  Workspace createWorkspace();
+
+  /** Translates the objects of independentIddObjectTypes() in model on several threads, each with its own
+   *  ForwardTranslator, and stores the results in m_stagedTranslations for translateAndMapModelObject.
+   *  Does nothing if there are too few objects to be worth splitting.
+   */
+  void stageIndependentTranslations( model::Model& model );
+
+  /** Types whose translators only read the object being translated and only add to m_idfObjects.
+   */
+  static const std::vector<IddObjectType>& independentIddObjectTypes();
+
+  /** Messages in m_logSink with the staged messages merged in where their objects were translated.
+   */
+  std::vector<LogMessage> logMessages() const;
 
   boost::optional<IdfObject> translateAndMapModelObject( model::ModelObject & modelObject );
 
@@ -1406,13 +1448,24 @@ class ENERGYPLUS_API ForwardTranslator {
   static std::vector<IddObjectType> iddObjectsToTranslate();
   static std::vector<IddObjectType> iddObjectsToTranslateInitializer();
 
+  /** Position of each IddObjectType in iddObjectsToTranslate(), indexed by IddObjectType::value().
+   *  Types that are not translated are ranked std::numeric_limits<unsigned>::max(), or are past the end. */
+  static const std::vector<unsigned>& iddObjectTypeRanks();
+  static std::vector<unsigned> iddObjectTypeRanksInitializer();
+
   /** Determines whether or not the HVACComponent is part of a unitary system or on an
    *  AirLoopHVAC */
   bool isHVACComponentWithinUnitary(const model::HVACComponent& hvacComponent) const;
 
   /** Looks up in embedded_files to locate the path to IdfFile that is supplied, and returns the
    *  IdfFile if successful. */
-  boost::optional<IdfFile> findIdfFile(const std::string& path);
+  static boost::optional<IdfFile> findIdfFile(const std::string& path);
+
+  /** Returns the objects of the fluid properties data set at path in embedded_files. Each data set
+   *  is parsed once per process and shared by all translators, so the returned objects must not be
+   *  modified; clone them before adding them to m_idfObjects. Returns an empty vector if the data set
+   *  cannot be loaded. */
+  static const std::vector<IdfObject>& fluidPropertiesDataSet(const std::string& path);
 
   /** Create a simple Schedule:Compact based on input vectors. The function will consume the vectors in
    *  order, so the times must be in chronological order otherwise E+ will output an error. Summer and
@@ -1452,8 +1505,24 @@ class ENERGYPLUS_API ForwardTranslator {
 
   FluidPropertiesMap m_fluidPropertiesMap;
 
+  // FluidProperties:Name objects already in m_idfObjects, by lower case fluid name
+  std::map<std::string, IdfObject> m_fluidPropertiesNames;
+
   ModelObjectMap m_map;
 
+  // result of translating one model object ahead of the serial translation
+  struct StagedTranslation {
+    std::vector<IdfObject> idfObjects;
+    boost::optional<IdfObject> result;
+    std::vector<LogMessage> logMessages;
+  };
+
+  std::map<openstudio::Handle, StagedTranslation> m_stagedTranslations;
+
+  // warnings and errors logged by the staged translations, with the length of the m_logSink text
+  // when their object was reached by the serial translation
+  std::vector<std::pair<std::size_t, LogMessage> > m_stagedLogMessages;
+
   std::vector<IdfObject> m_idfObjects;
 
   boost::optional<IdfObject> m_anyNumberScheduleTypeLimits;
@@ -1471,6 +1540,8 @@ class ENERGYPLUS_API ForwardTranslator {
   bool m_excludeSQliteOutputReport; // exclude Output:Sqlite
   bool m_excludeHTMLOutputReport;   // exclude Output:Table:SummaryReports
   bool m_excludeVariableDictionary; // exclude Output:VariableDictionary
+
+  bool m_parallelTranslation;
 };
 
 namespace detail
@@ -1480,6 +1551,7 @@ namespace detail
     static void initialize()
     {
       ForwardTranslator::iddObjectsToTranslate();
+      ForwardTranslator::iddObjectTypeRanks();
     }
   };
 
@@ -32,6 +32,7 @@
 
 #include "../ErrorFile.hpp"
 
+#include "../../utilities/core/Filesystem.hpp"
 #include "../../utilities/core/Logger.hpp"
 
 #include <resources.hxx>
@@ -115,4 +116,80 @@ TEST_F(EnergyPlusFixture,ErrorFile_WarningsAndCrash)
   EXPECT_FALSE(errorFile.completedSuccessfully());
 }
 
+TEST_F(EnergyPlusFixture,ErrorFile_AggregateWarnings)
+{
+  openstudio::path path = resourcesPath() / openstudio::toPath("energyplus/ErrorFiles/WarningsAndSevere.err");
+
+  // the preprocessor warnings share a first line but name different windows, so none of them are repeats
+  ErrorFile errorFile(path);
+  ASSERT_EQ(static_cast<unsigned>(46), errorFile.warnings().size());
+  ASSERT_EQ(static_cast<unsigned>(46), errorFile.warningKeys().size());
+  EXPECT_EQ(errorFile.warnings()[0], errorFile.warningKeys()[0]);
+  EXPECT_EQ(std::vector<unsigned>(46, 1u), errorFile.warningCounts());
+
+  ErrorFile aggregated(path, true);
+  EXPECT_EQ(errorFile.warnings(), aggregated.warnings());
+  EXPECT_EQ(errorFile.warningKeys(), aggregated.warningKeys());
+  EXPECT_EQ(errorFile.warningCounts(), aggregated.warningCounts());
+  EXPECT_EQ(static_cast<unsigned>(8), aggregated.severeErrors().size());
+  EXPECT_EQ(static_cast<unsigned>(1), aggregated.fatalErrors().size());
+  EXPECT_TRUE(aggregated.completed());
+  EXPECT_FALSE(aggregated.completedSuccessfully());
+
+  // the max iterations warning recurs at 13 different times, coil warnings with the same text but another coil do not repeat
+  path = resourcesPath() / openstudio::toPath("energyplus/ErrorFiles/RepeatingWarnings.err");
+
+  ErrorFile repeating(path);
+  EXPECT_EQ(static_cast<unsigned>(52), repeating.warnings().size());
+  ASSERT_EQ(static_cast<unsigned>(40), repeating.warningKeys().size());
+
+  ErrorFile repeatingAggregated(path, true);
+  EXPECT_EQ(static_cast<unsigned>(40), repeatingAggregated.warnings().size());
+  EXPECT_EQ(repeating.warningKeys(), repeatingAggregated.warningKeys());
+  EXPECT_EQ(repeating.warningCounts(), repeatingAggregated.warningCounts());
+  EXPECT_EQ(static_cast<unsigned>(0), repeatingAggregated.severeErrors().size());
+  EXPECT_TRUE(repeatingAggregated.completed());
+  EXPECT_TRUE(repeatingAggregated.completedSuccessfully());
+
+  unsigned numRepeated = 0;
+  for (unsigned i = 0; i < repeating.warningKeys().size(); ++i) {
+    if (repeating.warningCounts()[i] > 1u) {
+      ++numRepeated;
+      EXPECT_EQ(static_cast<unsigned>(13), repeating.warningCounts()[i]);
+      EXPECT_EQ(0u, repeating.warningKeys()[i].find("SimHVAC: Maximum iterations (#) exceeded for all HVAC loops, at RUN PERIOD 1, #/# #:# - #:#\n"))
+        << repeating.warningKeys()[i];
+    }
+  }
+  EXPECT_EQ(1u, numRepeated);
+  EXPECT_NE(std::string::npos, repeating.warningKeys()[1].find("\"Ground Temperatures\" were input.\n Found first in surface=SURFACE 21\n"));
+}
 
+TEST_F(EnergyPlusFixture,ErrorFile_AggregateWarnings_UnquotedNames)
+{
+  // EnergyPlus writes object names unquoted, the numbers in them name different objects and must not be merged
+  openstudio::path path = openstudio::tempDir() / openstudio::toPath("ErrorFile_AggregateWarnings_UnquotedNames.err");
+  {
+    std::ofstream ofs(openstudio::toString(path));
+    ofs << "Program Version,EnergyPlus, Version 9.4.0\n";
+    ofs << "   ** Warning ** Surface=SURFACE 21 in Zone=ZONE 1 has a tilt of 90.0 degrees\n";
+    ofs << "   **   ~~~   ** at RUN PERIOD 1, 01/21 06:00 - 06:15\n";
+    ofs << "   ** Warning ** Surface=SURFACE 22 in Zone=ZONE 1 has a tilt of 90.0 degrees\n";
+    ofs << "   **   ~~~   ** at RUN PERIOD 1, 01/21 06:00 - 06:15\n";
+    ofs << "   ** Warning ** Surface=SURFACE 21 in Zone=ZONE 1 has a tilt of 89.5 degrees\n";
+    ofs << "   **   ~~~   ** at RUN PERIOD 1, 07/04 12:00 - 12:15\n";
+    ofs << "   ************* EnergyPlus Warmup Error Summary. During Warmup: 0 Warning; 0 Severe Errors.\n";
+    ofs << "   ************* EnergyPlus Completed Successfully-- 3 Warning; 0 Severe Errors; Elapsed Time=00hr 00min  1.00sec\n";
+  }
+
+  ErrorFile errorFile(path, true);
+  openstudio::filesystem::remove(path);
+
+  ASSERT_EQ(static_cast<unsigned>(2), errorFile.warningKeys().size());
+  EXPECT_EQ(static_cast<unsigned>(2), errorFile.warnings().size());
+  EXPECT_EQ(std::vector<unsigned>({2u, 1u}), errorFile.warningCounts());
+  EXPECT_EQ(0u, errorFile.warningKeys()[0].find("Surface=SURFACE 21 in Zone=ZONE 1 has a tilt of # degrees\n at RUN PERIOD 1, #/# #:# - #:#"))
+    << errorFile.warningKeys()[0];
+  EXPECT_EQ(0u, errorFile.warningKeys()[1].find("Surface=SURFACE 22 in Zone=ZONE 1 has a tilt of # degrees\n"))
+    << errorFile.warningKeys()[1];
+  EXPECT_TRUE(errorFile.completedSuccessfully());
+}
@@ -52,7 +52,9 @@
 #include "../../model/Building.hpp"
 #include "../../model/ThermalZone.hpp"
 #include "../../model/Space.hpp"
+#include "../../model/SpaceType.hpp"
 #include "../../model/Lights.hpp"
+#include "../../model/LightsDefinition.hpp"
 #include "../../model/AirLoopHVAC.hpp"
 #include "../../model/Schedule.hpp"
 #include "../../model/ScheduleCompact.hpp"
@@ -63,9 +65,12 @@
 #include "../../model/CoilCoolingDXSingleSpeed.hpp"
 #include "../../model/CoilCoolingDXSingleSpeed_Impl.hpp"
 #include "../../model/StandardOpaqueMaterial.hpp"
+#include "../../model/StandardGlazing.hpp"
+#include "../../model/DesignDay.hpp"
 #include "../../model/Construction.hpp"
 #include "../../model/OutputVariable.hpp"
 #include "../../model/OutputVariable_Impl.hpp"
+#include "../../model/RefrigerationSystem.hpp"
 #include "../../model/Version.hpp"
 #include "../../model/Version_Impl.hpp"
 #include "../../model/ZoneCapacitanceMultiplierResearchSpecial.hpp"
@@ -80,14 +85,18 @@
 #include "../../utilities/idf/IdfObject.hpp"
 #include <utilities/idd/Lights_FieldEnums.hxx>
 #include <utilities/idd/OS_Schedule_Compact_FieldEnums.hxx>
+#include <utilities/idd/OS_WindowMaterial_Glazing_FieldEnums.hxx>
 #include <utilities/idd/Schedule_Compact_FieldEnums.hxx>
 #include <utilities/idd/ZoneCapacitanceMultiplier_ResearchSpecial_FieldEnums.hxx>
 #include <utilities/idd/Output_Variable_FieldEnums.hxx>
+#include <utilities/idd/FluidProperties_Name_FieldEnums.hxx>
 #include <utilities/idd/IddEnums.hxx>
 #include <utilities/idd/IddFactory.hxx>
 
 #include <boost/algorithm/string/predicate.hpp>
+#include <boost/regex.hpp>
 
+#include <chrono>
 #include <future>
 
 #include <resources.hxx>
@@ -146,6 +155,208 @@ TEST_F(EnergyPlusFixture,ForwardTranslator_ExampleModel) {
   // workspace.save(toPath("./example.idf"), true);
 }
 
+TEST_F(EnergyPlusFixture,ForwardTranslator_TranslateModelToIdf) {
+  Model model = exampleModel();
+  ForwardTranslator forwardTranslator;
+
+  auto start = std::chrono::steady_clock::now();
+  Workspace workspace = forwardTranslator.translateModel(model);
+  std::stringstream workspaceText;
+  workspace.toIdfFile().print(workspaceText);
+  auto end = std::chrono::steady_clock::now();
+  RecordProperty("WorkspaceTimeMs", std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()));
+
+  start = std::chrono::steady_clock::now();
+  std::stringstream idfText;
+  EXPECT_TRUE(forwardTranslator.translateModelToIdf(model, idfText));
+  end = std::chrono::steady_clock::now();
+  RecordProperty("TranslateModelToIdfTimeMs", std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()));
+  EXPECT_EQ(0u, forwardTranslator.errors().size());
+
+  // objects named by fast naming get a new UUID each time
+  EXPECT_EQ(boost::regex_replace(workspaceText.str(), uuidInString(), "UUID"),
+            boost::regex_replace(idfText.str(), uuidInString(), "UUID"));
+
+  openstudio::path p = toPath("./TranslateModelToIdf.idf");
+  EXPECT_TRUE(forwardTranslator.translateModelToIdf(model, p, true));
+  boost::optional<IdfFile> idfFile = IdfFile::load(p, IddFileType::EnergyPlus);
+  ASSERT_TRUE(idfFile);
+  EXPECT_EQ(workspace.objects().size(), idfFile->objects().size());
+  EXPECT_FALSE(forwardTranslator.translateModelToIdf(model, p));
+}
+
+TEST_F(EnergyPlusFixture,ForwardTranslator_TranslateModelToIdf_NameConflict) {
+  // the zone and the zone list for the space type only differ by case, and are both
+  // ZoneAndZoneListNames in EnergyPlus
+  Model model;
+  ThermalZone thermalZone(model);
+  thermalZone.setName("Office");
+  SpaceType spaceType(model);
+  spaceType.setName("OFFICE");
+  Space space(model);
+  space.setThermalZone(thermalZone);
+  space.setSpaceType(spaceType);
+  LightsDefinition definition(model);
+  Lights lights(definition);
+  lights.setSpaceType(spaceType);
+
+  ForwardTranslator forwardTranslator;
+  Workspace workspace = forwardTranslator.translateModel(model);
+  std::stringstream workspaceText;
+  workspace.toIdfFile().print(workspaceText);
+
+  std::stringstream idfText;
+  EXPECT_TRUE(forwardTranslator.translateModelToIdf(model, idfText));
+
+  // the same object is renamed and the lights point at the same object
+  EXPECT_EQ(boost::regex_replace(workspaceText.str(), uuidInString(), "UUID"),
+            boost::regex_replace(idfText.str(), uuidInString(), "UUID"));
+
+  OptionalIdfFile idfFile = IdfFile::load(idfText, IddFileType::EnergyPlus);
+  ASSERT_TRUE(idfFile);
+  std::vector<IdfObject> zones = idfFile->getObjectsByType(IddObjectType::Zone);
+  std::vector<IdfObject> zoneLists = idfFile->getObjectsByType(IddObjectType::ZoneList);
+  ASSERT_EQ(1u, zones.size());
+  ASSERT_EQ(1u, zoneLists.size());
+  EXPECT_NE(boost::algorithm::iequals(zones[0].name().get(), "Office"),
+            boost::algorithm::iequals(zoneLists[0].name().get(), "Office"));
+}
+
+
+TEST_F(EnergyPlusFixture,ForwardTranslator_FluidPropertiesDataSet) {
+  Model model;
+  for (unsigned i = 0; i < 20; ++i) {
+    RefrigerationSystem system(model);
+    EXPECT_TRUE(system.setRefrigerationSystemWorkingFluidType((i % 2 == 0) ? "R404a" : "R22"));
+  }
+
+  // the first translation in the process parses the data sets, later ones copy them
+  std::vector<long long> times;
+  std::vector<std::string> texts;
+  for (unsigned i = 0; i < 2; ++i) {
+    ForwardTranslator forwardTranslator;
+    auto start = std::chrono::steady_clock::now();
+    Workspace workspace = forwardTranslator.translateModel(model);
+    auto end = std::chrono::steady_clock::now();
+    times.push_back(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count());
+
+    std::vector<WorkspaceObject> names = workspace.getObjectsByType(IddObjectType::FluidProperties_Name);
+    ASSERT_EQ(2u, names.size());
+    std::stringstream ss;
+    for (const WorkspaceObject& name : names) {
+      ss << name.getString(FluidProperties_NameFields::FluidName).get() << ";";
+    }
+    ss << workspace.getObjectsByType(IddObjectType::FluidProperties_Temperatures).size();
+    texts.push_back(ss.str());
+  }
+  RecordProperty("FirstTranslationTimeMs", std::to_string(times[0]));
+  RecordProperty("SecondTranslationTimeMs", std::to_string(times[1]));
+  EXPECT_EQ(texts[0], texts[1]);
+}
+
+TEST_F(EnergyPlusFixture,ForwardTranslator_ChildSortBenchmark) {
+  Model model;
+  ThermalZone zone(model);
+  Space space(model);
+  ASSERT_TRUE(space.setThermalZone(zone));
+  LightsDefinition definition(model);
+
+  // children of the space, created out of name order
+  unsigned n = 2000;
+  for (unsigned i = 0; i < n; ++i) {
+    Lights lights(definition);
+    std::string index = std::to_string((i * 7919) % n);
+    lights.setName("Lights " + std::string(4 - index.size(), '0') + index);
+    EXPECT_TRUE(lights.setSpace(space));
+  }
+
+  ForwardTranslator forwardTranslator;
+  auto start = std::chrono::steady_clock::now();
+  Workspace workspace = forwardTranslator.translateModel(model);
+  auto end = std::chrono::steady_clock::now();
+  RecordProperty("TranslateModelTimeMs", std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()));
+
+  std::vector<std::string> names;
+  for (const WorkspaceObject& object : workspace.objects(true)) {
+    if (object.iddObject().type() == IddObjectType::Lights) {
+      names.push_back(object.nameString());
+    }
+  }
+  ASSERT_EQ(n, names.size());
+  EXPECT_TRUE(std::is_sorted(names.begin(), names.end()));
+}
+
+TEST_F(EnergyPlusFixture,ForwardTranslator_ParallelTranslation) {
+  Model model;
+  ScheduleCompact schedule(model);
+  Construction construction(model);
+
+  // well over the 128 independent objects needed for stageIndependentTranslations to split them in blocks
+  unsigned n = 500;
+  for (unsigned i = 0; i < n; ++i) {
+    CurveQuadratic curve(model);
+    curve.setCoefficient2x(0.001 * i);
+
+    StandardOpaqueMaterial material(model);
+    material.setThickness(0.01 + 0.0001 * i);
+    if (i % 50 == 0) {
+      EXPECT_TRUE(construction.insertLayer(construction.numLayers(), material));
+    }
+
+    OutputVariable outputVariable("Variable " + std::to_string(i), model);
+    if (i % 2 == 0) {
+      EXPECT_TRUE(outputVariable.setSchedule(schedule));
+    }
+
+    // staged translations that log errors
+    if (i % 25 == 0) {
+      StandardGlazing glazing(model);
+      EXPECT_TRUE(glazing.setString(OS_WindowMaterial_GlazingFields::Thickness, ""));
+    }
+  }
+
+  // a serial translation after the staged ones that logs an error
+  DesignDay designDay(model);
+  EXPECT_TRUE(designDay.setHumidityIndicatingType("Schedule"));
+
+  ForwardTranslator serialTranslator;
+  serialTranslator.setParallelTranslation(false);
+  std::stringstream serial;
+  auto start = std::chrono::steady_clock::now();
+  EXPECT_TRUE(serialTranslator.translateModelToIdf(model, serial));
+  auto end = std::chrono::steady_clock::now();
+  RecordProperty("SerialTimeMs", std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()));
+
+  ForwardTranslator parallelTranslator;
+  std::stringstream parallel;
+  start = std::chrono::steady_clock::now();
+  EXPECT_TRUE(parallelTranslator.translateModelToIdf(model, parallel));
+  end = std::chrono::steady_clock::now();
+  RecordProperty("ParallelTimeMs", std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()));
+
+  EXPECT_EQ(serial.str(), parallel.str());
+
+  // messages from the staged translations are in the order the serial translation logs them
+  auto messages = [](const std::vector<LogMessage>& logMessages) {
+    std::vector<std::string> result;
+    for (const LogMessage& logMessage : logMessages) {
+      result.push_back(logMessage.logMessage());
+    }
+    return result;
+  };
+  EXPECT_EQ(messages(serialTranslator.warnings()), messages(parallelTranslator.warnings()));
+  std::vector<std::string> errors = messages(parallelTranslator.errors());
+  EXPECT_EQ(messages(serialTranslator.errors()), errors);
+  auto isGlazingError = [](const std::string& error) {
+    return boost::algorithm::starts_with(error, "Missing required input 'Thickness'");
+  };
+  EXPECT_EQ(20, std::count_if(errors.begin(), errors.end(), isGlazingError));
+  auto designDayError = std::find_if(errors.begin(), errors.end(), [](const std::string& error) {
+    return boost::algorithm::starts_with(error, "Humidity Condition Day Schedule Name");
+  });
+  ASSERT_NE(errors.end(), designDayError);
+  EXPECT_EQ(errors.end(), std::find_if(designDayError, errors.end(), isGlazingError));
+}
 
 TEST_F(EnergyPlusFixture,ForwardTranslatorTest_TranslateAirLoopHVAC) {
   openstudio::model::Model model;
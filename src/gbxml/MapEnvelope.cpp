@@ -58,7 +58,7 @@
 namespace openstudio {
 namespace gbxml {
 
-  boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateConstruction(const pugi::xml_node& element, const std::unordered_map<std::string, pugi::xml_node> &layerElements, openstudio::model::Model& model)
+  boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateConstruction(const pugi::xml_node& element, openstudio::model::Model& model)
   {
     // Krishnan, this constructor should only be used for unique objects like Building and Site
     //openstudio::model::Construction construction = model.getUniqueModelObject<openstudio::model::Construction>();
@@ -77,9 +77,9 @@ namespace gbxml {
       std::string layerId = layerIdEl.attribute("layerIdRef").value();
 
       // find this layerId in all the layers
-      auto result = layerElements.find(layerId);
-      if (result != layerElements.end()) {
-        for (auto &materialIdElement : result->second.children("MaterialId")) {
+      auto layerElement = elementById(layerId, "Layer");
+      if (layerElement) {
+        for (auto &materialIdElement : layerElement.children("MaterialId")) {
           std::string materialId = materialIdElement.attribute("materialIdRef").value();
           auto materialIt = m_idToObjectMap.find(materialId);
           if (materialIt != m_idToObjectMap.end()) {
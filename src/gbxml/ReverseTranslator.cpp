@@ -75,6 +75,7 @@
 
 #include <pugixml.hpp>
 #include <algorithm>
+#include <cstring>
 #include <locale>
 
 namespace openstudio {
@@ -121,6 +122,7 @@ namespace gbxml {
         if (load_result) {
           result = this->convert(doc.document_element());
         }
+        m_idToElementMap.clear();
         file.close();
 
       }
@@ -168,6 +170,15 @@ namespace gbxml {
     return value;
   }
 
+  pugi::xml_node ReverseTranslator::elementById(const std::string& id, const char* elementName) const
+  {
+    auto it = m_idToElementMap.find(id);
+    if ((it != m_idToElementMap.end()) && (std::strcmp(it->second.name(), elementName) == 0)) {
+      return it->second;
+    }
+    return pugi::xml_node();
+  }
+
   boost::optional<model::Model> ReverseTranslator::convert(const pugi::xml_node& root)
   {
     return translateGBXML(root);
@@ -243,6 +254,16 @@ namespace gbxml {
       m_useSIUnitsForResults = false;
     }
 
+    // index top level elements by id so references (e.g. layerIdRef, dayScheduleIdRef) are found without rescanning the document,
+    // ids should be unique but if not the first element wins as it did when scanning
+    m_idToElementMap.clear();
+    for (auto &child : root.children()) {
+      pugi::xml_attribute idAttribute = child.attribute("id");
+      if (idAttribute) {
+        m_idToElementMap.insert(std::make_pair(std::string(idAttribute.value()), child));
+      }
+    }
+
     // do materials before constructions
     auto materialElements = root.children("Material");
     if (m_progressBar) {
@@ -262,13 +283,6 @@ namespace gbxml {
     }
 
     // do constructions before surfaces
-    std::unordered_map<std::string, pugi::xml_node> layerElements;
-    for (auto &layerEl : root.children("Layer")) {
-      std::string layerId = layerEl.attribute("id").value();
-      // Could maybe use some error checking here for empty IDs
-      layerElements[layerId] = layerEl;
-    }
-
     auto constructionElements = root.children("Construction");
     if (m_progressBar) {
       m_progressBar->setWindowTitle(toString("Translating Constructions"));
@@ -278,7 +292,7 @@ namespace gbxml {
     }
 
     for (auto &constructionElement : constructionElements) {
-      boost::optional<model::ModelObject> construction = translateConstruction(constructionElement, layerElements, model);
+      boost::optional<model::ModelObject> construction = translateConstruction(constructionElement, model);
       OS_ASSERT(construction); // Krishnan, what type of error handling do you want?
 
       if (m_progressBar) {
@@ -314,7 +328,7 @@ namespace gbxml {
     }
 
     for (auto &scheduleElement : scheduleElements) {
-      boost::optional<model::ModelObject> schedule = translateSchedule(scheduleElement, root, model);
+      boost::optional<model::ModelObject> schedule = translateSchedule(scheduleElement, model);
       OS_ASSERT(schedule); // Krishnan, what type of error handling do you want?
 
       if (m_progressBar) {
@@ -40,11 +40,10 @@
 #include "../utilities/core/StringStreamLogSink.hpp"
 
 #include "../utilities/units/Unit.hpp"
-#include <unordered_map>
 
-namespace pugi {
-  class xml_node;
-}
+#include <pugixml.hpp>
+
+#include <unordered_map>
 
 namespace openstudio {
 
@@ -89,6 +88,12 @@ namespace gbxml {
 
     std::map<std::string, openstudio::model::ModelObject> m_idToObjectMap;
 
+    // top level elements of the document indexed by id, built once per translation
+    std::unordered_map<std::string, pugi::xml_node> m_idToElementMap;
+
+    // return the top level element with this id and element name, or an empty node if there is none
+    pugi::xml_node elementById(const std::string& id, const char* elementName) const;
+
     // In ReverseTranslator.cpp
     boost::optional<openstudio::model::Model> convert(const pugi::xml_node& root);
     boost::optional<openstudio::model::Model> translateGBXML(const pugi::xml_node& root);
@@ -103,11 +108,11 @@ namespace gbxml {
 
     // In MapSchedules.cpp
     boost::optional<openstudio::model::ModelObject> translateScheduleDay(const pugi::xml_node& element, openstudio::model::Model& model);
-    boost::optional<openstudio::model::ModelObject> translateScheduleWeek(const pugi::xml_node& element, const pugi::xml_node& root, openstudio::model::Model& model);
-    boost::optional<openstudio::model::ModelObject> translateSchedule(const pugi::xml_node& element, const pugi::xml_node& root, openstudio::model::Model& model);
+    boost::optional<openstudio::model::ModelObject> translateScheduleWeek(const pugi::xml_node& element, openstudio::model::Model& model);
+    boost::optional<openstudio::model::ModelObject> translateSchedule(const pugi::xml_node& element, openstudio::model::Model& model);
 
     // In MapEnvelope.cpp
-    boost::optional<openstudio::model::ModelObject> translateConstruction(const pugi::xml_node& element, const std::unordered_map<std::string, pugi::xml_node> &layerElements, openstudio::model::Model& model);
+    boost::optional<openstudio::model::ModelObject> translateConstruction(const pugi::xml_node& element, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateWindowType(const pugi::xml_node& element, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateMaterial(const pugi::xml_node& element, openstudio::model::Model& model);
 
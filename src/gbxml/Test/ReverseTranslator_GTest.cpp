@@ -56,6 +56,12 @@
 #include "../../model/SubSurface_Impl.hpp"
 #include "../../model/StandardOpaqueMaterial.hpp"
 #include "../../model/StandardOpaqueMaterial_Impl.hpp"
+#include "../../model/Construction.hpp"
+#include "../../model/Construction_Impl.hpp"
+#include "../../model/Material.hpp"
+#include "../../model/Material_Impl.hpp"
+#include "../../model/BuildingStory.hpp"
+#include "../../model/BuildingStory_Impl.hpp"
 
 #include "../../utilities/idf/Workspace.hpp"
 #include "../../utilities/core/Optional.hpp"
@@ -66,6 +72,7 @@
 #include <resources.hxx>
 
 #include <sstream>
+#include <chrono>
 
 using namespace openstudio::energyplus;
 using namespace openstudio::model;
@@ -525,3 +532,85 @@ TEST_F(gbXMLFixture, ReverseTranslator_3951_Surface)
     EXPECT_EQ("storey-1-space-1", _space->nameString());
   }
 }
+
+TEST_F(gbXMLFixture, ReverseTranslator_LargeSynthetic)
+{
+  // a synthetic file with many spaces, surfaces and constructions, every id reference is resolved through the id indices
+  const unsigned numSpaces = 500;
+  const unsigned numConstructions = 50;
+
+  std::stringstream ss;
+  ss << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+  ss << "<gbXML temperatureUnit=\"C\" lengthUnit=\"Meters\" areaUnit=\"SquareMeters\" volumeUnit=\"CubicMeters\" useSIUnitsForResults=\"true\">\n";
+  ss << "<Campus id=\"campus-1\"><Name>Campus</Name>\n";
+  ss << "<Building id=\"building-1\" buildingType=\"Office\"><Name>Building</Name>\n";
+  ss << "<BuildingStorey id=\"storey-1\"><Name>Storey 1</Name><Level>0</Level></BuildingStorey>\n";
+  for (unsigned i = 0; i < numSpaces; ++i) {
+    ss << "<Space id=\"space-" << i << "\" buildingStoreyIdRef=\"storey-1\" zoneIdRef=\"zone-" << i << "\"><Name>Space " << i << "</Name></Space>\n";
+  }
+  ss << "</Building>\n";
+  auto point = [&ss](double x, double y, double z) {
+    ss << "<CartesianPoint><Coordinate>" << x << "</Coordinate><Coordinate>" << y << "</Coordinate><Coordinate>" << z << "</Coordinate></CartesianPoint>";
+  };
+  for (unsigned i = 0; i < numSpaces; ++i) {
+    double x = 10.0 * i;
+    ss << "<Surface id=\"floor-" << i << "\" surfaceType=\"SlabOnGrade\" constructionIdRef=\"construction-" << (i % numConstructions) << "\">";
+    ss << "<Name>Floor " << i << "</Name><AdjacentSpaceId spaceIdRef=\"space-" << i << "\"/><PlanarGeometry><PolyLoop>";
+    point(x, 0, 0); point(x, 10, 0); point(x + 10, 10, 0); point(x + 10, 0, 0);
+    ss << "</PolyLoop></PlanarGeometry></Surface>\n";
+    ss << "<Surface id=\"roof-" << i << "\" surfaceType=\"Roof\" exposedToSun=\"true\" constructionIdRef=\"construction-" << (i % numConstructions) << "\">";
+    ss << "<Name>Roof " << i << "</Name><AdjacentSpaceId spaceIdRef=\"space-" << i << "\"/><PlanarGeometry><PolyLoop>";
+    point(x, 0, 3); point(x + 10, 0, 3); point(x + 10, 10, 3); point(x, 10, 3);
+    ss << "</PolyLoop></PlanarGeometry></Surface>\n";
+  }
+  ss << "</Campus>\n";
+  for (unsigned i = 0; i < numConstructions; ++i) {
+    ss << "<Construction id=\"construction-" << i << "\"><Name>Construction " << i << "</Name><LayerId layerIdRef=\"layer-" << i << "\"/></Construction>\n";
+    ss << "<Layer id=\"layer-" << i << "\"><MaterialId materialIdRef=\"material-" << i << "\"/></Layer>\n";
+    ss << "<Material id=\"material-" << i << "\"><Name>Material " << i << "</Name><R-value unit=\"SquareMeterKPerW\">" << (1.0 + i) << "</R-value></Material>\n";
+  }
+  for (unsigned i = 0; i < numSpaces; ++i) {
+    ss << "<Zone id=\"zone-" << i << "\"><Name>Zone " << i << "</Name></Zone>\n";
+  }
+  ss << "</gbXML>\n";
+
+  openstudio::path inputPath = openstudio::tempDir() / openstudio::toPath("ReverseTranslator_LargeSynthetic.xml");
+  {
+    openstudio::filesystem::ofstream file(inputPath);
+    ASSERT_TRUE(file.is_open());
+    file << ss.str();
+  }
+
+  openstudio::gbxml::ReverseTranslator reverseTranslator;
+  auto start = std::chrono::steady_clock::now();
+  boost::optional<openstudio::model::Model> model = reverseTranslator.loadModel(inputPath);
+  auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+  RecordProperty("TranslationTimeMs", static_cast<int>(elapsed.count()));
+  openstudio::filesystem::remove(inputPath);
+  ASSERT_TRUE(model);
+
+  EXPECT_EQ(numSpaces, model->getConcreteModelObjects<Space>().size());
+  EXPECT_EQ(numSpaces, model->getConcreteModelObjects<ThermalZone>().size());
+  EXPECT_EQ(2 * numSpaces, model->getConcreteModelObjects<Surface>().size());
+  EXPECT_EQ(numConstructions, model->getConcreteModelObjects<Construction>().size());
+
+  for (unsigned i : {0u, numSpaces / 2, numSpaces - 1}) {
+    auto space = model->getModelObjectByName<Space>("Space " + std::to_string(i));
+    ASSERT_TRUE(space);
+    ASSERT_TRUE(space->thermalZone());
+    EXPECT_EQ("Zone " + std::to_string(i), space->thermalZone()->nameString());
+    ASSERT_TRUE(space->buildingStory());
+    EXPECT_EQ("Storey 1", space->buildingStory()->nameString());
+
+    auto roof = model->getModelObjectByName<Surface>("Roof " + std::to_string(i));
+    ASSERT_TRUE(roof);
+    ASSERT_TRUE(roof->space());
+    EXPECT_EQ(space->handle(), roof->space()->handle());
+    ASSERT_TRUE(roof->construction());
+    EXPECT_EQ("Construction " + std::to_string(i % numConstructions), roof->construction()->nameString());
+    auto construction = roof->construction()->optionalCast<Construction>();
+    ASSERT_TRUE(construction);
+    ASSERT_EQ(1u, construction->layers().size());
+    EXPECT_EQ("Material " + std::to_string(i % numConstructions), construction->layers()[0].nameString());
+  }
+}
@@ -0,0 +1,150 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "AggregateCache.hpp"
+#include "Model.hpp"
+#include "Model_Impl.hpp"
+
+#include "../utilities/idf/WorkspaceObject.hpp"
+#include "../utilities/idf/WorkspaceObject_Impl.hpp"
+
+#include <algorithm>
+
+namespace openstudio {
+namespace model {
+namespace detail {
+
+  AggregateWatcher::AggregateWatcher(AggregateCache& cache)
+    : m_cache(cache)
+  {}
+
+  void AggregateWatcher::watch(const WorkspaceObject& object)
+  {
+    std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> impl = object.getImpl<openstudio::detail::WorkspaceObject_Impl>();
+    if (!m_watched.insert(impl.get()).second) {
+      return;
+    }
+    impl->openstudio::detail::IdfObject_Impl::onChange.connect<AggregateWatcher, &AggregateWatcher::change>(this);
+    impl->openstudio::detail::WorkspaceObject_Impl::onRemoveFromWorkspace.connect<AggregateWatcher, &AggregateWatcher::remove>(this);
+  }
+
+  void AggregateWatcher::watchSources(const WorkspaceObject& object)
+  {
+    std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> impl = object.getImpl<openstudio::detail::WorkspaceObject_Impl>();
+    if (!m_watchedSources.insert(impl.get()).second) {
+      return;
+    }
+    impl->openstudio::detail::WorkspaceObject_Impl::onSourcesChange.connect<AggregateWatcher, &AggregateWatcher::change>(this);
+  }
+
+  void AggregateWatcher::watch(AggregateCache& cache)
+  {
+    if (!m_watchedCaches.insert(&cache).second) {
+      return;
+    }
+    cache.watchInputs();
+    cache.onInvalidate.connect<AggregateWatcher, &AggregateWatcher::change>(this);
+  }
+
+  void AggregateWatcher::watchAdded(const Model& model, IddObjectType type)
+  {
+    if (std::find(m_addedTypes.begin(), m_addedTypes.end(), type) != m_addedTypes.end()) {
+      return;
+    }
+    if (m_addedTypes.empty()) {
+      model.getImpl<Model_Impl>()->addWorkspaceObject.connect<AggregateWatcher, &AggregateWatcher::add>(this);
+    }
+    m_addedTypes.push_back(type);
+  }
+
+  void AggregateWatcher::change()
+  {
+    m_cache.invalidate();
+  }
+
+  void AggregateWatcher::remove(const Handle& /*handle*/)
+  {
+    m_cache.invalidate();
+  }
+
+  void AggregateWatcher::add(const WorkspaceObject& /*object*/, const IddObjectType& type, const UUID& /*uuid*/)
+  {
+    if (std::find(m_addedTypes.begin(), m_addedTypes.end(), type) != m_addedTypes.end()) {
+      m_cache.invalidate();
+    }
+  }
+
+  AggregateCache::AggregateCache(std::size_t size, std::function<void(AggregateWatcher&)> watch)
+    : m_watch(std::move(watch)),
+      m_revision(0),
+      m_entries(size)
+  {}
+
+  AggregateCache::~AggregateCache() = default;
+
+  void AggregateCache::watchInputs()
+  {
+    unsigned long long revision;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      revision = m_revision;
+    }
+    watch(revision);
+  }
+
+  void AggregateCache::invalidate()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      ++m_revision;
+    }
+    onInvalidate.nano_emit();
+  }
+
+  void AggregateCache::watch(unsigned long long revision)
+  {
+    // watchers of different caches connect to the signals of shared objects, e.g. a space type,
+    // so connections are made by one cache at a time; a zone's cache watches its spaces' caches
+    static std::recursive_mutex watchMutex;
+    std::lock_guard<std::recursive_mutex> lock(watchMutex);
+
+    if (m_watchedRevision && (*m_watchedRevision == revision)) {
+      return;
+    }
+
+    // the previous watcher disconnects from everything when it is replaced
+    std::unique_ptr<AggregateWatcher> watcher(new AggregateWatcher(*this));
+    m_watch(*watcher);
+    m_watcher = std::move(watcher);
+    m_watchedRevision = revision;
+  }
+
+} // detail
+} // model
+} // openstudio
@@ -0,0 +1,172 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef MODEL_AGGREGATECACHE_HPP
+#define MODEL_AGGREGATECACHE_HPP
+
+#include "ModelAPI.hpp"
+
+#include "../utilities/idf/Handle.hpp"
+#include "../utilities/idd/IddEnums.hpp"
+
+#include "../nano/nano_signal_slot.hpp"
+
+#include <boost/optional.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+namespace openstudio {
+
+class WorkspaceObject;
+
+namespace model {
+
+class Model;
+
+namespace detail {
+
+  class AggregateCache;
+
+  /** Connects the change signals of the objects that cached aggregates are computed from to
+   *  AggregateCache::invalidate. A new watcher is made each time the objects may have changed, and
+   *  destroying the previous one disconnects everything it was connected to. */
+  class MODEL_API AggregateWatcher : public Nano::Observer {
+   public:
+
+    explicit AggregateWatcher(AggregateCache& cache);
+
+    /// invalidate when object's fields change or it is removed
+    void watch(const WorkspaceObject& object);
+
+    /// invalidate when another object starts or stops pointing to object, e.g. a surface is added to a space
+    void watchSources(const WorkspaceObject& object);
+
+    /// invalidate when cache is invalidated, e.g. that of a space for its thermal zone, cache watches its own inputs first
+    void watch(AggregateCache& cache);
+
+    /// invalidate when an object of type is added to model
+    void watchAdded(const Model& model, IddObjectType type);
+
+   private:
+
+    void change();
+
+    void remove(const Handle& handle);
+
+    void add(const WorkspaceObject& object, const IddObjectType& type, const UUID& uuid);
+
+    AggregateCache& m_cache;
+
+    // each signal is connected once however many times an object is watched
+    std::unordered_set<const void*> m_watched;
+    std::unordered_set<const void*> m_watchedSources;
+    std::unordered_set<const void*> m_watchedCaches;
+
+    std::vector<IddObjectType> m_addedTypes;
+  };
+
+  /** Caches values that are summed over other objects in the Model, e.g. the floor area of a Space.
+   *  When a value is computed, watch is called to connect the change signals of every object the
+   *  values are computed from (see AggregateWatcher). Any of those signals invalidates all values, so
+   *  a lookup only compares two counters and cached results are always identical to recomputed ones.
+   *  Changes elsewhere in the model leave the cached values alone.
+   *
+   *  Lookups and stores are guarded by a mutex so that const getters may be called from several
+   *  threads at once, as long as the model is not modified at the same time. compute() is called
+   *  without holding the lock and may itself use the cache, e.g. lighting power uses floor area. */
+  class MODEL_API AggregateCache {
+   public:
+
+    AggregateCache(std::size_t size, std::function<void(AggregateWatcher&)> watch);
+
+    AggregateCache(const AggregateCache&) = delete;
+    AggregateCache& operator=(const AggregateCache&) = delete;
+
+    ~AggregateCache();
+
+    /** Returns the value stored at index if nothing it depends on has changed since it was stored,
+     *  otherwise returns and stores the result of compute(). */
+    template <typename Func>
+    double get(std::size_t index, Func compute) {
+      unsigned long long revision;
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const Entry& entry = m_entries[index];
+        if (entry.value && (entry.revision == m_revision)) {
+          return *entry.value;
+        }
+        revision = m_revision;
+      }
+      watch(revision);
+      double value = compute();
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_entries[index].revision = revision;
+      m_entries[index].value = value;
+      return value;
+    }
+
+    /// connects the change signals of the objects the values are computed from, unless already done since the last invalidate
+    void watchInputs();
+
+    /// marks all values stale, connected to the change signals of the objects they are computed from
+    void invalidate();
+
+    /// emitted by invalidate
+    Nano::Signal<void()> onInvalidate;
+
+   private:
+
+    // reconnects the change signals unless that was already done at revision
+    void watch(unsigned long long revision);
+
+    struct Entry {
+      unsigned long long revision = 0;
+      boost::optional<double> value;
+    };
+
+    std::function<void(AggregateWatcher&)> m_watch;
+
+    std::mutex m_mutex;
+    unsigned long long m_revision;
+    std::vector<Entry> m_entries;
+
+    boost::optional<unsigned long long> m_watchedRevision;
+    std::unique_ptr<AggregateWatcher> m_watcher;
+  };
+
+} // detail
+} // model
+} // openstudio
+
+#endif // MODEL_AGGREGATECACHE_HPP
@@ -704,16 +704,31 @@ namespace detail {
     return result;
   }
 
-  double Building_Impl::floorArea() const
+  void Building_Impl::watchAggregateInputs(AggregateWatcher& watcher) const
   {
-    double result = 0;
-    for (const Space& space : spaces()){
-      bool partofTotalFloorArea = space.partofTotalFloorArea();
-      if (partofTotalFloorArea) {
-        result += space.multiplier() * space.floorArea();
+    // every space in the model belongs to the building, weighted by its thermal zone's multiplier
+    watcher.watchAdded(model(), Space::iddObjectType());
+    for (const Space& space : spaces()) {
+      watcher.watch(space);
+      space.getImpl<Space_Impl>()->watchAggregates(watcher);
+      if (boost::optional<ThermalZone> thermalZone = space.thermalZone()) {
+        watcher.watch(*thermalZone);
       }
     }
-    return result;
+  }
+
+  double Building_Impl::floorArea() const
+  {
+    return m_aggregateCache.get(CachedFloorArea, [this]() {
+      double result = 0;
+      for (const Space& space : spaces()){
+        bool partofTotalFloorArea = space.partofTotalFloorArea();
+        if (partofTotalFloorArea) {
+          result += space.multiplier() * space.floorArea();
+        }
+      }
+      return result;
+    });
   }
 
   boost::optional<double> Building_Impl::conditionedFloorArea() const
@@ -744,41 +759,69 @@ namespace detail {
   }
 
   double Building_Impl::exteriorSurfaceArea() const {
-    double result(0.0);
-    for (const Surface& surface : model().getConcreteModelObjects<Surface>()) {
-      OptionalSpace space = surface.space();
-      std::string outsideBoundaryCondition = surface.outsideBoundaryCondition();
-      if (space && openstudio::istringEqual(outsideBoundaryCondition, "Outdoors")) {
-        result += surface.grossArea() * space->multiplier();
+    return m_aggregateCache.get(CachedExteriorSurfaceArea, [this]() {
+      double result(0.0);
+      for (const Surface& surface : model().getConcreteModelObjects<Surface>()) {
+        OptionalSpace space = surface.space();
+        std::string outsideBoundaryCondition = surface.outsideBoundaryCondition();
+        if (space && openstudio::istringEqual(outsideBoundaryCondition, "Outdoors")) {
+          result += surface.grossArea() * space->multiplier();
+        }
       }
-    }
-    return result;
+      return result;
+    });
   }
 
   double Building_Impl::exteriorWallArea() const {
-    double result(0.0);
-    for (const Surface& exteriorWall : exteriorWalls()) {
-      if (OptionalSpace space = exteriorWall.space()) {
-        result += exteriorWall.grossArea() * space->multiplier();
+    return m_aggregateCache.get(CachedExteriorWallArea, [this]() {
+      double result(0.0);
+      for (const Surface& exteriorWall : exteriorWalls()) {
+        if (OptionalSpace space = exteriorWall.space()) {
+          result += exteriorWall.grossArea() * space->multiplier();
+        }
       }
-    }
-    return result;
+      return result;
+    });
+  }
+
+  double Building_Impl::exteriorRoofArea() const {
+    return m_aggregateCache.get(CachedExteriorRoofArea, [this]() {
+      double result(0.0);
+      for (const Space& space : spaces()) {
+        result += space.exteriorRoofArea() * space.multiplier();
+      }
+      return result;
+    });
+  }
+
+  double Building_Impl::exteriorWindowArea() const {
+    return m_aggregateCache.get(CachedExteriorWindowArea, [this]() {
+      double result(0.0);
+      for (const Space& space : spaces()) {
+        result += space.exteriorWindowArea() * space.multiplier();
+      }
+      return result;
+    });
   }
 
   double Building_Impl::airVolume() const {
-    double result(0.0);
-    for (const Space& space : spaces()) {
-      result += space.volume() * space.multiplier();
-    }
-    return result;
+    return m_aggregateCache.get(CachedAirVolume, [this]() {
+      double result(0.0);
+      for (const Space& space : spaces()) {
+        result += space.volume() * space.multiplier();
+      }
+      return result;
+    });
   }
 
   double Building_Impl::numberOfPeople() const {
-    double result(0.0);
-    for (const Space& space : spaces()) {
-      result += space.numberOfPeople() * space.multiplier();
-    }
-    return result;
+    return m_aggregateCache.get(CachedNumberOfPeople, [this]() {
+      double result(0.0);
+      for (const Space& space : spaces()) {
+        result += space.numberOfPeople() * space.multiplier();
+      }
+      return result;
+    });
   }
 
   double Building_Impl::peoplePerFloorArea() const {
@@ -806,11 +849,13 @@ namespace detail {
   }
 
   double Building_Impl::lightingPower() const {
-    double result(0.0);
-    for (const Space& space : spaces()){
-      result += space.multiplier() * space.lightingPower();
-    }
-    return result;
+    return m_aggregateCache.get(CachedLightingPower, [this]() {
+      double result(0.0);
+      for (const Space& space : spaces()){
+        result += space.multiplier() * space.lightingPower();
+      }
+      return result;
+    });
   }
 
   double Building_Impl::lightingPowerPerFloorArea() const {
@@ -844,11 +889,13 @@ namespace detail {
   }
 
   double Building_Impl::electricEquipmentPower() const {
-    double result(0.0);
-    for (const Space& space : spaces()){
-      result += space.multiplier() * space.electricEquipmentPower();
-    }
-    return result;
+    return m_aggregateCache.get(CachedElectricEquipmentPower, [this]() {
+      double result(0.0);
+      for (const Space& space : spaces()){
+        result += space.multiplier() * space.electricEquipmentPower();
+      }
+      return result;
+    });
   }
 
   double Building_Impl::electricEquipmentPowerPerFloorArea() const {
@@ -882,11 +929,13 @@ namespace detail {
   }
 
   double Building_Impl::gasEquipmentPower() const {
-    double result(0.0);
-    for (const Space& space : spaces()){
-      result += space.multiplier() * space.gasEquipmentPower();
-    }
-    return result;
+    return m_aggregateCache.get(CachedGasEquipmentPower, [this]() {
+      double result(0.0);
+      for (const Space& space : spaces()){
+        result += space.multiplier() * space.gasEquipmentPower();
+      }
+      return result;
+    });
   }
 
   double Building_Impl::gasEquipmentPowerPerFloorArea() const {
@@ -1358,6 +1407,14 @@ double Building::exteriorWallArea() const {
   return getImpl<detail::Building_Impl>()->exteriorWallArea();
 }
 
+double Building::exteriorRoofArea() const {
+  return getImpl<detail::Building_Impl>()->exteriorRoofArea();
+}
+
+double Building::exteriorWindowArea() const {
+  return getImpl<detail::Building_Impl>()->exteriorWindowArea();
+}
+
 double Building::airVolume() const {
   return getImpl<detail::Building_Impl>()->airVolume();
 }
@@ -246,6 +246,14 @@ class MODEL_API Building : public ParentObject {
    *  calculation. */
   double exteriorWallArea() const;
 
+  /** Returns the total exterior roof area (m^2). Includes space multipliers in the
+   *  calculation. */
+  double exteriorRoofArea() const;
+
+  /** Returns the total exterior window area (m^2), see Space::exteriorWindowArea. Includes
+   *  space multipliers in the calculation. */
+  double exteriorWindowArea() const;
+
   // ETH@20140115 - Should take a bool as to whether to include spaces marked as
   // "not in floor area".
   /** Returns the total air volume (m^3) in the building. Includes space multipliers
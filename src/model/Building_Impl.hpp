@@ -31,6 +31,7 @@
 #define MODEL_BUILDING_IMPL_HPP
 
 #include "ParentObject_Impl.hpp"
+#include "AggregateCache.hpp"
 
 
 namespace openstudio {
@@ -196,6 +197,10 @@ namespace detail {
 
     double exteriorWallArea() const;
 
+    double exteriorRoofArea() const;
+
+    double exteriorWindowArea() const;
+
     double airVolume() const;
 
     double numberOfPeople() const;
@@ -240,6 +245,24 @@ namespace detail {
    private:
     REGISTER_LOGGER("openstudio.model.Building");
 
+    // sums over spaces, cached until a space's aggregates or thermal zone change or a space is added
+    enum CachedAggregate {
+      CachedFloorArea,
+      CachedExteriorSurfaceArea,
+      CachedExteriorWallArea,
+      CachedExteriorRoofArea,
+      CachedExteriorWindowArea,
+      CachedAirVolume,
+      CachedNumberOfPeople,
+      CachedLightingPower,
+      CachedElectricEquipmentPower,
+      CachedGasEquipmentPower,
+      NumCachedAggregates
+    };
+    mutable AggregateCache m_aggregateCache{NumCachedAggregates, [this](AggregateWatcher& watcher) { watchAggregateInputs(watcher); }};
+
+    void watchAggregateInputs(AggregateWatcher& watcher) const;
+
     boost::optional<ModelObject> spaceTypeAsModelObject() const;
     boost::optional<ModelObject> defaultConstructionSetAsModelObject() const;
     boost::optional<ModelObject> defaultScheduleSetAsModelObject() const;
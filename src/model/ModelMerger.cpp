@@ -73,10 +73,15 @@
 
 #include <utilities/idd/IddFactory.hxx>
 
+#include <boost/functional/hash.hpp>
+
 #include <thread>
 
+#include <algorithm>
 #include <cmath>
-#include <tuple>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace openstudio
 {
@@ -99,21 +104,67 @@ namespace openstudio
       m_logSink.setThreadId(std::this_thread::get_id());
     }
 
+    namespace {
+
+      // Key describing the geometry of a Space or ShadingSurfaceGroup in building coordinates, rounded to the nearest
+      // millimeter and independent of surface order.  Empty for other objects and for groups without surfaces.
+      std::string geometryFingerprint(const ModelObject& modelObject)
+      {
+        std::vector<std::vector<Point3d> > surfaceVertices;
+        if (boost::optional<Space> space = modelObject.optionalCast<Space>()) {
+          Transformation transformation = space->buildingTransformation();
+          for (const auto& surface : space->surfaces()) {
+            surfaceVertices.push_back(transformation * surface.vertices());
+          }
+        } else if (boost::optional<ShadingSurfaceGroup> group = modelObject.optionalCast<ShadingSurfaceGroup>()) {
+          Transformation transformation = group->buildingTransformation();
+          for (const auto& surface : group->shadingSurfaces()) {
+            surfaceVertices.push_back(transformation * surface.vertices());
+          }
+        }
+
+        std::vector<std::string> surfaceKeys;
+        surfaceKeys.reserve(surfaceVertices.size());
+        for (const auto& vertices : surfaceVertices) {
+          std::string key;
+          for (const Point3d& vertex : vertices) {
+            key += std::to_string(std::llround(vertex.x() * 1000.0)) + ',';
+            key += std::to_string(std::llround(vertex.y() * 1000.0)) + ',';
+            key += std::to_string(std::llround(vertex.z() * 1000.0)) + ';';
+          }
+          surfaceKeys.push_back(key);
+        }
+        std::sort(surfaceKeys.begin(), surfaceKeys.end());
+
+        std::string result;
+        for (const auto& key : surfaceKeys) {
+          result += key;
+          result += '|';
+        }
+        return result;
+      }
+
+    }
+
     std::map<UUID, UUID> ModelMerger::suggestHandleMapping(const Model& currentModel, const Model& newModel) const
     {
       std::map<UUID, UUID> result;
 
-      typedef std::set<UUID> HandleSet;
-      typedef std::map<std::string, UUID> StringHandleMap;
-      typedef std::tuple<HandleSet, StringHandleMap, StringHandleMap> ObjectLookup; // 0 - handle, 1 - CADObjectId, 2 - Name
-      typedef std::map<IddObjectType, ObjectLookup> IddToObjectLookupMap;
+      typedef std::unordered_set<UUID, boost::hash<boost::uuids::uuid> > HandleSet;
+      typedef std::unordered_map<std::string, UUID> StringHandleMap;
 
-      IddToObjectLookupMap currentIddToObjectLookupMap;
       for (const auto& iddObjectType : m_iddObjectTypesToMerge) {
-        ObjectLookup currentLookup;
-        for (const auto& object : currentModel.getObjectsByType(iddObjectType)) {
+
+        // index current objects by handle, CADObjectId and name
+        std::vector<WorkspaceObject> currentObjects = currentModel.getObjectsByType(iddObjectType);
+        HandleSet currentHandles;
+        StringHandleMap currentCADObjectIds;
+        StringHandleMap currentNames;
+        currentHandles.reserve(currentObjects.size());
+        currentNames.reserve(currentObjects.size());
+        for (const auto& object : currentObjects) {
           Handle handle = object.handle();
-          std::get<0>(currentLookup).insert(handle);
+          currentHandles.insert(handle);
 
           ModelObject modelObject = object.cast<ModelObject>();
           if (modelObject.hasAdditionalProperties()) {
@@ -121,21 +172,18 @@ namespace openstudio
             if (additionalProperties.hasFeature("CADObjectId")) {
               boost::optional<std::string> cadObjectId = additionalProperties.getFeatureAsString("CADObjectId");
               if (cadObjectId) {
-                std::get<1>(currentLookup).insert(std::make_pair(*cadObjectId, handle));
+                currentCADObjectIds.insert(std::make_pair(*cadObjectId, handle));
               }
             }
           }
 
-          std::get<2>(currentLookup).insert(std::make_pair(object.nameString(), handle));
+          currentNames.insert(std::make_pair(object.nameString(), handle));
         }
-        currentIddToObjectLookupMap.insert(std::make_pair(iddObjectType, currentLookup));
-      }
 
-      for (const auto& iddObjectType : m_iddObjectTypesToMerge) {
-        ObjectLookup currentLookup = currentIddToObjectLookupMap[iddObjectType];
+        std::vector<WorkspaceObject> unmatchedNewObjects;
         for (const auto& object : newModel.getObjectsByType(iddObjectType)) {
           Handle handle = object.handle();
-          if (std::get<0>(currentLookup).count(handle) > 0) {
+          if (currentHandles.count(handle) > 0) {
             // handle is in both models
             result[handle] = handle;
             continue;
@@ -147,22 +195,58 @@ namespace openstudio
             if (additionalProperties.hasFeature("CADObjectId")) {
               boost::optional<std::string> cadObjectId = additionalProperties.getFeatureAsString("CADObjectId");
               if (cadObjectId) {
-                if (std::get<1>(currentLookup).count(*cadObjectId) > 0) {
+                auto it = currentCADObjectIds.find(*cadObjectId);
+                if (it != currentCADObjectIds.end()) {
                   // cadObjectId is in both models
-                  Handle currentHandle = std::get<1>(currentLookup)[*cadObjectId];
-                  result[currentHandle] = handle;
+                  result[it->second] = handle;
                   continue;
                 }
               }
             }
           }
 
-          if (std::get<2>(currentLookup).count(object.nameString()) > 0) {
+          auto it = currentNames.find(object.nameString());
+          if (it != currentNames.end()) {
             // name is in both models
-            Handle currentHandle = std::get<2>(currentLookup)[object.nameString()];
-            result[currentHandle] = handle;
+            result[it->second] = handle;
+            continue;
+          }
+
+          unmatchedNewObjects.push_back(object);
+        }
+
+        if (unmatchedNewObjects.empty() ||
+            ((iddObjectType != IddObjectType::OS_Space) && (iddObjectType != IddObjectType::OS_ShadingSurfaceGroup))) {
+          continue;
+        }
+
+        // index remaining current objects by geometry, ambiguous geometry is not used for matching
+        StringHandleMap currentGeometries;
+        std::unordered_set<std::string> ambiguousFingerprints;
+        for (const auto& object : currentObjects) {
+          if (result.count(object.handle()) > 0) {
+            continue;
+          }
+          std::string fingerprint = geometryFingerprint(object.cast<ModelObject>());
+          if (fingerprint.empty()) {
             continue;
           }
+          if (!currentGeometries.insert(std::make_pair(fingerprint, object.handle())).second) {
+            ambiguousFingerprints.insert(fingerprint);
+          }
+        }
+        for (const auto& fingerprint : ambiguousFingerprints) {
+          currentGeometries.erase(fingerprint);
+        }
+
+        for (const auto& object : unmatchedNewObjects) {
+          std::string fingerprint = geometryFingerprint(object.cast<ModelObject>());
+          auto it = currentGeometries.find(fingerprint);
+          if (it != currentGeometries.end()) {
+            // same geometry in both models
+            result[it->second] = object.handle();
+            currentGeometries.erase(it);
+          }
         }
       }
 
@@ -886,8 +970,10 @@ namespace openstudio
       m_newModel = newModel;
 
       m_newMergedHandles.clear();
-      m_currentToNewHandleMapping = handleMapping;
+      m_currentToNewHandleMapping.clear();
+      m_currentToNewHandleMapping.insert(handleMapping.begin(), handleMapping.end());
       m_newToCurrentHandleMapping.clear();
+      m_newToCurrentHandleMapping.reserve(handleMapping.size());
       for (const auto& it : handleMapping){
         if (m_newToCurrentHandleMapping.find(it.second) != m_newToCurrentHandleMapping.end()){
           LOG(Error, "Multiple entries in current model refer to handle '" << toString(it.second) << "' in new model");
@@ -36,7 +36,11 @@
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/StringStreamLogSink.hpp"
 
+#include <boost/functional/hash.hpp>
+
 #include <map>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace openstudio
 {
@@ -75,6 +79,7 @@ namespace openstudio
       /// First checks if objects with same handle and type exist
       /// Second checks if objects with same CADObjectId attribute and type exist
       /// Third checks if objects with same name and type
+      /// Finally checks if remaining Spaces and ShadingSurfaceGroups have the same geometry
       std::map<UUID, UUID> suggestHandleMapping(const Model& currentModel, const Model& newModel) const;
 
       /// Get warning messages generated by the last translation.
@@ -104,10 +109,10 @@ namespace openstudio
 
       Model m_currentModel;
       Model m_newModel;
-      std::set<UUID> m_newMergedHandles;
+      std::unordered_set<UUID, boost::hash<boost::uuids::uuid> > m_newMergedHandles;
       std::vector<IddObjectType> m_iddObjectTypesToMerge;
-      std::map<UUID, UUID> m_currentToNewHandleMapping;
-      std::map<UUID, UUID> m_newToCurrentHandleMapping;
+      std::unordered_map<UUID, UUID, boost::hash<boost::uuids::uuid> > m_currentToNewHandleMapping;
+      std::unordered_map<UUID, UUID, boost::hash<boost::uuids::uuid> > m_newToCurrentHandleMapping;
     };
 
   }
@@ -839,6 +839,16 @@ std::vector<SurfacePropertyConvectionCoefficients> PlanarSurface::surfacePropert
   return getImpl<detail::PlanarSurface_Impl>()->surfacePropertyConvectionCoefficients();
 }
 
+PolygonBatch PlanarSurface::polygonBatch(const std::vector<PlanarSurface>& planarSurfaces)
+{
+  PolygonBatch result;
+  result.reserve(planarSurfaces.size(), 4 * planarSurfaces.size());
+  for (const PlanarSurface& planarSurface : planarSurfaces){
+    result.addPolygon(planarSurface.vertices());
+  }
+  return result;
+}
+
 std::vector<PlanarSurface> PlanarSurface::findPlanarSurfaces(const std::vector<PlanarSurface>& planarSurfaces,
                                                              boost::optional<double> minDegreesFromNorth,
                                                              boost::optional<double> maxDegreesFromNorth,
@@ -884,7 +894,9 @@ std::vector<PlanarSurface> PlanarSurface::findPlanarSurfaces(const std::vector<P
   Vector3d up(0.0,0.0,1.0);
   Vector3d north(0.0,1.0,0.0);
 
-  // inputs ok, loop over surfaces
+  // gather vertices in site coordinates
+  PolygonBatch siteVertices;
+  siteVertices.reserve(planarSurfaces.size(), 4 * planarSurfaces.size());
   for (const PlanarSurface& planarSurface : planarSurfaces){
 
     // find the transformation to site coordinates
@@ -902,9 +914,15 @@ std::vector<PlanarSurface> PlanarSurface::findPlanarSurfaces(const std::vector<P
       }
     }
 
-    // vertices and outward normal in site coordinates
-    Point3dVector siteVertices = siteTransformation * planarSurface.vertices();
-    OptionalVector3d siteOutwardNormal = getOutwardNormal(siteVertices);
+    siteVertices.addPolygon(siteTransformation * planarSurface.vertices());
+  }
+
+  // inputs ok, loop over surfaces
+  for (unsigned i = 0; i < planarSurfaces.size(); ++i){
+    const PlanarSurface& planarSurface = planarSurfaces[i];
+
+    // outward normal in site coordinates
+    OptionalVector3d siteOutwardNormal = siteVertices.outwardNormal(i);
 
     if (!siteOutwardNormal){
       LOG(Error, "Could not compute outward normal for planarSurface " << planarSurface);
@@ -33,6 +33,8 @@
 #include "ModelAPI.hpp"
 #include "ParentObject.hpp"
 
+#include "../utilities/geometry/PolygonBatch.hpp"
+
 namespace openstudio {
 
 class Plane;
@@ -132,6 +134,11 @@ class MODEL_API PlanarSurface : public ParentObject {
                                                        boost::optional<double> maxDegreesTilt,
                                                        double tol = 1);
 
+  /** Gathers the vertices of planarSurfaces, in order and in their local coordinates, into a
+   *  PolygonBatch so that their areas, outward normals, tilts and azimuths are computed in a single
+   *  pass. Results are identical to grossArea, outwardNormal, tilt and azimuth. */
+  static PolygonBatch polygonBatch(const std::vector<PlanarSurface>& planarSurfaces);
+
   /** Film resistances from ASHRAE Fundamentals, Chapter 25, Table 1 for non-reflective surfaces.
    *  Units of m^2*K/W. */
   static double filmResistance(const FilmResistanceType& type);
@@ -42,6 +42,7 @@
 #include "ConstructionBase_Impl.hpp"
 #include "DefaultConstructionSet.hpp"
 #include "DefaultConstructionSet_Impl.hpp"
+#include "DefaultSurfaceConstructions.hpp"
 #include "DefaultScheduleSet.hpp"
 #include "DefaultScheduleSet_Impl.hpp"
 #include "Schedule.hpp"
@@ -78,6 +79,8 @@
 #include "LightsDefinition_Impl.hpp"
 #include "Luminaire.hpp"
 #include "Luminaire_Impl.hpp"
+#include "SpaceLoadInstance.hpp"
+#include "SpaceLoadDefinition.hpp"
 #include "LuminaireDefinition.hpp"
 #include "LuminaireDefinition_Impl.hpp"
 #include "ElectricEquipment.hpp"
@@ -912,92 +915,261 @@ namespace detail {
     return result;
   }
 
-  double Space_Impl::floorArea() const
+  void Space_Impl::watchAggregates(AggregateWatcher& watcher) const
   {
-    double result = 0;
+    watcher.watch(m_aggregateCache);
+  }
+
+  void Space_Impl::watchAggregateInputs(AggregateWatcher& watcher) const
+  {
+    Space space = getObject<Space>();
+
+    // the space's fields, e.g. its space type, and the surfaces and loads added to or removed from it
+    watcher.watch(space);
+    watcher.watchSources(space);
+    watchDefaultConstructions(watcher, space);
+
     for (const Surface& surface : this->surfaces()) {
-      if (istringEqual(surface.surfaceType(), "Floor"))
-      {
-        if (surface.isAirWall()){
-          continue;
+      watcher.watch(surface);
+      watcher.watchSources(surface);
+      for (const SubSurface& subSurface : surface.subSurfaces()) {
+        watcher.watch(subSurface);
+      }
+
+      // floor area excludes air walls, their construction may be found through an adjacent surface
+      if (boost::optional<ConstructionBase> construction = surface.construction()) {
+        watcher.watch(*construction);
+      }
+      if (boost::optional<Surface> adjacentSurface = surface.adjacentSurface()) {
+        watcher.watch(*adjacentSurface);
+        if (boost::optional<Space> adjacentSpace = adjacentSurface->space()) {
+          watcher.watch(*adjacentSpace);
+          watchDefaultConstructions(watcher, *adjacentSpace);
         }
-        result += surface.grossArea();
       }
     }
-    return result;
+
+    std::vector<SpaceLoadInstance> loads;
+    for (const People& people : this->people()) {
+      loads.push_back(people);
+    }
+    for (const Lights& lights : this->lights()) {
+      loads.push_back(lights);
+    }
+    for (const ElectricEquipment& equipment : this->electricEquipment()) {
+      loads.push_back(equipment);
+    }
+    for (const GasEquipment& equipment : this->gasEquipment()) {
+      loads.push_back(equipment);
+    }
+    for (const Luminaire& luminaire : this->luminaires()) {
+      watcher.watch(luminaire);
+      watcher.watch(luminaire.luminaireDefinition());
+    }
+    if (OptionalSpaceType spaceType = this->spaceType()) {
+      watcher.watch(*spaceType);
+      watcher.watchSources(*spaceType);
+      for (const People& people : spaceType->people()) {
+        loads.push_back(people);
+      }
+      for (const Lights& lights : spaceType->lights()) {
+        loads.push_back(lights);
+      }
+      for (const ElectricEquipment& equipment : spaceType->electricEquipment()) {
+        loads.push_back(equipment);
+      }
+      for (const GasEquipment& equipment : spaceType->gasEquipment()) {
+        loads.push_back(equipment);
+      }
+      for (const Luminaire& luminaire : spaceType->luminaires()) {
+        watcher.watch(luminaire);
+        watcher.watch(luminaire.luminaireDefinition());
+      }
+    }
+    for (const SpaceLoadInstance& load : loads) {
+      watcher.watch(load);
+      watcher.watch(load.definition());
+    }
   }
 
-  double Space_Impl::exteriorArea() const {
-    double result = 0;
-    for (const Surface& surface : this->surfaces()) {
-      if (istringEqual(surface.outsideBoundaryCondition(), "Outdoors"))
-      {
-        result += surface.grossArea();
+  void Space_Impl::watchDefaultConstructions(AggregateWatcher& watcher, const Space& space)
+  {
+    // same search as getDefaultConstructionWithSearchDistance, the building also supplies the space type when
+    // the space has none, and a building added later may supply both
+    std::vector<DefaultConstructionSet> defaultConstructionSets;
+    if (boost::optional<DefaultConstructionSet> defaultConstructionSet = space.defaultConstructionSet()) {
+      defaultConstructionSets.push_back(*defaultConstructionSet);
+    }
+    if (boost::optional<SpaceType> spaceType = space.spaceType()) {
+      watcher.watch(*spaceType);
+      if (boost::optional<DefaultConstructionSet> defaultConstructionSet = spaceType->defaultConstructionSet()) {
+        defaultConstructionSets.push_back(*defaultConstructionSet);
+      }
+    }
+    if (boost::optional<BuildingStory> buildingStory = space.buildingStory()) {
+      watcher.watch(*buildingStory);
+      if (boost::optional<DefaultConstructionSet> defaultConstructionSet = buildingStory->defaultConstructionSet()) {
+        defaultConstructionSets.push_back(*defaultConstructionSet);
+      }
+    }
+    if (boost::optional<Building> building = space.model().building()) {
+      watcher.watch(*building);
+      if (boost::optional<DefaultConstructionSet> defaultConstructionSet = building->defaultConstructionSet()) {
+        defaultConstructionSets.push_back(*defaultConstructionSet);
+      }
+      if (boost::optional<SpaceType> spaceType = building->spaceType()) {
+        watcher.watch(*spaceType);
+        if (boost::optional<DefaultConstructionSet> defaultConstructionSet = spaceType->defaultConstructionSet()) {
+          defaultConstructionSets.push_back(*defaultConstructionSet);
+        }
+      }
+    } else {
+      watcher.watchAdded(space.model(), Building::iddObjectType());
+    }
+
+    for (const DefaultConstructionSet& defaultConstructionSet : defaultConstructionSets) {
+      watcher.watch(defaultConstructionSet);
+      if (boost::optional<DefaultSurfaceConstructions> constructions = defaultConstructionSet.defaultExteriorSurfaceConstructions()) {
+        watcher.watch(*constructions);
+      }
+      if (boost::optional<DefaultSurfaceConstructions> constructions = defaultConstructionSet.defaultInteriorSurfaceConstructions()) {
+        watcher.watch(*constructions);
+      }
+      if (boost::optional<DefaultSurfaceConstructions> constructions = defaultConstructionSet.defaultGroundContactSurfaceConstructions()) {
+        watcher.watch(*constructions);
       }
     }
-    return result;
   }
 
-  double Space_Impl::exteriorWallArea() const {
-    double result = 0;
-    for (const Surface& surface : this->surfaces()) {
-      if (istringEqual(surface.outsideBoundaryCondition(), "Outdoors"))
-      {
-        if (istringEqual(surface.surfaceType(), "Wall"))
+  double Space_Impl::floorArea() const
+  {
+    return m_aggregateCache.get(CachedFloorArea, [this]() {
+      double result = 0;
+      for (const Surface& surface : this->surfaces()) {
+        if (istringEqual(surface.surfaceType(), "Floor"))
         {
+          if (surface.isAirWall()){
+            continue;
+          }
           result += surface.grossArea();
         }
       }
-    }
-    return result;
+      return result;
+    });
   }
 
-  double Space_Impl::volume() const {
-    double result = 0;
-
-    // TODO: need a better method
-    double roofHeight = 0;
-    int numRoof = 0;
-    double floorHeight = 0;
-    int numFloor = 0;
-    for (const Surface& surface : this->surfaces()) {
-      if (istringEqual(surface.surfaceType(), "Floor")){
-        for (const Point3d& point : surface.vertices()) {
-          floorHeight += point.z();
-          ++numFloor;
+  double Space_Impl::exteriorArea() const {
+    return m_aggregateCache.get(CachedExteriorArea, [this]() {
+      double result = 0;
+      for (const Surface& surface : this->surfaces()) {
+        if (istringEqual(surface.outsideBoundaryCondition(), "Outdoors"))
+        {
+          result += surface.grossArea();
         }
-      }else if (istringEqual(surface.surfaceType(), "RoofCeiling")){
-        for (const Point3d& point : surface.vertices()) {
-          roofHeight += point.z();
-          ++numRoof;
+      }
+      return result;
+    });
+  }
+
+  double Space_Impl::exteriorWallArea() const {
+    return m_aggregateCache.get(CachedExteriorWallArea, [this]() {
+      double result = 0;
+      for (const Surface& surface : this->surfaces()) {
+        if (istringEqual(surface.outsideBoundaryCondition(), "Outdoors"))
+        {
+          if (istringEqual(surface.surfaceType(), "Wall"))
+          {
+            result += surface.grossArea();
+          }
         }
       }
-    }
+      return result;
+    });
+  }
 
-    if ((numRoof > 0) && (numFloor > 0)){
-      roofHeight /= numRoof;
-      floorHeight /= numFloor;
-      result = (roofHeight - floorHeight) * this->floorArea();
-    }
+  double Space_Impl::exteriorRoofArea() const {
+    return m_aggregateCache.get(CachedExteriorRoofArea, [this]() {
+      double result = 0;
+      for (const Surface& surface : this->surfaces()) {
+        if (istringEqual(surface.outsideBoundaryCondition(), "Outdoors"))
+        {
+          if (istringEqual(surface.surfaceType(), "RoofCeiling"))
+          {
+            result += surface.grossArea();
+          }
+        }
+      }
+      return result;
+    });
+  }
 
-    return result;
+  double Space_Impl::exteriorWindowArea() const {
+    // same sub surface types and area as Surface::windowToWallRatio
+    return m_aggregateCache.get(CachedExteriorWindowArea, [this]() {
+      double result = 0;
+      for (const Surface& surface : this->surfaces()) {
+        if (istringEqual(surface.outsideBoundaryCondition(), "Outdoors") && istringEqual(surface.surfaceType(), "Wall"))
+        {
+          for (const SubSurface& subSurface : surface.subSurfaces()) {
+            if (istringEqual(subSurface.subSurfaceType(), "FixedWindow") ||
+                istringEqual(subSurface.subSurfaceType(), "OperableWindow"))
+            {
+              result += subSurface.multiplier() * subSurface.netArea();
+            }
+          }
+        }
+      }
+      return result;
+    });
   }
 
-  double Space_Impl::numberOfPeople() const {
-    double result = 0.0;
-    double area = floorArea();
+  double Space_Impl::volume() const {
+    return m_aggregateCache.get(CachedVolume, [this]() {
+      double result = 0;
+
+      // TODO: need a better method
+      double roofHeight = 0;
+      int numRoof = 0;
+      double floorHeight = 0;
+      int numFloor = 0;
+      for (const Surface& surface : this->surfaces()) {
+        if (istringEqual(surface.surfaceType(), "Floor")){
+          for (const Point3d& point : surface.vertices()) {
+            floorHeight += point.z();
+            ++numFloor;
+          }
+        }else if (istringEqual(surface.surfaceType(), "RoofCeiling")){
+          for (const Point3d& point : surface.vertices()) {
+            roofHeight += point.z();
+            ++numRoof;
+          }
+        }
+      }
 
-    for (const People& person : this->people()) {
-      result += person.getNumberOfPeople(area);
-    }
+      if ((numRoof > 0) && (numFloor > 0)){
+        roofHeight /= numRoof;
+        floorHeight /= numFloor;
+        result = (roofHeight - floorHeight) * this->floorArea();
+      }
 
-    if (OptionalSpaceType st = spaceType()){
-      for (const People& person : st->people()) {
+      return result;
+    });
+  }
+
+  double Space_Impl::numberOfPeople() const {
+    return m_aggregateCache.get(CachedNumberOfPeople, [this]() {
+      double result = 0.0;
+      double area = this->floorArea();
+      for (const People& person : this->people()) {
         result += person.getNumberOfPeople(area);
       }
-    }
-
-    return result;
+      if (OptionalSpaceType st = this->spaceType()){
+        for (const People& person : st->people()) {
+          result += person.getNumberOfPeople(area);
+        }
+      }
+      return result;
+    });
   }
 
   bool Space_Impl::setNumberOfPeople(double numberOfPeople) {
@@ -1205,27 +1377,26 @@ namespace detail {
   }
 
   double Space_Impl::lightingPower() const {
-    double result(0.0);
-    double area = floorArea();
-    double numPeople = numberOfPeople();
-
-    for (const Lights& light : lights()) {
-      result += light.getLightingPower(area,numPeople);
-    }
-    for (const Luminaire& luminaire : luminaires()) {
-      result += luminaire.lightingPower();
-    }
-
-    if (OptionalSpaceType spaceType = this->spaceType()) {
-      for (const Lights& light : spaceType->lights()) {
+    return m_aggregateCache.get(CachedLightingPower, [this]() {
+      double result(0.0);
+      double area = this->floorArea();
+      double numPeople = this->numberOfPeople();
+      for (const Lights& light : this->lights()) {
         result += light.getLightingPower(area,numPeople);
       }
-      for (const Luminaire& luminaire : spaceType->luminaires()) {
+      for (const Luminaire& luminaire : this->luminaires()) {
         result += luminaire.lightingPower();
       }
-    }
-
-    return result;
+      if (OptionalSpaceType spaceType = this->spaceType()) {
+        for (const Lights& light : spaceType->lights()) {
+          result += light.getLightingPower(area,numPeople);
+        }
+        for (const Luminaire& luminaire : spaceType->luminaires()) {
+          result += luminaire.lightingPower();
+        }
+      }
+      return result;
+    });
   }
 
   bool Space_Impl::setLightingPower(double lightingPower) {
@@ -1486,21 +1657,20 @@ namespace detail {
   }
 
   double Space_Impl::electricEquipmentPower() const {
-    double result(0.0);
-    double area = floorArea();
-    double numPeople = numberOfPeople();
-
-    for (const ElectricEquipment& equipment : electricEquipment()) {
-      result += equipment.getDesignLevel(area,numPeople);
-    }
-
-    if (OptionalSpaceType spaceType = this->spaceType()) {
-      for (const ElectricEquipment& equipment : spaceType->electricEquipment()) {
+    return m_aggregateCache.get(CachedElectricEquipmentPower, [this]() {
+      double result(0.0);
+      double area = this->floorArea();
+      double numPeople = this->numberOfPeople();
+      for (const ElectricEquipment& equipment : this->electricEquipment()) {
         result += equipment.getDesignLevel(area,numPeople);
       }
-    }
-
-    return result;
+      if (OptionalSpaceType spaceType = this->spaceType()) {
+        for (const ElectricEquipment& equipment : spaceType->electricEquipment()) {
+          result += equipment.getDesignLevel(area,numPeople);
+        }
+      }
+      return result;
+    });
   }
 
   double Space_Impl::electricEquipmentITEAirCooledPower() const {
@@ -1765,21 +1935,20 @@ namespace detail {
   }
 
   double Space_Impl::gasEquipmentPower() const {
-    double result(0.0);
-    double area = floorArea();
-    double numPeople = numberOfPeople();
-
-    for (const GasEquipment& equipment : gasEquipment()) {
-      result += equipment.getDesignLevel(area,numPeople);
-    }
-
-    if (OptionalSpaceType spaceType = this->spaceType()) {
-      for (const GasEquipment& equipment : spaceType->gasEquipment()) {
+    return m_aggregateCache.get(CachedGasEquipmentPower, [this]() {
+      double result(0.0);
+      double area = this->floorArea();
+      double numPeople = this->numberOfPeople();
+      for (const GasEquipment& equipment : this->gasEquipment()) {
         result += equipment.getDesignLevel(area,numPeople);
       }
-    }
-
-    return result;
+      if (OptionalSpaceType spaceType = this->spaceType()) {
+        for (const GasEquipment& equipment : spaceType->gasEquipment()) {
+          result += equipment.getDesignLevel(area,numPeople);
+        }
+      }
+      return result;
+    });
   }
 
   bool Space_Impl::setGasEquipmentPower(double gasEquipmentPower) {
@@ -3210,6 +3379,14 @@ double Space::exteriorWallArea() const {
   return getImpl<detail::Space_Impl>()->exteriorWallArea();
 }
 
+double Space::exteriorRoofArea() const {
+  return getImpl<detail::Space_Impl>()->exteriorRoofArea();
+}
+
+double Space::exteriorWindowArea() const {
+  return getImpl<detail::Space_Impl>()->exteriorWindowArea();
+}
+
 double Space::volume() const {
   return getImpl<detail::Space_Impl>()->volume();
 }
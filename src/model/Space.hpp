@@ -269,6 +269,15 @@ class MODEL_API Space : public PlanarSurfaceGroup {
   /// Does not include space multiplier in calculation.
   double exteriorWallArea() const;
 
+  /// Returns the exterior roof area (gross area of roof surfaces with outdoor boundary condition) (m^2).
+  /// Does not include space multiplier in calculation.
+  double exteriorRoofArea() const;
+
+  /// Returns the exterior window area (net area of fixed and operable windows in exterior walls,
+  /// including sub surface multipliers) (m^2).
+  /// Does not include space multiplier in calculation.
+  double exteriorWindowArea() const;
+
   /// Returns the volume (m^3).
   /// Does not include space multiplier in calculation.
   double volume() const;
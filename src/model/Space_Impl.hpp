@@ -32,6 +32,7 @@
 
 #include "ModelAPI.hpp"
 #include "PlanarSurfaceGroup_Impl.hpp"
+#include "AggregateCache.hpp"
 
 
 #include <boost/geometry/geometries/point_xy.hpp>
@@ -311,12 +312,19 @@ namespace detail {
     /// Returns the multiplier for this space, comes from thermal zone, defaults to 1.
     int multiplier() const;
 
+    /// Connects watcher to the invalidation of this space's cached aggregates, e.g. floor area.
+    void watchAggregates(AggregateWatcher& watcher) const;
+
     double floorArea() const;
 
     double exteriorArea() const;
 
     double exteriorWallArea() const;
 
+    double exteriorRoofArea() const;
+
+    double exteriorWindowArea() const;
+
     double volume() const;
 
     double numberOfPeople() const;
@@ -486,6 +494,22 @@ namespace detail {
    private:
     REGISTER_LOGGER("openstudio.model.Space");
 
+    // aggregates over surfaces or loads, cached until one of the objects they are computed from changes
+    enum CachedAggregate {
+      CachedFloorArea,
+      CachedExteriorArea,
+      CachedVolume,
+      CachedExteriorWallArea,
+      CachedExteriorRoofArea,
+      CachedExteriorWindowArea,
+      CachedNumberOfPeople,
+      CachedLightingPower,
+      CachedElectricEquipmentPower,
+      CachedGasEquipmentPower,
+      NumCachedAggregates
+    };
+    mutable AggregateCache m_aggregateCache{NumCachedAggregates, [this](AggregateWatcher& watcher) { watchAggregateInputs(watcher); }};
+
     boost::optional<ModelObject> spaceTypeAsModelObject() const;
     boost::optional<ModelObject> defaultConstructionSetAsModelObject() const;
     boost::optional<ModelObject> defaultScheduleSetAsModelObject() const;
@@ -522,6 +546,13 @@ namespace detail {
     template <typename T>
     void removeAllButOneSpaceLoadInstance(std::vector<T>& instances, const T& instanceToKeep);
 
+    // connects the objects the cached aggregates are computed from: surfaces, sub surfaces and the constructions
+    // that make a floor an air wall, loads and their definitions, and the objects those are found through
+    void watchAggregateInputs(AggregateWatcher& watcher) const;
+
+    // connects the objects a default construction for a surface of space may be found through
+    static void watchDefaultConstructions(AggregateWatcher& watcher, const Space& space);
+
     // helper function to get a boost polygon point from a Point3d
     boost::tuple<double, double> point3dToTuple(const Point3d& point3d, std::vector<Point3d>& allPoints, double tol) const;
 
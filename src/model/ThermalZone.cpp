@@ -966,44 +966,83 @@ namespace detail {
       Space::iddObjectType());
   }
 
-  double ThermalZone_Impl::floorArea() const {
-    double result(0.0);
+  void ThermalZone_Impl::watchAggregateInputs(AggregateWatcher& watcher) const
+  {
+    // spaces are added to or removed from the zone by pointing to it
+    watcher.watchSources(getObject<ThermalZone>());
     for (const Space& space : spaces()) {
-      result += space.floorArea();
+      space.getImpl<Space_Impl>()->watchAggregates(watcher);
     }
-    return result;
+  }
+
+  double ThermalZone_Impl::floorArea() const {
+    return m_aggregateCache.get(CachedFloorArea, [this]() {
+      double result(0.0);
+      for (const Space& space : spaces()) {
+        result += space.floorArea();
+      }
+      return result;
+    });
   }
 
   double ThermalZone_Impl::exteriorSurfaceArea() const {
-    double result(0.0);
-    for (const Space& space : spaces()) {
-      result += space.exteriorArea();
-    }
-    return result;
+    return m_aggregateCache.get(CachedExteriorSurfaceArea, [this]() {
+      double result(0.0);
+      for (const Space& space : spaces()) {
+        result += space.exteriorArea();
+      }
+      return result;
+    });
   }
 
   double ThermalZone_Impl::exteriorWallArea() const {
-    double result(0.0);
-    for (const Space& space : spaces()) {
-      result += space.exteriorWallArea();
-    }
-    return result;
+    return m_aggregateCache.get(CachedExteriorWallArea, [this]() {
+      double result(0.0);
+      for (const Space& space : spaces()) {
+        result += space.exteriorWallArea();
+      }
+      return result;
+    });
+  }
+
+  double ThermalZone_Impl::exteriorRoofArea() const {
+    return m_aggregateCache.get(CachedExteriorRoofArea, [this]() {
+      double result(0.0);
+      for (const Space& space : spaces()) {
+        result += space.exteriorRoofArea();
+      }
+      return result;
+    });
+  }
+
+  double ThermalZone_Impl::exteriorWindowArea() const {
+    return m_aggregateCache.get(CachedExteriorWindowArea, [this]() {
+      double result(0.0);
+      for (const Space& space : spaces()) {
+        result += space.exteriorWindowArea();
+      }
+      return result;
+    });
   }
 
   double ThermalZone_Impl::airVolume() const {
-    double result(0.0);
-    for (const Space& space : spaces()) {
-      result += space.volume();
-    }
-    return result;
+    return m_aggregateCache.get(CachedAirVolume, [this]() {
+      double result(0.0);
+      for (const Space& space : spaces()) {
+        result += space.volume();
+      }
+      return result;
+    });
   }
 
   double ThermalZone_Impl::numberOfPeople() const {
-    double result(0.0);
-    for (const Space& space : spaces()) {
-      result += space.numberOfPeople();
-    }
-    return result;
+    return m_aggregateCache.get(CachedNumberOfPeople, [this]() {
+      double result(0.0);
+      for (const Space& space : spaces()) {
+        result += space.numberOfPeople();
+      }
+      return result;
+    });
   }
 
   double ThermalZone_Impl::peoplePerFloorArea() const {
@@ -1034,11 +1073,13 @@ namespace detail {
   }
 
   double ThermalZone_Impl::lightingPower() const {
-    double result(0.0);
-    for (const Space& space : spaces()){
-      result += space.lightingPower();
-    }
-    return result;
+    return m_aggregateCache.get(CachedLightingPower, [this]() {
+      double result(0.0);
+      for (const Space& space : spaces()){
+        result += space.lightingPower();
+      }
+      return result;
+    });
   }
 
   double ThermalZone_Impl::lightingPowerPerFloorArea() const {
@@ -1072,11 +1113,13 @@ namespace detail {
   }
 
   double ThermalZone_Impl::electricEquipmentPower() const {
-    double result(0.0);
-    for (const Space& space : spaces()){
-      result += space.electricEquipmentPower();
-    }
-    return result;
+    return m_aggregateCache.get(CachedElectricEquipmentPower, [this]() {
+      double result(0.0);
+      for (const Space& space : spaces()){
+        result += space.electricEquipmentPower();
+      }
+      return result;
+    });
   }
 
   double ThermalZone_Impl::electricEquipmentPowerPerFloorArea() const {
@@ -1110,11 +1153,13 @@ namespace detail {
   }
 
   double ThermalZone_Impl::gasEquipmentPower() const {
-    double result(0.0);
-    for (const Space& space : spaces()){
-      result += space.gasEquipmentPower();
-    }
-    return result;
+    return m_aggregateCache.get(CachedGasEquipmentPower, [this]() {
+      double result(0.0);
+      for (const Space& space : spaces()){
+        result += space.gasEquipmentPower();
+      }
+      return result;
+    });
   }
 
   double ThermalZone_Impl::gasEquipmentPowerPerFloorArea() const {
@@ -3165,6 +3210,14 @@ double ThermalZone::exteriorWallArea() const {
   return getImpl<detail::ThermalZone_Impl>()->exteriorWallArea();
 }
 
+double ThermalZone::exteriorRoofArea() const {
+  return getImpl<detail::ThermalZone_Impl>()->exteriorRoofArea();
+}
+
+double ThermalZone::exteriorWindowArea() const {
+  return getImpl<detail::ThermalZone_Impl>()->exteriorWindowArea();
+}
+
 double ThermalZone::airVolume() const {
   return getImpl<detail::ThermalZone_Impl>()->airVolume();
 }
@@ -253,6 +253,14 @@ class MODEL_API ThermalZone : public HVACComponent {
    *  multiplier. */
   double exteriorWallArea() const;
 
+  /** Accumulates the exterior roof area (m^2) of spaces. Does not include space
+   *  multiplier. */
+  double exteriorRoofArea() const;
+
+  /** Accumulates the exterior window area (m^2) of spaces. Does not include space
+   *  multiplier. */
+  double exteriorWindowArea() const;
+
   // TODO: How should this interact with the volume field. If there is an interaction,
   // how should Building calculate its airVolume and accumulate infiltration design
   // flow rate?
@@ -32,6 +32,7 @@
 
 #include "ModelAPI.hpp"
 #include "HVACComponent_Impl.hpp"
+#include "AggregateCache.hpp"
 
 
 namespace openstudio {
@@ -266,6 +267,14 @@ namespace detail {
      *  multiplier. */
     double exteriorWallArea() const;
 
+    /** Accumulates the exterior roof area (m^2) of spaces. Does not include space
+     *  multiplier. */
+    double exteriorRoofArea() const;
+
+    /** Accumulates the exterior window area (m^2) of spaces. Does not include space
+     *  multiplier. */
+    double exteriorWindowArea() const;
+
     // TODO: How should this interact with the volume field. If there is an interaction,
     // how should Building calculate its airVolume and accumulate infiltration design
     // flow rate?
@@ -447,6 +456,24 @@ namespace detail {
    private:
     REGISTER_LOGGER("openstudio.model.ThermalZone");
 
+    // sums over spaces, cached until a space's aggregates change or a space is added to or removed from the zone
+    enum CachedAggregate {
+      CachedFloorArea,
+      CachedExteriorSurfaceArea,
+      CachedExteriorWallArea,
+      CachedExteriorRoofArea,
+      CachedExteriorWindowArea,
+      CachedAirVolume,
+      CachedNumberOfPeople,
+      CachedLightingPower,
+      CachedElectricEquipmentPower,
+      CachedGasEquipmentPower,
+      NumCachedAggregates
+    };
+    mutable AggregateCache m_aggregateCache{NumCachedAggregates, [this](AggregateWatcher& watcher) { watchAggregateInputs(watcher); }};
+
+    void watchAggregateInputs(AggregateWatcher& watcher) const;
+
     boost::optional<ModelObject> thermostatSetpointDualSetpointAsModelObject() const;
     boost::optional<ModelObject> zoneControlHumidistatAsModelObject() const;
     boost::optional<ModelObject> primaryDaylightingControlAsModelObject() const;
@@ -42,6 +42,8 @@
 #include "../ThermalZone.hpp"
 #include "../ThermalZone_Impl.hpp"
 
+#include <chrono>
+
 using namespace openstudio;
 using namespace openstudio::model;
 
@@ -669,3 +671,61 @@ TEST_F(ModelFixture, ModelMerger_SuggestMapping_ExampleModel) {
     EXPECT_EQ(model1.getObject(mapPair.first)->nameString(), model2.getObject(mapPair.second)->nameString());
   }
 }
+
+TEST_F(ModelFixture, ModelMerger_SuggestMapping_Geometry) {
+  Model model1;
+  unsigned n = 5000;
+  for (unsigned i = 0; i < n; ++i) {
+    double x = 10.0 * (i % 100);
+    double y = 10.0 * (i / 100);
+    std::vector<Point3d> floor;
+    floor.push_back(Point3d(x, y + 10, 0));
+    floor.push_back(Point3d(x + 10, y + 10, 0));
+    floor.push_back(Point3d(x + 10, y, 0));
+    floor.push_back(Point3d(x, y, 0));
+    Space space(model1);
+    space.setName("Space " + std::to_string(i));
+    Surface surface(floor, model1);
+    surface.setSpace(space);
+  }
+
+  // same geometry under new handles and names
+  Model model2 = model1.clone().cast<Model>();
+  std::vector<Space> spaces2 = model2.getConcreteModelObjects<Space>();
+  ASSERT_EQ(n, spaces2.size());
+  for (Space& space : spaces2) {
+    space.setName("Renamed " + space.nameString());
+  }
+  // one space moved, should not be matched
+  Space moved = model2.getConcreteModelObjectByName<Space>("Renamed Space 0").get();
+  moved.setXOrigin(1000.0);
+
+  ModelMerger mm;
+  auto start = std::chrono::steady_clock::now();
+  std::map<UUID, UUID> handleMapping = mm.suggestHandleMapping(model1, model2);
+  auto end = std::chrono::steady_clock::now();
+  RecordProperty("SuggestHandleMappingTimeMs", std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()));
+
+  unsigned numSpacesMapped = 0;
+  for (const auto& mapPair : handleMapping) {
+    boost::optional<Space> space1 = model1.getModelObject<Space>(mapPair.first);
+    if (!space1) {
+      continue;
+    }
+    ++numSpacesMapped;
+    boost::optional<Space> space2 = model2.getModelObject<Space>(mapPair.second);
+    ASSERT_TRUE(space2);
+    EXPECT_EQ("Renamed " + space1->nameString(), space2->nameString());
+  }
+  EXPECT_EQ(n - 1, numSpacesMapped);
+
+  start = std::chrono::steady_clock::now();
+  mm.mergeModels(model1, model2, handleMapping);
+  end = std::chrono::steady_clock::now();
+  RecordProperty("MergeModelsTimeMs", std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()));
+
+  EXPECT_EQ(n, model1.getConcreteModelObjects<Space>().size());
+  EXPECT_EQ(n, model1.getConcreteModelObjects<Surface>().size());
+  EXPECT_FALSE(model1.getConcreteModelObjectByName<Space>("Space 1"));
+  ASSERT_TRUE(model1.getConcreteModelObjectByName<Space>("Renamed Space 1"));
+}
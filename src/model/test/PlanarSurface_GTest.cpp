@@ -32,9 +32,14 @@
 #include "ModelFixture.hpp"
 #include "../PlanarSurface.hpp"
 #include "../PlanarSurface_Impl.hpp"
+#include "../Model.hpp"
+#include "../Space.hpp"
+#include "../Surface.hpp"
 
 #include "../../utilities/units/QuantityFactory.hpp"
 #include "../../utilities/units/QuantityConverter.hpp"
+#include "../../utilities/geometry/Point3d.hpp"
+#include "../../utilities/geometry/Vector3d.hpp"
 
 using namespace openstudio;
 using namespace openstudio::model;
@@ -86,3 +91,42 @@ TEST_F(ModelFixture, PlanarSurface_FilmResistanceConversions)
   EXPECT_EQ("s^3*K/kg",qc->standardUnitsString());
   EXPECT_NEAR(qc->value(),PlanarSurface::filmResistance(FilmResistanceType::MovingAir_7p5mph),1.0E-8);
 }
+
+TEST_F(ModelFixture, PlanarSurface_PolygonBatch)
+{
+  Model model;
+  Space space(model);
+
+  std::vector<PlanarSurface> planarSurfaces;
+  for (unsigned i = 0; i < 10; ++i){
+    Point3dVector vertices;
+    vertices.push_back(Point3d(i, 0, 3));
+    vertices.push_back(Point3d(i, 0, 0));
+    vertices.push_back(Point3d(i + 1, 0.5 * i, 0));
+    vertices.push_back(Point3d(i + 1, 0.5 * i, 3));
+    Surface surface(vertices, model);
+    surface.setSpace(space);
+    planarSurfaces.push_back(surface);
+  }
+
+  PolygonBatch batch = PlanarSurface::polygonBatch(planarSurfaces);
+  ASSERT_EQ(planarSurfaces.size(), batch.numPolygons());
+  for (unsigned i = 0; i < planarSurfaces.size(); ++i){
+    EXPECT_EQ(planarSurfaces[i].grossArea(), batch.areas()[i]);
+    ASSERT_TRUE(batch.outwardNormal(i));
+    EXPECT_EQ(planarSurfaces[i].outwardNormal(), *batch.outwardNormal(i));
+    ASSERT_TRUE(batch.tilt(i));
+    EXPECT_EQ(planarSurfaces[i].tilt(), *batch.tilt(i));
+    ASSERT_TRUE(batch.azimuth(i));
+    EXPECT_EQ(planarSurfaces[i].azimuth(), *batch.azimuth(i));
+  }
+
+  // all surfaces are vertical walls facing between east and south
+  std::vector<PlanarSurface> found = PlanarSurface::findPlanarSurfaces(planarSurfaces, 90.0, 270.0, 90.0, 90.0);
+  EXPECT_EQ(10u, found.size());
+
+  // only the first surface faces due south
+  found = PlanarSurface::findPlanarSurfaces(planarSurfaces, 170.0, 190.0, 90.0, 90.0);
+  ASSERT_EQ(1u, found.size());
+  EXPECT_EQ(planarSurfaces[0].handle(), found[0].handle());
+}
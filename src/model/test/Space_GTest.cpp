@@ -61,6 +61,9 @@
 #include "../SpaceInfiltrationDesignFlowRate.hpp"
 #include "../AirLoopHVACSupplyPlenum.hpp"
 #include "../AirLoopHVACReturnPlenum.hpp"
+#include "../ConstructionAirBoundary.hpp"
+#include "../DefaultConstructionSet.hpp"
+#include "../DefaultSurfaceConstructions.hpp"
 
 #include "../../utilities/core/UUID.hpp"
 
@@ -2042,3 +2045,149 @@ TEST_F(ModelFixture, Space_intersectSurfaces_degenerate3) {
 
   //m.save("intersect3.osm", true);
 }
+
+TEST_F(ModelFixture, Space_CachedAggregates)
+{
+  Model model;
+
+  Point3dVector floorPrint;
+  floorPrint.push_back(Point3d(0, 10, 0));
+  floorPrint.push_back(Point3d(10, 10, 0));
+  floorPrint.push_back(Point3d(10, 0, 0));
+  floorPrint.push_back(Point3d(0, 0, 0));
+
+  boost::optional<Space> space = Space::fromFloorPrint(floorPrint, 3, model);
+  ASSERT_TRUE(space);
+  ThermalZone thermalZone(model);
+  EXPECT_TRUE(space->setThermalZone(thermalZone));
+  Building building = model.getUniqueModelObject<Building>();
+
+  EXPECT_DOUBLE_EQ(100.0, space->floorArea());
+  EXPECT_DOUBLE_EQ(300.0, space->volume());
+  EXPECT_DOUBLE_EQ(100.0, thermalZone.floorArea());
+  EXPECT_DOUBLE_EQ(100.0, building.floorArea());
+  EXPECT_DOUBLE_EQ(120.0, building.exteriorWallArea());
+
+  // geometry changes
+  boost::optional<Surface> floor;
+  for (const Surface& surface : space->surfaces()) {
+    if (surface.surfaceType() == "Floor") {
+      floor = surface;
+    }
+  }
+  ASSERT_TRUE(floor);
+  Point3dVector halfFloor;
+  halfFloor.push_back(Point3d(0, 10, 0));
+  halfFloor.push_back(Point3d(5, 10, 0));
+  halfFloor.push_back(Point3d(5, 0, 0));
+  halfFloor.push_back(Point3d(0, 0, 0));
+  EXPECT_TRUE(floor->setVertices(halfFloor));
+  EXPECT_DOUBLE_EQ(50.0, space->floorArea());
+  EXPECT_DOUBLE_EQ(50.0, thermalZone.floorArea());
+  EXPECT_DOUBLE_EQ(50.0, building.floorArea());
+
+  // changes to another space do not matter
+  boost::optional<Space> otherSpace = Space::fromFloorPrint(floorPrint, 3, model);
+  ASSERT_TRUE(otherSpace);
+  EXPECT_DOUBLE_EQ(100.0, otherSpace->floorArea());
+  EXPECT_DOUBLE_EQ(50.0, space->floorArea());
+  EXPECT_DOUBLE_EQ(150.0, building.floorArea());
+  otherSpace->remove();
+  EXPECT_DOUBLE_EQ(50.0, building.floorArea());
+
+  // new surfaces are picked up
+  Point3dVector otherHalfFloor;
+  otherHalfFloor.push_back(Point3d(5, 10, 0));
+  otherHalfFloor.push_back(Point3d(10, 10, 0));
+  otherHalfFloor.push_back(Point3d(10, 0, 0));
+  otherHalfFloor.push_back(Point3d(5, 0, 0));
+  Surface otherFloor(otherHalfFloor, model);
+  EXPECT_TRUE(otherFloor.setSpace(*space));
+  EXPECT_DOUBLE_EQ(100.0, space->floorArea());
+  EXPECT_DOUBLE_EQ(100.0, thermalZone.floorArea());
+  EXPECT_DOUBLE_EQ(100.0, building.floorArea());
+  otherFloor.remove();
+  EXPECT_DOUBLE_EQ(50.0, space->floorArea());
+  EXPECT_DOUBLE_EQ(50.0, building.floorArea());
+
+  // air walls are found through the default construction set
+  ConstructionAirBoundary airBoundary(model);
+  DefaultSurfaceConstructions groundConstructions(model);
+  DefaultConstructionSet constructionSet(model);
+  EXPECT_TRUE(constructionSet.setDefaultGroundContactSurfaceConstructions(groundConstructions));
+  EXPECT_TRUE(space->setDefaultConstructionSet(constructionSet));
+  EXPECT_DOUBLE_EQ(50.0, space->floorArea());
+  EXPECT_TRUE(groundConstructions.setFloorConstruction(airBoundary));
+  EXPECT_DOUBLE_EQ(0.0, space->floorArea());
+  EXPECT_DOUBLE_EQ(0.0, building.floorArea());
+  groundConstructions.resetFloorConstruction();
+  EXPECT_DOUBLE_EQ(50.0, space->floorArea());
+
+  // exterior roof and window areas
+  EXPECT_DOUBLE_EQ(100.0, space->exteriorRoofArea());
+  EXPECT_DOUBLE_EQ(0.0, space->exteriorWindowArea());
+  boost::optional<Surface> wall;
+  for (const Surface& surface : space->surfaces()) {
+    if (surface.surfaceType() == "Wall") {
+      wall = surface;
+    }
+  }
+  ASSERT_TRUE(wall);
+  Point3dVector wallVertices = wall->vertices();
+  Point3d wallCentroid = *getCentroid(wallVertices);
+  Point3dVector windowVertices;
+  for (const Point3d& vertex : wallVertices) {
+    windowVertices.push_back(wallCentroid + 0.5 * (vertex - wallCentroid));
+  }
+  SubSurface window(windowVertices, model);
+  EXPECT_TRUE(window.setSubSurfaceType("FixedWindow"));
+  EXPECT_TRUE(window.setSurface(*wall));
+  EXPECT_DOUBLE_EQ(0.25 * wall->grossArea(), space->exteriorWindowArea());
+  EXPECT_TRUE(window.setMultiplier(2));
+  EXPECT_DOUBLE_EQ(0.5 * wall->grossArea(), space->exteriorWindowArea());
+  EXPECT_DOUBLE_EQ(0.5 * wall->grossArea(), thermalZone.exteriorWindowArea());
+  EXPECT_DOUBLE_EQ(0.5 * wall->grossArea(), building.exteriorWindowArea());
+  EXPECT_DOUBLE_EQ(100.0, building.exteriorRoofArea());
+
+  // multiplier changes
+  EXPECT_TRUE(thermalZone.setMultiplier(2));
+  EXPECT_DOUBLE_EQ(50.0, thermalZone.floorArea());
+  EXPECT_DOUBLE_EQ(100.0, building.floorArea());
+  EXPECT_DOUBLE_EQ(200.0, building.exteriorRoofArea());
+
+  // load changes
+  EXPECT_DOUBLE_EQ(0.0, space->numberOfPeople());
+  PeopleDefinition peopleDefinition(model);
+  EXPECT_TRUE(peopleDefinition.setNumberofPeople(10.0));
+  People people(peopleDefinition);
+  EXPECT_TRUE(people.setSpace(*space));
+  EXPECT_DOUBLE_EQ(10.0, space->numberOfPeople());
+  EXPECT_DOUBLE_EQ(20.0, building.numberOfPeople());
+  EXPECT_TRUE(peopleDefinition.setNumberofPeople(5.0));
+  EXPECT_DOUBLE_EQ(5.0, space->numberOfPeople());
+  EXPECT_DOUBLE_EQ(5.0, thermalZone.numberOfPeople());
+
+  // space type changes
+  EXPECT_DOUBLE_EQ(0.0, space->lightingPower());
+  SpaceType spaceType(model);
+  LightsDefinition lightsDefinition(model);
+  EXPECT_TRUE(lightsDefinition.setWattsperSpaceFloorArea(10.0));
+  Lights lights(lightsDefinition);
+  EXPECT_TRUE(lights.setSpaceType(spaceType));
+  EXPECT_DOUBLE_EQ(0.0, space->lightingPower());
+  EXPECT_TRUE(space->setSpaceType(spaceType));
+  EXPECT_DOUBLE_EQ(500.0, space->lightingPower());
+  EXPECT_DOUBLE_EQ(1000.0, building.lightingPower());
+
+  // changes made during a batch edit are seen right away
+  {
+    WorkspaceBatchEdit batchEdit(model);
+    EXPECT_TRUE(lightsDefinition.setWattsperSpaceFloorArea(20.0));
+    EXPECT_DOUBLE_EQ(1000.0, space->lightingPower());
+  }
+  EXPECT_DOUBLE_EQ(1000.0, space->lightingPower());
+
+  lights.remove();
+  EXPECT_DOUBLE_EQ(0.0, space->lightingPower());
+  EXPECT_DOUBLE_EQ(0.0, building.lightingPower());
+}
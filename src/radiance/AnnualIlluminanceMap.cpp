@@ -30,16 +30,14 @@
 #include "AnnualIlluminanceMap.hpp"
 #include "HeaderInfo.hpp"
 
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <fstream>
 #include <vector>
 
-#include <boost/lexical_cast.hpp>
-#include <boost/regex.hpp>
-
-#include <boost/algorithm/string.hpp>
-#include <boost/tokenizer.hpp>
-
 using namespace std;
 using namespace boost;
 using namespace openstudio;
@@ -47,6 +45,52 @@ using namespace openstudio;
 namespace openstudio{
 namespace radiance{
 
+  namespace {
+
+    // binary cache layout, in native byte order, each section starts at a multiple of 8 bytes:
+    // BinaryHeader, numX doubles of xVector, numY doubles of yVector, numDateTimes BinaryDateTime,
+    // then numDateTimes rows of numX*numY illuminance values in lux as doubles
+    const char binaryMagic[8] = {'O', 'S', 'A', 'N', 'N', 'I', 'L', 'L'};
+    const std::uint32_t binaryVersion = 1;
+
+    struct BinaryHeader
+    {
+      char magic[8];
+      std::uint32_t version;
+      std::uint32_t numX;
+      std::uint32_t numY;
+      std::uint32_t numDateTimes;
+    };
+
+    struct BinaryDateTime
+    {
+      std::uint32_t month;
+      std::uint32_t day;
+      std::uint32_t secondsOfDay;
+      std::uint32_t reserved;
+    };
+
+    // parses the next number in [pos, lineEnd), skipping spaces and tabs
+    // returns false at the end of the line or if the next token is not a number
+    bool nextNumber(const char*& pos, const char* lineEnd, double& value)
+    {
+      while (pos < lineEnd && (*pos == ' ' || *pos == '\t' || *pos == '\r')){
+        ++pos;
+      }
+      if (pos >= lineEnd){
+        return false;
+      }
+      char* numberEnd = nullptr;
+      value = std::strtod(pos, &numberEnd);
+      if (numberEnd == pos || numberEnd > lineEnd){
+        return false;
+      }
+      pos = numberEnd;
+      return true;
+    }
+
+  }
+
   /// default constructor
   AnnualIlluminanceMap::AnnualIlluminanceMap()
   {}
@@ -65,8 +109,25 @@ namespace radiance{
       return;
     }
 
-    // open file
-    openstudio::filesystem::ifstream file(path);
+    // read the whole file at once, lines are then parsed in place
+    string contents;
+    {
+      openstudio::filesystem::ifstream file(path, std::ios_base::binary);
+      if (!file || !openstudio::filesystem::is_regular_file(path)){
+        LOG(Error, "Cannot open file '" << toString(path) << "' for reading");
+        return;
+      }
+      file.seekg(0, std::ios_base::end);
+      std::streamoff fileSize = file.tellg();
+      if (fileSize < 0){
+        LOG(Error, "Cannot read file '" << toString(path) << "'");
+        return;
+      }
+      contents.resize(static_cast<size_t>(fileSize));
+      file.seekg(0, std::ios_base::beg);
+      file.read(&contents[0], contents.size());
+      contents.resize(static_cast<size_t>(file.gcount()));
+    }
 
     // keep track of line number
     unsigned lineNum = 0;
@@ -75,35 +136,32 @@ namespace radiance{
     unsigned M=0;
     unsigned N=0;
 
-    // temp string to read file
-    string line;
-
     // lines 1 and 2 are the header lines
     string line1, line2;
 
-    // this will contain matches to regular expressions
-    smatch matches;
-
-    // matches a single number followed by either tabs or spaces
-    const regex singleNumber("([-+]?[0-9]*\\.?[0-9]+)[\\s\\t]*");
-
     // conversion from footcandles to lux
     const double footcandlesToLux(10.76);
 
-    // read the rest of the file line by line
-    while(getline(file, line)){
+    const char* pos = contents.c_str();
+    const char* contentsEnd = pos + contents.size();
+
+    // read the file line by line
+    while(pos < contentsEnd){
+      const char* lineEnd = static_cast<const char*>(std::memchr(pos, '\n', contentsEnd - pos));
+      if (!lineEnd){
+        lineEnd = contentsEnd;
+      }
       ++lineNum;
 
       if (lineNum == 1){
 
         // save line 1
-        line1 = line;
-
+        line1.assign(pos, lineEnd);
 
       }else if (lineNum == 2){
 
         // save line 2
-        line2 = line;
+        line2.assign(pos, lineEnd);
 
         // create the header info
         HeaderInfo headerInfo(line1, line2);
@@ -115,70 +173,186 @@ namespace radiance{
         M = m_xVector.size();
         N = m_yVector.size();
 
+        // one line per date and time follows
+        size_t numLines = std::count(lineEnd, contentsEnd, '\n') + 1;
+        m_dateTimes.reserve(numLines);
+        m_illuminanceValues.reserve(numLines * M * N);
+
       }else{
 
         // each line contains the month, day, time (in hours),
         // Solar Azimuth(degrees from south), Solar Altitude(degrees), Global Horizontal Illuminance (fc)
         // followed by M*N illuminance points
+        double header[6];
+        unsigned numHeader = 0;
+        while (numHeader < 6 && nextNumber(pos, lineEnd, header[numHeader])){
+          ++numHeader;
+        }
 
-        // break the line up by spaces
-        vector<string> lineVector;
-        tokenizer<char_separator<char>, std::string::const_iterator, std::string > tk(line, char_separator<char>(" "));
-        for (tokenizer<char_separator<char>, std::string::const_iterator, std::string >::iterator it(tk.begin()); it!=tk.end(); ++it)
-        {
-           lineVector.push_back(*it);
+        if (numHeader == 0 && pos >= lineEnd){
+          // skip blank lines
+          pos = lineEnd + 1;
+          continue;
         }
 
-        // total number minus 6 standard header items
-        unsigned numValues = lineVector.size() - 6;
+        // illuminance values are converted and appended as they are read
+        size_t rowBegin = m_illuminanceValues.size();
+        double value = 0.0;
+        while (numHeader == 6 && nextNumber(pos, lineEnd, value)){
+          m_illuminanceValues.push_back(footcandlesToLux*value);
+        }
+        size_t numValues = m_illuminanceValues.size() - rowBegin;
 
-        if (numValues != M*N){
+        if (pos < lineEnd){
+          LOG(Fatal, "Could not read illuminance value on line " << lineNum << ".");
+          m_illuminanceValues.resize(rowBegin);
+          return;
+        }else if (numValues != M*N){
           LOG(Fatal,  "Incorrect number of illuminance values read " << numValues << ", expecting " << M*N << ".");
+          m_illuminanceValues.resize(rowBegin);
           return;
         }else{
 
-          MonthOfYear month = monthOfYear(lexical_cast<unsigned>(lineVector[0]));
-          unsigned day = lexical_cast<unsigned>(lineVector[1]);
-          double fracDays = lexical_cast<double>(lineVector[2]) / 24.0;
+          MonthOfYear month = monthOfYear(static_cast<unsigned>(header[0]));
+          unsigned day = static_cast<unsigned>(header[1]);
+          double fracDays = header[2] / 24.0;
 
           // ignore solar angles and global horizontal for now
 
           // make the date time
           DateTime dateTime(Date(month, day), Time(fracDays));
 
-          // matrix we are going to read in
-          Matrix illuminanceMap(M,N);
-
-          // read in the values
-          unsigned index = 6;
-          for (unsigned j = 0; j < N; ++j){
-            for (unsigned i = 0; i < M; ++i){
-              illuminanceMap(i,j) = footcandlesToLux*lexical_cast<double>(lineVector[index]);
-              ++index;
-            }
-          }
-
+          m_dateTimeIndexMap[dateTime] = m_dateTimes.size();
           m_dateTimes.push_back(dateTime);
-          m_dateTimeIlluminanceMap[dateTime] = illuminanceMap;
         }
       }
-    }
 
-    // close file
-    file.close();
+      pos = lineEnd + 1;
+    }
   }
 
   /// get the illuminance map in lux corresponding to date and time
   openstudio::Matrix AnnualIlluminanceMap::illuminanceMap(const openstudio::DateTime& dateTime) const
   {
-    auto it = m_dateTimeIlluminanceMap.find(dateTime);
-    if (it != m_dateTimeIlluminanceMap.end()){
-      return it->second;
+    auto it = m_dateTimeIndexMap.find(dateTime);
+    if (it != m_dateTimeIndexMap.end()){
+      unsigned M = m_xVector.size();
+      unsigned N = m_yVector.size();
+      Matrix result(M, N);
+      auto value = m_illuminanceValues.begin() + static_cast<size_t>(it->second) * M * N;
+      for (unsigned j = 0; j < N; ++j){
+        for (unsigned i = 0; i < M; ++i){
+          result(i,j) = *value;
+          ++value;
+        }
+      }
+      return result;
     }
 
     return m_nullIlluminanceMap;
   }
 
+  bool AnnualIlluminanceMap::saveBinary(const openstudio::path& path) const
+  {
+    openstudio::filesystem::ofstream file(path, std::ios_base::binary | std::ios_base::trunc);
+    if (!file.is_open()){
+      LOG(Error, "Cannot open file '" << toString(path) << "' for writing");
+      return false;
+    }
+
+    BinaryHeader header;
+    std::memcpy(header.magic, binaryMagic, sizeof(binaryMagic));
+    header.version = binaryVersion;
+    header.numX = m_xVector.size();
+    header.numY = m_yVector.size();
+    header.numDateTimes = m_dateTimes.size();
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    std::vector<double> coordinates(m_xVector.begin(), m_xVector.end());
+    coordinates.insert(coordinates.end(), m_yVector.begin(), m_yVector.end());
+    file.write(reinterpret_cast<const char*>(coordinates.data()), coordinates.size() * sizeof(double));
+
+    std::vector<BinaryDateTime> dateTimes(m_dateTimes.size());
+    for (unsigned i = 0; i < m_dateTimes.size(); ++i){
+      dateTimes[i].month = month(m_dateTimes[i].date().monthOfYear());
+      dateTimes[i].day = m_dateTimes[i].date().dayOfMonth();
+      dateTimes[i].secondsOfDay = m_dateTimes[i].time().totalSeconds();
+      dateTimes[i].reserved = 0;
+    }
+    file.write(reinterpret_cast<const char*>(dateTimes.data()), dateTimes.size() * sizeof(BinaryDateTime));
+
+    file.write(reinterpret_cast<const char*>(m_illuminanceValues.data()), m_illuminanceValues.size() * sizeof(double));
+
+    if (!file.good()){
+      LOG(Error, "Could not write file '" << toString(path) << "'");
+      return false;
+    }
+    return true;
+  }
+
+  boost::optional<AnnualIlluminanceMap> AnnualIlluminanceMap::loadBinary(const openstudio::path& path)
+  {
+    if (!exists( path )){
+      LOG(Error, "File does not exist: '" << toString(path) << "'" );
+      return boost::none;
+    }
+
+    openstudio::filesystem::ifstream file(path, std::ios_base::binary);
+    if (!file){
+      LOG(Error, "Cannot open file '" << toString(path) << "' for reading");
+      return boost::none;
+    }
+
+    BinaryHeader header;
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        std::memcmp(header.magic, binaryMagic, sizeof(binaryMagic)) != 0 || header.version != binaryVersion){
+      LOG(Error, "File '" << toString(path) << "' is not an annual illuminance map");
+      return boost::none;
+    }
+
+    size_t numPoints = static_cast<size_t>(header.numX) * header.numY;
+    std::streamoff expectedSize = sizeof(header) + (header.numX + header.numY) * sizeof(double)
+      + header.numDateTimes * (sizeof(BinaryDateTime) + numPoints * sizeof(double));
+    file.seekg(0, std::ios_base::end);
+    std::streamoff size = file.tellg();
+    if (size != expectedSize){
+      LOG(Error, "File '" << toString(path) << "' has " << size << " bytes, expecting " << expectedSize);
+      return boost::none;
+    }
+    file.seekg(sizeof(header), std::ios_base::beg);
+
+    AnnualIlluminanceMap result;
+
+    std::vector<double> coordinates(header.numX + header.numY);
+    file.read(reinterpret_cast<char*>(coordinates.data()), coordinates.size() * sizeof(double));
+    result.m_xVector = Vector(header.numX);
+    std::copy(coordinates.begin(), coordinates.begin() + header.numX, result.m_xVector.begin());
+    result.m_yVector = Vector(header.numY);
+    std::copy(coordinates.begin() + header.numX, coordinates.end(), result.m_yVector.begin());
+
+    std::vector<BinaryDateTime> dateTimes(header.numDateTimes);
+    file.read(reinterpret_cast<char*>(dateTimes.data()), dateTimes.size() * sizeof(BinaryDateTime));
+
+    result.m_dateTimes.reserve(dateTimes.size());
+    for (const BinaryDateTime& binaryDateTime : dateTimes){
+      DateTime dateTime(Date(monthOfYear(binaryDateTime.month), binaryDateTime.day),
+                        Time(0, 0, 0, binaryDateTime.secondsOfDay));
+      result.m_dateTimeIndexMap[dateTime] = result.m_dateTimes.size();
+      result.m_dateTimes.push_back(dateTime);
+    }
+
+    // the values are read straight into their final storage
+    result.m_illuminanceValues.resize(header.numDateTimes * numPoints);
+    file.read(reinterpret_cast<char*>(result.m_illuminanceValues.data()), result.m_illuminanceValues.size() * sizeof(double));
+
+    if (!file){
+      LOG(Error, "Could not read file '" << toString(path) << "'");
+      return boost::none;
+    }
+
+    return result;
+  }
+
 
 } // radiance
 } // openstudio
@@ -38,19 +38,24 @@
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/Path.hpp"
 
+#include <boost/optional.hpp>
+
+#include <vector>
+
 namespace openstudio{
 namespace radiance{
 
   /** AnnualIlluminanceMap represents illuminance map for an entire year.
   *   We assume that the output files is from SPOT, with length in meters and illuminance
   *   values in footcandles.  All illuminance values are converted to lux.
+  *   Illuminance values for all dates and times are stored in one contiguous array.
   */
   class RADIANCE_API AnnualIlluminanceMap
   {
     private:
 
-      // map of DateTime to Matrix (illuminance map)
-      typedef std::map<openstudio::DateTime, openstudio::Matrix> DateTimeIlluminanceMap;
+      // map of DateTime to row of m_illuminanceValues
+      typedef std::map<openstudio::DateTime, unsigned> DateTimeIndexMap;
 
     public:
 
@@ -74,8 +79,23 @@ namespace radiance{
       openstudio::Vector yVector() const {return m_yVector;}
 
       /// get the illuminance map in lux corresponding to date and time
+      /// a new Matrix is built from illuminanceValues() on every call, use illuminanceValues() directly in loops
       openstudio::Matrix illuminanceMap(const openstudio::DateTime& dateTime) const;
 
+      /// get the number of illuminance points in each map, xVector().size() * yVector().size()
+      unsigned numPoints() const {return m_xVector.size() * m_yVector.size();}
+
+      /// get all illuminance values in lux, one row of numPoints() values for each of dateTimes()
+      /// the value at column i and row j of illuminanceMap is at index j * xVector().size() + i of the row
+      const std::vector<double>& illuminanceValues() const {return m_illuminanceValues;}
+
+      /// save to a binary cache file, which loads much faster than the text output, returns false if the file cannot be written
+      /// the file is in native byte order and is only meant to be read back by loadBinary on the same platform
+      bool saveBinary(const openstudio::path& path) const;
+
+      /// load from a binary cache file written by saveBinary, the values are copied into illuminanceValues()
+      static boost::optional<AnnualIlluminanceMap> loadBinary(const openstudio::path& path);
+
     private:
 
       REGISTER_LOGGER("radiance.AnnualIlluminanceMap");
@@ -86,7 +106,8 @@ namespace radiance{
       openstudio::Vector m_xVector;
       openstudio::Vector m_yVector;
       openstudio::Matrix m_nullIlluminanceMap; // used when there is no data
-      DateTimeIlluminanceMap m_dateTimeIlluminanceMap;
+      std::vector<double> m_illuminanceValues;
+      DateTimeIndexMap m_dateTimeIndexMap;
   };
 
 } // radiance
@@ -20,6 +20,8 @@
 // create an instantiation of the vector class
 %template(AnnualIlluminanceMapVector) std::vector< std::shared_ptr<openstudio::radiance::AnnualIlluminanceMap> >;
 
+%template(OptionalAnnualIlluminanceMap) boost::optional<openstudio::radiance::AnnualIlluminanceMap>;
+
 %ignore openstudio::radiance::AnnualIlluminanceMap::AnnualIlluminanceMap(const openstudio::Path&);
 
 %include <radiance/AnnualIlluminanceMap.hpp>
@@ -0,0 +1,292 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#include "BSDFCatalog.hpp"
+
+#include "../utilities/bcl/BCLComponent.hpp"
+#include "../utilities/bcl/LocalBCL.hpp"
+#include "../utilities/core/Compare.hpp"
+#include "../utilities/core/Filesystem.hpp"
+#include "../utilities/data/Attribute.hpp"
+
+#include <boost/algorithm/string.hpp>
+#include <boost/system/error_code.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace openstudio {
+namespace radiance {
+
+  BSDFCatalogEntry::BSDFCatalogEntry(const openstudio::path& path, double visibleLightTransmittance,
+                                     double visibleLightTransmittanceSpecular, const std::string& shadeType)
+    : m_path(path), m_visibleLightTransmittance(visibleLightTransmittance),
+      m_visibleLightTransmittanceSpecular(visibleLightTransmittanceSpecular), m_shadeType(shadeType)
+  {}
+
+  openstudio::path BSDFCatalogEntry::path() const
+  {
+    return m_path;
+  }
+
+  double BSDFCatalogEntry::visibleLightTransmittance() const
+  {
+    return m_visibleLightTransmittance;
+  }
+
+  double BSDFCatalogEntry::visibleLightTransmittanceSpecular() const
+  {
+    return m_visibleLightTransmittanceSpecular;
+  }
+
+  std::string BSDFCatalogEntry::shadeType() const
+  {
+    return m_shadeType;
+  }
+
+  BSDFCatalog::BSDFCatalog()
+    : m_localBCLLoaded(false), m_localBCLWriteTime(0)
+  {}
+
+  BSDFCatalog& BSDFCatalog::instance()
+  {
+    static BSDFCatalog catalog;
+    return catalog;
+  }
+
+  unsigned BSDFCatalog::loadLocalBCL(openstudio::LocalBCL& bcl)
+  {
+    std::lock_guard<std::mutex> localBCLLock(m_localBCLMutex);
+
+    // downloading or removing components writes the database, so an unmodified database has nothing new
+    openstudio::path dbPath = bcl.dbPath();
+    boost::system::error_code ec;
+    std::time_t writeTime = openstudio::filesystem::last_write_time(dbPath, ec);
+    if (ec){
+      writeTime = 0;
+    }
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (m_localBCLLoaded && (m_localBCLDbPath == dbPath) && (m_localBCLWriteTime == writeTime)){
+        return 0;
+      }
+    }
+
+    std::string searchTerm = "BSDF";
+    unsigned tid = 1316; // "Construction Assembly.Fenestration.Window";
+
+    unsigned result = 0;
+    for (const BCLComponent& component : bcl.searchComponents(searchTerm, tid)){
+      if (addComponent(component)){
+        ++result;
+      }
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_localBCLLoaded = true;
+      m_localBCLDbPath = dbPath;
+      m_localBCLWriteTime = writeTime;
+    }
+
+    LOG(Debug, "Loaded " << result << " BSDF files from the local BCL");
+    return result;
+  }
+
+  unsigned BSDFCatalog::loadDirectory(const openstudio::path& directory)
+  {
+    unsigned result = 0;
+    if (!openstudio::filesystem::is_directory(directory)){
+      LOG(Error, "Cannot load BSDF files from '" << toString(directory) << "', it is not a directory");
+      return result;
+    }
+
+    // sort the component directories so entries are added in the same order on every platform
+    std::vector<openstudio::path> componentDirectories;
+    for (const auto& entry : openstudio::filesystem::directory_iterator(directory)){
+      if (openstudio::filesystem::is_regular_file(entry.path() / toPath("component.xml"))){
+        componentDirectories.push_back(entry.path());
+      }
+    }
+    std::sort(componentDirectories.begin(), componentDirectories.end());
+
+    for (const openstudio::path& componentDirectory : componentDirectories){
+      if (addComponent(BCLComponent(componentDirectory))){
+        ++result;
+      }
+    }
+
+    LOG(Debug, "Loaded " << result << " BSDF files from '" << toString(directory) << "'");
+    return result;
+  }
+
+  bool BSDFCatalog::addComponent(const openstudio::BCLComponent& component)
+  {
+    try{
+
+      std::vector<std::string> files = component.files("xml");
+      if (files.empty()){
+        return false;
+      }
+
+      boost::optional<double> vlt;
+      boost::optional<double> vltSpecular;
+      boost::optional<std::string> shadeType;
+      for (const Attribute& attribute : component.attributes()){
+        std::string attributeName = attribute.name();
+        if (istringEqual(attributeName, "Visible Light Transmittance")){
+          vlt = attribute.valueAsDouble();
+        } else if (istringEqual(attributeName, "Visible Light Transmittance Specular Percentage")) {
+          vltSpecular = attribute.valueAsDouble();
+        } else if (istringEqual(attributeName, "Interior Shade Layer Type")) {
+          shadeType = attribute.valueAsString();
+        }
+      }
+
+      if (!vlt || !vltSpecular || !shadeType){
+        return false;
+      }
+
+      addEntry(BSDFCatalogEntry(toPath(files[0]), *vlt, *vltSpecular, *shadeType));
+      return true;
+
+    } catch (const std::exception&) {
+      // attribute of the wrong type, not a BSDF component
+    }
+
+    return false;
+  }
+
+  void BSDFCatalog::addEntry(const BSDFCatalogEntry& entry)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    addEntryNoLock(entry);
+  }
+
+  void BSDFCatalog::addEntryNoLock(const BSDFCatalogEntry& entry)
+  {
+    // a component loaded again, e.g. from a reloaded LocalBCL, replaces its earlier entry
+    for (auto& shadeTypeEntries : m_entries){
+      std::vector<BSDFCatalogEntry>& entries = shadeTypeEntries.second;
+      entries.erase(std::remove_if(entries.begin(), entries.end(),
+        [&entry](const BSDFCatalogEntry& other) { return other.path() == entry.path(); }), entries.end());
+    }
+
+    std::vector<BSDFCatalogEntry>& entries = m_entries[boost::algorithm::to_upper_copy(entry.shadeType())];
+
+    // keep entries sorted by visible light transmittance, after any equal ones
+    auto it = std::upper_bound(entries.begin(), entries.end(), entry.visibleLightTransmittance(),
+      [](double vlt, const BSDFCatalogEntry& other) { return vlt < other.visibleLightTransmittance(); });
+    entries.insert(it, entry);
+  }
+
+  bool BSDFCatalog::localBCLLoaded() const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_localBCLLoaded;
+  }
+
+  void BSDFCatalog::clear()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+    m_localBCLLoaded = false;
+    m_localBCLDbPath.clear();
+    m_localBCLWriteTime = 0;
+  }
+
+  unsigned BSDFCatalog::size() const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    unsigned result = 0;
+    for (const auto& shadeTypeEntries : m_entries){
+      result += shadeTypeEntries.second.size();
+    }
+    return result;
+  }
+
+  std::vector<BSDFCatalogEntry> BSDFCatalog::entries() const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<BSDFCatalogEntry> result;
+    for (const auto& shadeTypeEntries : m_entries){
+      result.insert(result.end(), shadeTypeEntries.second.begin(), shadeTypeEntries.second.end());
+    }
+    return result;
+  }
+
+  boost::optional<BSDFCatalogEntry> BSDFCatalog::findNearest(double visibleLightTransmittance, double visibleLightTransmittanceSpecular,
+                                                             const std::string& shadeType, double visibleLightTransmittanceTolerance,
+                                                             double visibleLightTransmittanceSpecularTolerance)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto shadeTypeEntries = m_entries.find(boost::algorithm::to_upper_copy(shadeType));
+    if (shadeTypeEntries == m_entries.end()){
+      return boost::none;
+    }
+    std::vector<BSDFCatalogEntry>& entries = shadeTypeEntries->second;
+
+    // only entries within the transmittance tolerance need to be compared
+    auto it = std::lower_bound(entries.begin(), entries.end(), visibleLightTransmittance - visibleLightTransmittanceTolerance,
+      [](const BSDFCatalogEntry& entry, double vlt) { return entry.visibleLightTransmittance() < vlt; });
+
+    boost::optional<BSDFCatalogEntry> result;
+    double bestVltDiff = 0.0;
+    double bestVltSpecularDiff = 0.0;
+    while (it != entries.end()){
+      double vltDiff = std::abs(it->visibleLightTransmittance() - visibleLightTransmittance);
+      if (it->visibleLightTransmittance() > visibleLightTransmittance && vltDiff > visibleLightTransmittanceTolerance){
+        break;
+      }
+      double vltSpecularDiff = std::abs(it->visibleLightTransmittanceSpecular() - visibleLightTransmittanceSpecular);
+      if (vltDiff > visibleLightTransmittanceTolerance || vltSpecularDiff > visibleLightTransmittanceSpecularTolerance){
+        ++it;
+        continue;
+      }
+      if (!result || vltDiff < bestVltDiff || (vltDiff == bestVltDiff && vltSpecularDiff < bestVltSpecularDiff)){
+        // the file may have been removed from the BCL since it was indexed
+        if (!openstudio::filesystem::exists(it->path())){
+          LOG(Debug, "Removing BSDF file '" << toString(it->path()) << "' from the catalog, it no longer exists");
+          it = entries.erase(it);
+          continue;
+        }
+        result = *it;
+        bestVltDiff = vltDiff;
+        bestVltSpecularDiff = vltSpecularDiff;
+      }
+      ++it;
+    }
+
+    return result;
+  }
+
+} // radiance
+} // openstudio
@@ -0,0 +1,149 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#ifndef RADIANCE_BSDFCATALOG_HPP
+#define RADIANCE_BSDFCATALOG_HPP
+
+#include "RadianceAPI.hpp"
+
+#include "../utilities/core/Logger.hpp"
+#include "../utilities/core/Path.hpp"
+
+#include <boost/optional.hpp>
+
+#include <ctime>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace openstudio {
+
+  class BCLComponent;
+  class LocalBCL;
+
+namespace radiance {
+
+  /** A BSDFCatalogEntry is a BSDF file with the window properties it is looked up by.
+  */
+  class RADIANCE_API BSDFCatalogEntry{
+    public:
+      BSDFCatalogEntry(const openstudio::path& path, double visibleLightTransmittance,
+                       double visibleLightTransmittanceSpecular, const std::string& shadeType);
+
+      /// path to the BSDF xml file
+      openstudio::path path() const;
+
+      /// visible light transmittance, 0 to 1
+      double visibleLightTransmittance() const;
+
+      /// specular percentage of the visible light transmittance, 0 to 100
+      double visibleLightTransmittanceSpecular() const;
+
+      /// interior shade layer type
+      std::string shadeType() const;
+
+    private:
+      openstudio::path m_path;
+      double m_visibleLightTransmittance;
+      double m_visibleLightTransmittanceSpecular;
+      std::string m_shadeType;
+  };
+
+  /** BSDFCatalog is an in memory index of BSDF files, shared by all translations in the process.
+   *  Entries are loaded from BCL components, from the LocalBCL or from a directory of component
+   *  directories, and then looked up by visible light transmittance, specular percentage and shade type
+   *  without querying the BCL again. The LocalBCL is searched again only when its database changes, and
+   *  entries whose file has been removed are dropped when they are looked up.
+  */
+  class RADIANCE_API BSDFCatalog{
+    public:
+
+      /// the catalog shared by all translations
+      static BSDFCatalog& instance();
+
+      /// add the BSDF components of the LocalBCL, returns the number of entries added
+      /// does nothing if the same LocalBCL database was already loaded, unmodified, since the catalog was last cleared
+      unsigned loadLocalBCL(openstudio::LocalBCL& bcl);
+
+      /// add the BSDF components in the subdirectories of directory, each with a component.xml as in the LocalBCL,
+      /// returns the number of entries added
+      unsigned loadDirectory(const openstudio::path& directory);
+
+      /// add a BSDF component, returns false if it has no xml file or lacks the attributes to index it
+      bool addComponent(const openstudio::BCLComponent& component);
+
+      /// add an entry, replacing any entry with the same path
+      void addEntry(const BSDFCatalogEntry& entry);
+
+      /// true if loadLocalBCL has been called since the catalog was last cleared
+      bool localBCLLoaded() const;
+
+      /// remove all entries
+      void clear();
+
+      unsigned size() const;
+
+      /// all entries, ordered by shade type then visible light transmittance
+      std::vector<BSDFCatalogEntry> entries() const;
+
+      /// the entry of shadeType, case insensitive, closest in visible light transmittance and then in specular percentage,
+      /// considering only entries within the tolerances, entries whose file no longer exists are removed
+      boost::optional<BSDFCatalogEntry> findNearest(double visibleLightTransmittance, double visibleLightTransmittanceSpecular,
+                                                    const std::string& shadeType, double visibleLightTransmittanceTolerance = 0.01,
+                                                    double visibleLightTransmittanceSpecularTolerance = 0.01);
+
+    private:
+
+      BSDFCatalog();
+
+      REGISTER_LOGGER("openstudio.radiance.BSDFCatalog");
+
+      void addEntryNoLock(const BSDFCatalogEntry& entry);
+
+      mutable std::mutex m_mutex;
+
+      // held while loading the LocalBCL so it is only searched once
+      std::mutex m_localBCLMutex;
+
+      // entries by upper case shade type, each sorted by visible light transmittance
+      std::map<std::string, std::vector<BSDFCatalogEntry> > m_entries;
+
+      bool m_localBCLLoaded;
+
+      // database of the LocalBCL last loaded and its modification time then
+      openstudio::path m_localBCLDbPath;
+      std::time_t m_localBCLWriteTime;
+  };
+
+} // radiance
+} // openstudio
+
+#endif // RADIANCE_BSDFCATALOG_HPP
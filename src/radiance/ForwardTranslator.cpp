@@ -28,6 +28,7 @@
 ***********************************************************************************************************************/
 
 #include "ForwardTranslator.hpp"
+#include "BSDFCatalog.hpp"
 
 #include "../model/Building.hpp"
 #include "../model/Building_Impl.hpp"
@@ -77,6 +78,7 @@
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/core/PathHelpers.hpp"
 #include "../utilities/core/FilesystemHelpers.hpp"
+#include "../utilities/core/Parallel.hpp"
 #include "../utilities/time/DateTime.hpp"
 #include "../utilities/geometry/Geometry.hpp"
 #include "../utilities/geometry/Transformation.hpp"
@@ -86,6 +88,7 @@
 #include "../utilities/bcl/LocalBCL.hpp"
 
 
+#include <chrono>
 #include <thread>
 
 #include <boost/lexical_cast.hpp>
@@ -162,6 +165,12 @@ namespace radiance {
     return boost::lexical_cast<std::string>(t);
   }
 
+  // internal method used to time translation phases
+  static long long elapsedMilliseconds(const std::chrono::steady_clock::time_point& start)
+  {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+  }
+
   // basic constructor
   ForwardTranslator::ForwardTranslator()
     : m_windowGroupId(1) // m_windowGroupId is reserved for uncontrolled
@@ -173,6 +182,8 @@ namespace radiance {
 
   std::vector<openstudio::path> ForwardTranslator::translateModel(const openstudio::path& outPath, const openstudio::model::Model& model)
   {
+    auto phaseStart = std::chrono::steady_clock::now();
+
     m_model = model.clone(true).cast<openstudio::model::Model>();
 
     m_model.purgeUnusedResourceObjects();
@@ -274,6 +285,8 @@ namespace radiance {
       return outfiles;
     }
 
+    LOG(Debug, "Preprocessed model in " << elapsedMilliseconds(phaseStart) << " ms");
+
     // catch any directory or file related issues here
     try{
 
@@ -305,6 +318,7 @@ namespace radiance {
 
       // get site and building shading
       LOG(Debug, "Processing site/building shading elements...");
+      phaseStart = std::chrono::steady_clock::now();
 
       // get building shading
       buildingShadingSurfaceGroups(radDir, building.shadingSurfaceGroups(), outfiles);
@@ -312,9 +326,13 @@ namespace radiance {
       // get site shading
       siteShadingSurfaceGroups(radDir, site.shadingSurfaceGroups(), outfiles);
 
+      LOG(Debug, "Translated site/building shading in " << elapsedMilliseconds(phaseStart) << " ms");
+
       // get spaces
       buildingSpaces(radDir, building.spaces(), outfiles);
 
+      phaseStart = std::chrono::steady_clock::now();
+
       // write options files
       std::string dcmatsStringin;
       std::ifstream dcmatfilein(openstudio::toSystemFilename(radDir / openstudio::toPath("materials/materials_dc.rad")));
@@ -448,6 +466,8 @@ namespace radiance {
         LOG(Error, "Cannot open file '" << toString(mapsoptpath) << "' for writing");
       }
 
+      LOG(Debug, "Wrote options and skies in " << elapsedMilliseconds(phaseStart) << " ms");
+
       // the end
       LOG(Debug, "Done. Radiance model located at: " << openstudio::toString(radDir) << ".");
 
@@ -488,8 +508,23 @@ namespace radiance {
 
   openstudio::Point3dVectorVector ForwardTranslator::getPolygons(const openstudio::model::Surface& surface)
   {
-    openstudio::Point3dVectorVector result;
+    std::vector<Point3dVector> subSurfaceVertices;
+    for (const SubSurface& subSurface : surface.subSurfaces()){
+      subSurfaceVertices.push_back(subSurface.vertices());
+    }
+
+    openstudio::Point3dVectorVector result = getPolygons(surface.vertices(), subSurfaceVertices, surfaceTransformation(surface));
+
+    if (result.empty()) {
+      // DLM: is this an error (fail simulation) or a warning?  Should we attempt to put the whole surface in here?
+      LOG(Warn, "Failed to create surface polygons for Surface '" << surface.nameString() << "'");
+    }
 
+    return result;
+  }
+
+  openstudio::Transformation ForwardTranslator::surfaceTransformation(const openstudio::model::Surface& surface)
+  {
     Transformation buildingTransformation;
     OptionalBuilding building = surface.model().getOptionalUniqueModelObject<Building>();
     if (building){
@@ -502,19 +537,28 @@ namespace radiance {
       spaceTransformation = space->transformation();
     }
 
+    return buildingTransformation*spaceTransformation;
+  }
+
+  openstudio::Point3dVectorVector ForwardTranslator::getPolygons(const openstudio::Point3dVector& vertices,
+                                                                 const std::vector<openstudio::Point3dVector>& subSurfaceVertices,
+                                                                 const openstudio::Transformation& transformation)
+  {
+    openstudio::Point3dVectorVector result;
+
     // transformation from space coordinates to face coordinates
-    Transformation alignFace = Transformation::alignFace(surface.vertices());
+    Transformation alignFace = Transformation::alignFace(vertices);
 
     // get the current vertices and convert to face coordinates
-    Point3dVector surfaceFaceVertices = alignFace.inverse()*surface.vertices();
+    Point3dVector surfaceFaceVertices = alignFace.inverse()*vertices;
 
     // boost polygon wants vertices in clockwise order, faceVertices must be reversed, otherFaceVertices already CCW
     std::reverse(surfaceFaceVertices.begin(), surfaceFaceVertices.end());
 
     // get the current subsurfaces and convert to face coordinates
     std::vector<std::vector<Point3d> > holes;
-    for (const SubSurface& subSurface : surface.subSurfaces()){
-      Point3dVector hole = alignFace.inverse()*subSurface.vertices();
+    for (const Point3dVector& subSurface : subSurfaceVertices){
+      Point3dVector hole = alignFace.inverse()*subSurface;
       std::reverse(hole.begin(), hole.end());
       holes.push_back(hole);
     }
@@ -522,14 +566,9 @@ namespace radiance {
     // perform the subtraction
     std::vector<std::vector<Point3d> > faceResult = openstudio::subtract(surfaceFaceVertices, holes, 0.01);
 
-    if (faceResult.empty()) {
-      // DLM: is this an error (fail simulation) or a warning?  Should we attempt to put the whole surface in here?
-      LOG(Warn, "Failed to create surface polygons for Surface '" << surface.nameString() << "'");
-    }
-
     // convert to absolute coordinates
     for (const Point3dVector& face : faceResult) {
-      Point3dVector worldFace = buildingTransformation*spaceTransformation*alignFace*face;
+      Point3dVector worldFace = transformation*alignFace*face;
       std::reverse(worldFace.begin(), worldFace.end());
       result.push_back(worldFace);
     }
@@ -537,6 +576,53 @@ namespace radiance {
     return result;
   }
 
+  void ForwardTranslator::computeSurfaceGeometry(const std::vector<openstudio::model::Space>& t_spaces)
+  {
+    // the model is only read here, on the calling thread
+    std::vector<openstudio::Handle> handles;
+    std::vector<Point3dVector> vertices;
+    std::vector<std::vector<Point3dVector> > subSurfaceVertices;
+    std::vector<Transformation> transformations;
+    m_subSurfacePolygons = PolygonBatch();
+    m_subSurfacePolygonIndices.clear();
+    for (const auto & space : t_spaces){
+      for (const auto & surface : space.surfaces()){
+        if (surface.isAirWall()){
+          continue;
+        }
+        handles.push_back(surface.handle());
+        vertices.push_back(surface.vertices());
+        subSurfaceVertices.push_back(std::vector<Point3dVector>());
+        for (const SubSurface& subSurface : surface.subSurfaces()){
+          subSurfaceVertices.back().push_back(subSurface.vertices());
+          m_subSurfacePolygonIndices[subSurface.handle()] = m_subSurfacePolygons.addPolygon(getPolygon(subSurface));
+        }
+        transformations.push_back(surfaceTransformation(surface));
+      }
+    }
+
+    // polygon subtraction and vertex formatting do not touch the model or the log
+    std::vector<SurfaceGeometry> geometries(handles.size());
+    parallelFor(handles.size(), [&](size_t i) {
+      SurfaceGeometry& geometry = geometries[i];
+      geometry.polygons = getPolygons(vertices[i], subSurfaceVertices[i], transformations[i]);
+      for (const Point3dVector& polygon : geometry.polygons){
+        std::string polygonVertices;
+        for (const auto & vertex : polygon){
+          polygonVertices += formatString(vertex.x()) + " "
+            + formatString(vertex.y()) + " "
+            + formatString(vertex.z()) + "\n";
+        }
+        geometry.polygonVertices.push_back(polygonVertices);
+      }
+    }, 16);
+
+    m_surfaceGeometry.clear();
+    for (size_t i = 0; i < handles.size(); ++i){
+      m_surfaceGeometry[handles[i]] = std::move(geometries[i]);
+    }
+  }
+
   openstudio::Point3dVector ForwardTranslator::getPolygon(const openstudio::model::SubSurface& subSurface)
   {
     Transformation buildingTransformation;
@@ -838,6 +924,10 @@ namespace radiance {
 
     m_radDCmats.clear();
 
+    m_surfaceGeometry.clear();
+    m_subSurfacePolygons = PolygonBatch();
+    m_subSurfacePolygonIndices.clear();
+
     m_radSceneFiles.clear();
 
     m_radSpaces.clear();
@@ -1068,6 +1158,12 @@ namespace radiance {
   {
     std::vector<std::string> space_names;
 
+    auto phaseStart = std::chrono::steady_clock::now();
+
+    computeSurfaceGeometry(t_spaces);
+
+    LOG(Debug, "Computed surface polygons in " << elapsedMilliseconds(phaseStart) << " ms");
+    phaseStart = std::chrono::steady_clock::now();
 
     for (const auto & space : t_spaces)
     {
@@ -1113,8 +1209,13 @@ namespace radiance {
         }
 
         // create polygon object
-        openstudio::Point3dVectorVector polygons = openstudio::radiance::ForwardTranslator::getPolygons(surface);
-        for (const openstudio::Point3dVector& polygon : polygons) {
+        const SurfaceGeometry& geometry = m_surfaceGeometry[surface.handle()];
+        if (geometry.polygons.empty()) {
+          // DLM: is this an error (fail simulation) or a warning?  Should we attempt to put the whole surface in here?
+          LOG(Warn, "Failed to create surface polygons for Surface '" << surface.nameString() << "'");
+        }
+        for (size_t polygonIndex = 0; polygonIndex < geometry.polygons.size(); ++polygonIndex) {
+          const openstudio::Point3dVector& polygon = geometry.polygons[polygonIndex];
 
           if (!surface.adjacentSurface()) {
             // 2-sided material
@@ -1165,12 +1266,7 @@ namespace radiance {
           };
 
           // add polygon vertices
-          for (const auto & vertex : polygon)
-          {
-            m_radSpaces[space_name] += formatString(vertex.x()) + " "
-              + formatString(vertex.y()) + " "
-              + formatString(vertex.z()) + "\n";
-          }
+          m_radSpaces[space_name] += geometry.polygonVertices[polygonIndex];
           m_radSpaces[space_name] += "\n";
 
         }
@@ -1197,7 +1293,8 @@ namespace radiance {
           boost::optional<model::WindowPropertyFrameAndDivider> frameAndDivider = subSurface.windowPropertyFrameAndDivider();
 
           // get the polygon
-          openstudio::Point3dVector polygon = openstudio::radiance::ForwardTranslator::getPolygon(subSurface);
+          unsigned subSurfacePolygonIndex = m_subSurfacePolygonIndices[subSurface.handle()];
+          openstudio::Point3dVector polygon = m_subSurfacePolygons.vertices(subSurfacePolygonIndex);
 
           std::string subSurface_name = cleanName(subSurface.name().get());
 
@@ -1397,8 +1494,7 @@ namespace radiance {
             openstudio::Vector3d offset;
 
             // subSurface.outwardNormal not in global coordinate system
-            outwardNormal = subSurface.outwardNormal();
-            boost::optional<Vector3d> optionalOutwardNormal = openstudio::getOutwardNormal(polygon);
+            boost::optional<Vector3d> optionalOutwardNormal = m_subSurfacePolygons.outwardNormal(subSurfacePolygonIndex);
             if (optionalOutwardNormal){
               Vector3d outwardNormal = *optionalOutwardNormal;
 
@@ -2096,160 +2192,170 @@ namespace radiance {
       } else{
         LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
       }
+    } // end spaces
 
-      for (const auto & windowGroup : m_windowGroups)
-      {
-        std::string windowGroup_name = windowGroup.name();
+    LOG(Debug, "Generated space scenes in " << elapsedMilliseconds(phaseStart) << " ms");
+    phaseStart = std::chrono::steady_clock::now();
 
-        //write windows (and glazed doors)
-        if (m_radWindowGroups.find(windowGroup_name) != m_radWindowGroups.end())
-        {
+    // window groups and materials are shared by all spaces, write them once all spaces are done
+    if (t_spaces.empty()){
+      return;
+    }
 
-          // get the Radiance parameters... so we have them.
-          openstudio::model::RadianceParameters radianceParameters = m_model.getUniqueModelObject<openstudio::model::RadianceParameters>();
-          if(windowGroup_name != "WG0"){
-            if (radianceParameters.skyDiscretizationResolution() == "146"){
-              LOG(Info, "writing out window group '" + windowGroup_name + "', using Klems sampling basis.");
-            } else if (radianceParameters.skyDiscretizationResolution() == "578"){
-              LOG(Warn, "writing out window group '" + windowGroup_name + "', but sampling basis was reset to Klems (145).");
-            } else if (radianceParameters.skyDiscretizationResolution() == "2306"){
-              LOG(Warn, "writing out window group '" + windowGroup_name + "', but sampling basis was reset to Klems (145).");
-            }
-          }
+    for (const auto & windowGroup : m_windowGroups)
+    {
+      std::string windowGroup_name = windowGroup.name();
 
-          openstudio::path glazefilename = t_radDir / openstudio::toPath("scene/glazing") / openstudio::toPath(windowGroup_name + ".rad");
-          OFSTREAM glazefile(glazefilename);
-          if (glazefile.is_open()){
-            t_outfiles.push_back(glazefilename);
-            m_radSceneFiles.push_back(glazefilename);
-            glazefile << m_radWindowGroups[windowGroup_name];
-          } else{
-            LOG(Error, "Cannot open file '" << toString(glazefilename) << "' for writing");
+      //write windows (and glazed doors)
+      if (m_radWindowGroups.find(windowGroup_name) != m_radWindowGroups.end())
+      {
+
+        // get the Radiance parameters... so we have them.
+        openstudio::model::RadianceParameters radianceParameters = m_model.getUniqueModelObject<openstudio::model::RadianceParameters>();
+        if(windowGroup_name != "WG0"){
+          if (radianceParameters.skyDiscretizationResolution() == "146"){
+            LOG(Info, "writing out window group '" + windowGroup_name + "', using Klems sampling basis.");
+          } else if (radianceParameters.skyDiscretizationResolution() == "578"){
+            LOG(Warn, "writing out window group '" + windowGroup_name + "', but sampling basis was reset to Klems (145).");
+          } else if (radianceParameters.skyDiscretizationResolution() == "2306"){
+            LOG(Warn, "writing out window group '" + windowGroup_name + "', but sampling basis was reset to Klems (145).");
           }
+        }
 
-          if(windowGroup_name != "WG0" && !m_radWindowGroupShades[windowGroup_name].empty()){
-            openstudio::path shadefilename = t_radDir / openstudio::toPath("scene/shades") / openstudio::toPath(windowGroup_name + "_SHADE.rad");
-            OFSTREAM shadefile(shadefilename);
-            if (shadefile.is_open()){
-              t_outfiles.push_back(shadefilename);
-              m_radSceneFiles.push_back(shadefilename);
-              shadefile << m_radWindowGroupShades[windowGroup_name];
-            } else{
-              LOG(Error, "Cannot open file '" << toString(shadefilename) << "' for writing");
-            }
+        openstudio::path glazefilename = t_radDir / openstudio::toPath("scene/glazing") / openstudio::toPath(windowGroup_name + ".rad");
+        OFSTREAM glazefile(glazefilename);
+        if (glazefile.is_open()){
+          t_outfiles.push_back(glazefilename);
+          m_radSceneFiles.push_back(glazefilename);
+          glazefile << m_radWindowGroups[windowGroup_name];
+        } else{
+          LOG(Error, "Cannot open file '" << toString(glazefilename) << "' for writing");
+        }
+
+        if(windowGroup_name != "WG0" && !m_radWindowGroupShades[windowGroup_name].empty()){
+          openstudio::path shadefilename = t_radDir / openstudio::toPath("scene/shades") / openstudio::toPath(windowGroup_name + "_SHADE.rad");
+          OFSTREAM shadefile(shadefilename);
+          if (shadefile.is_open()){
+            t_outfiles.push_back(shadefilename);
+            m_radSceneFiles.push_back(shadefilename);
+            shadefile << m_radWindowGroupShades[windowGroup_name];
+          } else{
+            LOG(Error, "Cannot open file '" << toString(shadefilename) << "' for writing");
           }
+        }
 
-          // write window group control points
-          // only write for controlled window groups
-          if(windowGroup_name != "WG0"){
-            openstudio::path filename = t_radDir / openstudio::toPath("numeric") / openstudio::toPath(windowGroup_name + ".pts");
-            OFSTREAM file(filename);
-            if (file.is_open()){
-              t_outfiles.push_back(filename);
-              file << windowGroup.windowGroupPoints();
-            } else{
-              LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
-            }
+        // write window group control points
+        // only write for controlled window groups
+        if(windowGroup_name != "WG0"){
+          openstudio::path filename = t_radDir / openstudio::toPath("numeric") / openstudio::toPath(windowGroup_name + ".pts");
+          OFSTREAM file(filename);
+          if (file.is_open()){
+            t_outfiles.push_back(filename);
+            file << windowGroup.windowGroupPoints();
+          } else{
+            LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
           }
         }
       }
+    }
 
-      // write radiance materials file
-      m_radMaterials.insert("# OpenStudio Materials File\n\n");
-      openstudio::path materialsfilename = t_radDir / openstudio::toPath("materials/materials.rad");
-      OFSTREAM materialsfile(materialsfilename);
-      if (materialsfile.is_open()){
-        t_outfiles.push_back(materialsfilename);
-        for (const auto & line : m_radMaterials)
-        {
-          materialsfile << line;
-        };
-        for (const auto & line : m_radMixMaterials)
-        {
-          materialsfile << line;
-        };
-      } else{
-        LOG(Error, "Cannot open file '" << toString(materialsfilename) << "' for writing");
-      }
+    // write radiance materials file
+    m_radMaterials.insert("# OpenStudio Materials File\n\n");
+    openstudio::path materialsfilename = t_radDir / openstudio::toPath("materials/materials.rad");
+    OFSTREAM materialsfile(materialsfilename);
+    if (materialsfile.is_open()){
+      t_outfiles.push_back(materialsfilename);
+      for (const auto & line : m_radMaterials)
+      {
+        materialsfile << line;
+      };
+      for (const auto & line : m_radMixMaterials)
+      {
+        materialsfile << line;
+      };
+    } else{
+      LOG(Error, "Cannot open file '" << toString(materialsfilename) << "' for writing");
+    }
 
 
-      // write radiance DC vmx materials (lights) file
-      m_radMaterialsDC.insert("# OpenStudio \"vmx\" Materials File\n# controlled windows: material=\"light\", black out all others.\n\nvoid plastic WG0\n0\n0\n5\n0 0 0 0 0\n\n");
-      openstudio::path materials_vmxfilename = t_radDir / openstudio::toPath("materials/materials_vmx.rad");
-      OFSTREAM materials_vmxfile(materials_vmxfilename);
-      if (materials_vmxfile.is_open()){
-        t_outfiles.push_back(materials_vmxfilename);
-        for (const auto & line : m_radMaterialsDC)
-        {
-          materials_vmxfile << line;
-        };
-      } else{
-        LOG(Error, "Cannot open file '" << toString(materials_vmxfilename) << "' for writing");
-      }
+    // write radiance DC vmx materials (lights) file
+    m_radMaterialsDC.insert("# OpenStudio \"vmx\" Materials File\n# controlled windows: material=\"light\", black out all others.\n\nvoid plastic WG0\n0\n0\n5\n0 0 0 0 0\n\n");
+    openstudio::path materials_vmxfilename = t_radDir / openstudio::toPath("materials/materials_vmx.rad");
+    OFSTREAM materials_vmxfile(materials_vmxfilename);
+    if (materials_vmxfile.is_open()){
+      t_outfiles.push_back(materials_vmxfilename);
+      for (const auto & line : m_radMaterialsDC)
+      {
+        materials_vmxfile << line;
+      };
+    } else{
+      LOG(Error, "Cannot open file '" << toString(materials_vmxfilename) << "' for writing");
+    }
 
 
-      // write radiance WG0 vmx materials file (blacks out controlled window groups)
-      m_radMaterialsWG0.insert("# OpenStudio \"WG0\" Materials File\n# black out all controlled window groups.\n");
-      openstudio::path materials_WG0filename = t_radDir / openstudio::toPath("materials/materials_WG0.rad");
-      OFSTREAM materials_WG0file(materials_WG0filename);
-      if (materials_WG0file.is_open()){
-        t_outfiles.push_back(materials_WG0filename);
-        for (const auto & line : m_radMaterialsWG0)
-        {
-          materials_WG0file << line;
-        };
-      } else{
-        LOG(Error, "Cannot open file '" << toString(materials_WG0filename) << "' for writing");
-      }
+    // write radiance WG0 vmx materials file (blacks out controlled window groups)
+    m_radMaterialsWG0.insert("# OpenStudio \"WG0\" Materials File\n# black out all controlled window groups.\n");
+    openstudio::path materials_WG0filename = t_radDir / openstudio::toPath("materials/materials_WG0.rad");
+    OFSTREAM materials_WG0file(materials_WG0filename);
+    if (materials_WG0file.is_open()){
+      t_outfiles.push_back(materials_WG0filename);
+      for (const auto & line : m_radMaterialsWG0)
+      {
+        materials_WG0file << line;
+      };
+    } else{
+      LOG(Error, "Cannot open file '" << toString(materials_WG0filename) << "' for writing");
+    }
 
-      // write radiance blackout materials file (blacks out everything)
-      m_radMaterialsSwitchableBase.insert("# OpenStudio Blackout Materials File\n# black out all window and shade materials.\n\nvoid plastic WG0\n0\n0\n5\n0 0 0 0 0\n\n");
-      openstudio::path materials_SwitchableBasefilename = t_radDir / openstudio::toPath("materials/materials_blackout.rad");
-      OFSTREAM materials_SwitchableBasefile(materials_SwitchableBasefilename);
-      if (materials_SwitchableBasefile.is_open()){
-        t_outfiles.push_back(materials_SwitchableBasefilename);
-        for (const auto & line : m_radMaterialsSwitchableBase)
-        {
-          materials_SwitchableBasefile << line;
-        };
-      } else{
-        LOG(Error, "Cannot open file '" << toString(materials_SwitchableBasefilename) << "' for writing");
-      }
+    // write radiance blackout materials file (blacks out everything)
+    m_radMaterialsSwitchableBase.insert("# OpenStudio Blackout Materials File\n# black out all window and shade materials.\n\nvoid plastic WG0\n0\n0\n5\n0 0 0 0 0\n\n");
+    openstudio::path materials_SwitchableBasefilename = t_radDir / openstudio::toPath("materials/materials_blackout.rad");
+    OFSTREAM materials_SwitchableBasefile(materials_SwitchableBasefilename);
+    if (materials_SwitchableBasefile.is_open()){
+      t_outfiles.push_back(materials_SwitchableBasefilename);
+      for (const auto & line : m_radMaterialsSwitchableBase)
+      {
+        materials_SwitchableBasefile << line;
+      };
+    } else{
+      LOG(Error, "Cannot open file '" << toString(materials_SwitchableBasefilename) << "' for writing");
+    }
 
 
-      // write radiance vmx materials list
-      // format of this file is: window group, bsdf, bsdf
-      m_radDCmats.insert("# OpenStudio windowGroup->BSDF \"Mapping\" File\n# windowGroup,inwardNormal,shade control type,shade control setpoint,unshaded bsdf,shaded bsdf\n");
-      openstudio::path materials_dcfilename = t_radDir / openstudio::toPath("bsdf/mapping.rad");
-      OFSTREAM materials_dcfile(materials_dcfilename);
-      if (materials_dcfile.is_open()){
-        t_outfiles.push_back(materials_dcfilename);
-        for (const auto & line : m_radDCmats)
-        {
-          materials_dcfile << line;
-        };
-      } else{
-        LOG(Error, "Cannot open file '" << toString(materials_dcfilename) << "' for writing");
-      }
+    // write radiance vmx materials list
+    // format of this file is: window group, bsdf, bsdf
+    m_radDCmats.insert("# OpenStudio windowGroup->BSDF \"Mapping\" File\n# windowGroup,inwardNormal,shade control type,shade control setpoint,unshaded bsdf,shaded bsdf\n");
+    openstudio::path materials_dcfilename = t_radDir / openstudio::toPath("bsdf/mapping.rad");
+    OFSTREAM materials_dcfile(materials_dcfilename);
+    if (materials_dcfile.is_open()){
+      t_outfiles.push_back(materials_dcfilename);
+      for (const auto & line : m_radDCmats)
+      {
+        materials_dcfile << line;
+      };
+    } else{
+      LOG(Error, "Cannot open file '" << toString(materials_dcfilename) << "' for writing");
+    }
 
 
-      // write complete scene
-      openstudio::path modelfilename = t_radDir / openstudio::toPath("model.rad");
-      OFSTREAM modelfile(modelfilename);
+    // write complete scene
+    openstudio::path modelfilename = t_radDir / openstudio::toPath("model.rad");
+    OFSTREAM modelfile(modelfilename);
 
-      if (modelfile.is_open()){
-        t_outfiles.push_back(modelfilename);
+    if (modelfile.is_open()){
+      t_outfiles.push_back(modelfilename);
 
-        std::set<openstudio::path> uniquePaths(m_radSceneFiles.begin(), m_radSceneFiles.end());
+      std::set<openstudio::path> uniquePaths(m_radSceneFiles.begin(), m_radSceneFiles.end());
 
-        for (const auto & filename : uniquePaths)
-        {
-          modelfile << "!xform ./" << openstudio::toString(openstudio::relativePath(filename, t_radDir)) << std::endl;
-        }
-      } else{
-        LOG(Error, "Cannot open file '" << toString(modelfilename) << "' for writing");
+      for (const auto & filename : uniquePaths)
+      {
+        modelfile << "!xform ./" << openstudio::toString(openstudio::relativePath(filename, t_radDir)) << std::endl;
       }
+    } else{
+      LOG(Error, "Cannot open file '" << toString(modelfilename) << "' for writing");
     }
+
+    LOG(Debug, "Wrote window groups and materials in " << elapsedMilliseconds(phaseStart) << " ms");
   }
 
   boost::optional<openstudio::path> ForwardTranslator::getBSDF(double vlt, double vltSpecular, const std::string& shadeType)
@@ -2257,66 +2363,27 @@ namespace radiance {
     std::string searchTerm = "BSDF";
     unsigned tid = 1316; // "Construction Assembly.Fenestration.Window";
 
-    boost::optional<std::string> result;
+    // the LocalBCL is searched once per process, then BSDF files are looked up in memory
+    BSDFCatalog& catalog = BSDFCatalog::instance();
+    catalog.loadLocalBCL(openstudio::LocalBCL::instance());
 
-    openstudio::LocalBCL& localBCL = openstudio::LocalBCL::instance();
-    result = getBSDF(localBCL, vlt, vltSpecular, shadeType, searchTerm, tid);
-    if (result){
-      return toPath(*result);
+    boost::optional<BSDFCatalogEntry> entry = catalog.findNearest(vlt, vltSpecular, shadeType);
+    if (entry){
+      return entry->path();
     }
 
     openstudio::RemoteBCL remoteBCL;
-    result = getBSDF(remoteBCL, vlt, vltSpecular, shadeType, searchTerm, tid);
-    if (result){
-      return toPath(*result);
-    }
-
-    return boost::none;
-  }
-
-  boost::optional<std::string> ForwardTranslator::getBSDF(openstudio::LocalBCL& bcl, double vlt, double vltSpecular, const std::string& shadeType, const std::string& searchTerm, unsigned tid)
-  {
-    std::vector<BCLComponent> results = bcl.searchComponents(searchTerm, tid);
-    for (const BCLComponent& result : results){
-
-      try{
-
-        if (result.files("xml").empty()){
-          continue;
-        }
-
-        double vltDiff = std::numeric_limits<double>::max();
-        double vltSpecularDiff = std::numeric_limits<double>::max();
-        bool shadeTypeMatch = false;
-        for (const Attribute& attribute : result.attributes()){
-          std::string attributeName = attribute.name();
-          if (istringEqual(attributeName, "Visible Light Transmittance")){
-            vltDiff = std::abs(attribute.valueAsDouble() - vlt);
-          } else if (istringEqual(attributeName, "Visible Light Transmittance Specular Percentage")) {
-            vltSpecularDiff = std::abs(attribute.valueAsDouble() - vltSpecular);
-          } else if (istringEqual(attributeName, "Interior Shade Layer Type")) {
-            shadeTypeMatch = istringEqual(attribute.valueAsString(), shadeType);
-          }
-        }
-
-        // check if meets criteria
-        if (vltDiff <= 0.01 && vltSpecularDiff <= 0.01 && shadeTypeMatch){
-          // this one works try to get payload
-          std::vector<std::string> files = result.files("xml");
-          if (files.size() > 0){
-            return files[0];
-          }
-        }
-
-      } catch (const std::exception&) {
-        // not the right one
-      }
+    boost::optional<BCLComponent> component = getBSDF(remoteBCL, vlt, vltSpecular, shadeType, searchTerm, tid);
+    if (component){
+      // the download is in the LocalBCL now, index it by its own attributes for later translations
+      catalog.addComponent(*component);
+      return toPath(component->files("xml")[0]);
     }
 
     return boost::none;
   }
 
-  boost::optional<std::string> ForwardTranslator::getBSDF(openstudio::RemoteBCL& bcl, double vlt, double vltSpecular, const std::string& shadeType, const std::string& searchTerm, unsigned tid)
+  boost::optional<BCLComponent> ForwardTranslator::getBSDF(openstudio::RemoteBCL& bcl, double vlt, double vltSpecular, const std::string& shadeType, const std::string& searchTerm, unsigned tid)
   {
     boost::optional<BCLMetaSearchResult> metaResult = bcl.metaSearchComponentLibrary(searchTerm, tid);
     if (metaResult){
@@ -2361,11 +2428,8 @@ namespace radiance {
             if (vltDiff <= 0.01 && vltSpecularDiff <= 1 && shadeTypeMatch){
               // this one works try to get payload
               boost::optional<BCLComponent> component = bcl.getComponent(result.uid());
-              if (component){
-                std::vector<std::string> files = component->files("xml");
-                if (files.size() > 0){
-                  return files[0];
-                }
+              if (component && !component->files("xml").empty()){
+                return component;
               }
             }
 
@@ -45,14 +45,16 @@
 
 #include "../utilities/geometry/Point3d.hpp"
 #include "../utilities/geometry/Vector3d.hpp"
+#include "../utilities/geometry/Transformation.hpp"
+#include "../utilities/geometry/PolygonBatch.hpp"
 
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/StringStreamLogSink.hpp"
 
 namespace openstudio {
 
+  class BCLComponent;
   class RemoteBCL;
-  class LocalBCL;
 
 namespace radiance {
 
@@ -174,10 +176,34 @@ namespace radiance {
           const std::vector<openstudio::model::Space> &t_spaces,
           std::vector<openstudio::path> &t_outpaths);
 
-    // get a bsdf possibly from the BCL
+      // polygons of a surface with sub surfaces subtracted, and the formatted vertices of each polygon
+      struct SurfaceGeometry
+      {
+        openstudio::Point3dVectorVector polygons;
+        std::vector<std::string> polygonVertices;
+      };
+
+      // geometry of all space surfaces, computed on several threads before the spaces are translated
+      std::map<openstudio::Handle, SurfaceGeometry> m_surfaceGeometry;
+
+      // sub surface polygons in absolute coordinates, their outward normals are computed in one pass
+      openstudio::PolygonBatch m_subSurfacePolygons;
+      std::map<openstudio::Handle, unsigned> m_subSurfacePolygonIndices;
+
+      void computeSurfaceGeometry(const std::vector<openstudio::model::Space>& t_spaces);
+
+      // building and space transformation of a surface
+      static openstudio::Transformation surfaceTransformation(const openstudio::model::Surface& surface);
+
+      // subtract sub surface vertices from surface vertices, both in space coordinates, and transform the result
+      static openstudio::Point3dVectorVector getPolygons(const openstudio::Point3dVector& vertices,
+                                                         const std::vector<openstudio::Point3dVector>& subSurfaceVertices,
+                                                         const openstudio::Transformation& transformation);
+
+    // get a bsdf from the BSDFCatalog, or else from the remote BCL
     boost::optional<openstudio::path> getBSDF(double vlt, double vltSpecular, const std::string& shadeType);
-    boost::optional<std::string> getBSDF(openstudio::LocalBCL& bcl, double vlt, double vltSpecular, const std::string& shadeType, const std::string& searchTerm, unsigned tid);
-    boost::optional<std::string> getBSDF(openstudio::RemoteBCL& bcl, double vlt, double vltSpecular, const std::string& shadeType, const std::string& searchTerm, unsigned tid);
+    // download a bsdf component from the remote BCL into the LocalBCL
+    boost::optional<openstudio::BCLComponent> getBSDF(openstudio::RemoteBCL& bcl, double vlt, double vltSpecular, const std::string& shadeType, const std::string& searchTerm, unsigned tid);
 
 
     StringStreamLogSink m_logSink;
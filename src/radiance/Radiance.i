@@ -16,6 +16,7 @@
 
 %{
   #include <radiance/ForwardTranslator.hpp>
+  #include <radiance/BSDFCatalog.hpp>
   #include <radiance/Utils.hpp>
   using namespace openstudio::radiance;
   using namespace openstudio;
@@ -29,6 +30,13 @@
 // #endif
 
 %include <radiance/ForwardTranslator.hpp>
+
+%template(OptionalBSDFCatalogEntry) boost::optional<openstudio::radiance::BSDFCatalogEntry>;
+%template(BSDFCatalogEntryVector) std::vector<openstudio::radiance::BSDFCatalogEntry>;
+%ignore openstudio::radiance::BSDFCatalog::loadLocalBCL;
+%ignore openstudio::radiance::BSDFCatalog::addComponent;
+%include <radiance/BSDFCatalog.hpp>
+
 %include <radiance/Utils.hpp>
 
 #endif //RADIANCE_RADIANCE_I
@@ -31,8 +31,13 @@
 
 #include "../AnnualIlluminanceMap.hpp"
 
+#include "../../utilities/core/Filesystem.hpp"
+
 #include <resources.hxx>
 
+#include <chrono>
+#include <sstream>
+
 
 
 using namespace std;
@@ -80,3 +85,147 @@ TEST_F(RadAnnualIlluminanceMapFixture, AnnualIlluminanceMap)
 
 }
 
+// writes an illuminance map with a 3 x 3 grid, value p of row k is 100 * k + p + 0.25 footcandles
+static openstudio::path writeTestMap(const std::string& fileName, unsigned numRows, bool badLastRow)
+{
+  openstudio::path path = openstudio::tempDir() / toPath(fileName);
+  openstudio::filesystem::ofstream file(path, std::ios_base::trunc);
+  file << "0 0 0\t2 0 0\t0 1 0\n";
+  file << "1 0.5 0\n";
+  for (unsigned k = 0; k < numRows; ++k){
+    unsigned month = 1 + (k % 12);
+    unsigned day = 1 + (k % 28);
+    double hours = 0.5 + (k % 24);
+    file << month << " " << day << " " << hours << " 10.5 -3.25 1.5e2";
+    unsigned numValues = (badLastRow && k + 1 == numRows) ? 8 : 9;
+    for (unsigned p = 0; p < numValues; ++p){
+      file << ((p % 2) ? "\t" : " ") << 100.0 * k + p + 0.25;
+    }
+    file << "\r\n";
+  }
+  return path;
+}
+
+TEST_F(RadAnnualIlluminanceMapFixture, AnnualIlluminanceMap_Parse)
+{
+  openstudio::path path = writeTestMap("AnnualIlluminanceMap_Parse.ill", 3, false);
+  AnnualIlluminanceMap map(path);
+
+  ASSERT_EQ(3u, map.xVector().size());
+  ASSERT_EQ(3u, map.yVector().size());
+  EXPECT_DOUBLE_EQ(2.0, map.xVector()[2]);
+  EXPECT_DOUBLE_EQ(0.5, map.yVector()[1]);
+  EXPECT_EQ(9u, map.numPoints());
+
+  openstudio::DateTimeVector dateTimes = map.dateTimes();
+  ASSERT_EQ(3u, dateTimes.size());
+  EXPECT_EQ(openstudio::DateTime(openstudio::Date(openstudio::MonthOfYear::Feb, 2), openstudio::Time(0, 1, 30)), dateTimes[1]);
+
+  const std::vector<double>& values = map.illuminanceValues();
+  ASSERT_EQ(27u, values.size());
+  for (unsigned k = 0; k < 3; ++k){
+    openstudio::Matrix illuminance = map.illuminanceMap(dateTimes[k]);
+    ASSERT_EQ(3u, illuminance.size1());
+    ASSERT_EQ(3u, illuminance.size2());
+    for (unsigned j = 0; j < 3; ++j){
+      for (unsigned i = 0; i < 3; ++i){
+        unsigned p = j * 3 + i;
+        EXPECT_DOUBLE_EQ(10.76 * (100.0 * k + p + 0.25), illuminance(i, j));
+        EXPECT_DOUBLE_EQ(illuminance(i, j), values[k * 9 + p]);
+      }
+    }
+  }
+
+  EXPECT_EQ(0u, map.illuminanceMap(openstudio::DateTime(openstudio::Date(openstudio::MonthOfYear::Mar, 3))).size1());
+
+  openstudio::filesystem::remove(path);
+}
+
+TEST_F(RadAnnualIlluminanceMapFixture, AnnualIlluminanceMap_BadRow)
+{
+  // reading stops at the row with too few values
+  openstudio::path path = writeTestMap("AnnualIlluminanceMap_BadRow.ill", 3, true);
+  AnnualIlluminanceMap map(path);
+  EXPECT_EQ(2u, map.dateTimes().size());
+  EXPECT_EQ(18u, map.illuminanceValues().size());
+
+  openstudio::filesystem::remove(path);
+
+  // a path that exists but cannot be read as a file gives an empty map
+  AnnualIlluminanceMap directoryMap(openstudio::tempDir());
+  EXPECT_TRUE(directoryMap.dateTimes().empty());
+  EXPECT_TRUE(directoryMap.illuminanceValues().empty());
+  EXPECT_FALSE(AnnualIlluminanceMap::loadBinary(openstudio::tempDir()));
+}
+
+TEST_F(RadAnnualIlluminanceMapFixture, AnnualIlluminanceMap_Binary)
+{
+  openstudio::path path = writeTestMap("AnnualIlluminanceMap_Binary.ill", 30, false);
+  openstudio::path binaryPath = openstudio::tempDir() / toPath("AnnualIlluminanceMap_Binary.bin");
+  AnnualIlluminanceMap map(path);
+  ASSERT_EQ(30u, map.dateTimes().size());
+
+  ASSERT_TRUE(map.saveBinary(binaryPath));
+  boost::optional<AnnualIlluminanceMap> loaded = AnnualIlluminanceMap::loadBinary(binaryPath);
+  ASSERT_TRUE(loaded);
+
+  EXPECT_EQ(map.dateTimes(), loaded->dateTimes());
+  EXPECT_EQ(map.illuminanceValues(), loaded->illuminanceValues());
+  ASSERT_EQ(map.xVector().size(), loaded->xVector().size());
+  ASSERT_EQ(map.yVector().size(), loaded->yVector().size());
+  for (unsigned i = 0; i < map.xVector().size(); ++i){
+    EXPECT_EQ(map.xVector()[i], loaded->xVector()[i]);
+  }
+  for (unsigned j = 0; j < map.yVector().size(); ++j){
+    EXPECT_EQ(map.yVector()[j], loaded->yVector()[j]);
+  }
+  openstudio::DateTime dateTime = map.dateTimes()[17];
+  EXPECT_DOUBLE_EQ(map.illuminanceMap(dateTime)(1, 2), loaded->illuminanceMap(dateTime)(1, 2));
+
+  // text files are not binary maps
+  EXPECT_FALSE(AnnualIlluminanceMap::loadBinary(path));
+
+  openstudio::filesystem::remove(path);
+  openstudio::filesystem::remove(binaryPath);
+}
+
+TEST_F(RadAnnualIlluminanceMapFixture, AnnualIlluminanceMap_Benchmark)
+{
+  // hourly results for a 30 x 30 grid
+  unsigned numRows = 8760;
+  unsigned numX = 30;
+  openstudio::path path = openstudio::tempDir() / toPath("AnnualIlluminanceMap_Benchmark.ill");
+  openstudio::path binaryPath = openstudio::tempDir() / toPath("AnnualIlluminanceMap_Benchmark.bin");
+  {
+    openstudio::filesystem::ofstream file(path, std::ios_base::trunc);
+    file << "0 0 0 " << numX - 1 << " 0 0 0 " << numX - 1 << " 0\n";
+    file << "1 1 0\n";
+    for (unsigned k = 0; k < numRows; ++k){
+      file << 1 + (k / 730) << " " << 1 + (k / 24) % 28 << " " << 0.5 + (k % 24) << " 10.5 -3.25 150.0";
+      for (unsigned p = 0; p < numX * numX; ++p){
+        file << " " << 0.001 * ((k * 7 + p * 13) % 100000);
+      }
+      file << "\n";
+    }
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  AnnualIlluminanceMap map(path);
+  auto end = std::chrono::steady_clock::now();
+  RecordProperty("ParseTimeMs", std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()));
+  ASSERT_EQ(numRows, map.dateTimes().size());
+  ASSERT_EQ(numRows * numX * numX, map.illuminanceValues().size());
+  EXPECT_DOUBLE_EQ(10.76 * 0.001 * ((100 * 7 + 5 * 13) % 100000), map.illuminanceValues()[100 * numX * numX + 5]);
+
+  ASSERT_TRUE(map.saveBinary(binaryPath));
+  start = std::chrono::steady_clock::now();
+  boost::optional<AnnualIlluminanceMap> loaded = AnnualIlluminanceMap::loadBinary(binaryPath);
+  end = std::chrono::steady_clock::now();
+  RecordProperty("LoadBinaryTimeMs", std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()));
+  ASSERT_TRUE(loaded);
+  EXPECT_EQ(map.illuminanceValues(), loaded->illuminanceValues());
+
+  openstudio::filesystem::remove(path);
+  openstudio::filesystem::remove(binaryPath);
+}
+
@@ -0,0 +1,167 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#include <gtest/gtest.h>
+
+#include "../BSDFCatalog.hpp"
+
+#include "../../utilities/core/Filesystem.hpp"
+
+using namespace openstudio;
+using namespace openstudio::radiance;
+
+// writes a BCL component directory holding a BSDF xml file
+static void writeBSDFComponent(const openstudio::path& dir, const std::string& uid, double vlt, double vltSpecular, const std::string& shadeType)
+{
+  openstudio::filesystem::create_directories(dir / toPath("files"));
+
+  openstudio::filesystem::ofstream bsdf(dir / toPath("files") / toPath(uid + ".xml"));
+  bsdf << "<WindowElement/>\n";
+
+  openstudio::filesystem::ofstream component(dir / toPath("component.xml"));
+  component << "<component>\n"
+            << "  <name>" << uid << "</name>\n"
+            << "  <uid>" << uid << "</uid>\n"
+            << "  <files>\n"
+            << "    <file><filename>" << uid << ".xml</filename><filetype>xml</filetype></file>\n"
+            << "  </files>\n"
+            << "  <attributes>\n"
+            << "    <attribute><name>Visible Light Transmittance</name><value>" << vlt << "</value><datatype>float</datatype></attribute>\n"
+            << "    <attribute><name>Visible Light Transmittance Specular Percentage</name><value>" << vltSpecular << "</value><datatype>float</datatype></attribute>\n"
+            << "    <attribute><name>Interior Shade Layer Type</name><value>" << shadeType << "</value><datatype>string</datatype></attribute>\n"
+            << "  </attributes>\n"
+            << "</component>\n";
+}
+
+TEST(Radiance, BSDFCatalog_FindNearest)
+{
+  openstudio::path dir = openstudio::tempDir() / toPath("BSDFCatalog_FindNearest");
+  openstudio::filesystem::remove_all(dir);
+  openstudio::filesystem::create_directories(dir);
+  for (const std::string& fileName : {"shade_10.xml", "shade_05.xml", "shade_05_specular.xml", "shade_06.xml", "blind_05.xml"}){
+    openstudio::filesystem::ofstream bsdf(dir / toPath(fileName));
+    bsdf << "<WindowElement/>\n";
+  }
+
+  BSDFCatalog& catalog = BSDFCatalog::instance();
+  catalog.clear();
+
+  catalog.addEntry(BSDFCatalogEntry(dir / toPath("shade_10.xml"), 0.10, 0.0, "Shade"));
+  catalog.addEntry(BSDFCatalogEntry(dir / toPath("shade_05.xml"), 0.05, 0.0, "Shade"));
+  catalog.addEntry(BSDFCatalogEntry(dir / toPath("shade_05_specular.xml"), 0.05, 50.0, "Shade"));
+  catalog.addEntry(BSDFCatalogEntry(dir / toPath("shade_06.xml"), 0.06, 0.0, "Shade"));
+  catalog.addEntry(BSDFCatalogEntry(dir / toPath("blind_05.xml"), 0.05, 0.0, "Blind"));
+  EXPECT_EQ(5u, catalog.size());
+
+  // entries are ordered by shade type then transmittance
+  std::vector<BSDFCatalogEntry> entries = catalog.entries();
+  ASSERT_EQ(5u, entries.size());
+  EXPECT_EQ("Blind", entries[0].shadeType());
+  EXPECT_DOUBLE_EQ(0.05, entries[1].visibleLightTransmittance());
+  EXPECT_DOUBLE_EQ(0.10, entries[4].visibleLightTransmittance());
+
+  boost::optional<BSDFCatalogEntry> entry = catalog.findNearest(0.052, 0.0, "Shade");
+  ASSERT_TRUE(entry);
+  EXPECT_EQ(dir / toPath("shade_05.xml"), entry->path());
+
+  // shade types are compared case insensitively
+  entry = catalog.findNearest(0.058, 0.0, "SHADE");
+  ASSERT_TRUE(entry);
+  EXPECT_EQ(dir / toPath("shade_06.xml"), entry->path());
+
+  entry = catalog.findNearest(0.05, 50.0, "shade");
+  ASSERT_TRUE(entry);
+  EXPECT_EQ(dir / toPath("shade_05_specular.xml"), entry->path());
+
+  entry = catalog.findNearest(0.05, 0.0, "Blind");
+  ASSERT_TRUE(entry);
+  EXPECT_EQ(dir / toPath("blind_05.xml"), entry->path());
+
+  // nothing within the tolerances
+  EXPECT_FALSE(catalog.findNearest(0.08, 0.0, "Shade"));
+  EXPECT_FALSE(catalog.findNearest(0.05, 25.0, "Shade"));
+  EXPECT_FALSE(catalog.findNearest(0.05, 0.0, "Screen"));
+
+  // wider tolerances
+  entry = catalog.findNearest(0.08, 0.0, "Shade", 0.03);
+  ASSERT_TRUE(entry);
+  EXPECT_EQ(dir / toPath("shade_06.xml"), entry->path());
+
+  // adding a file again replaces its entry
+  catalog.addEntry(BSDFCatalogEntry(dir / toPath("shade_06.xml"), 0.07, 0.0, "Shade"));
+  EXPECT_EQ(5u, catalog.size());
+  entry = catalog.findNearest(0.07, 0.0, "Shade");
+  ASSERT_TRUE(entry);
+  EXPECT_EQ(dir / toPath("shade_06.xml"), entry->path());
+  EXPECT_FALSE(catalog.findNearest(0.06, 0.0, "Shade", 0.005));
+
+  // a file removed from disk is dropped and the next nearest entry is returned
+  openstudio::filesystem::remove(dir / toPath("shade_05.xml"));
+  entry = catalog.findNearest(0.05, 0.0, "Shade", 0.03);
+  ASSERT_TRUE(entry);
+  EXPECT_EQ(dir / toPath("shade_06.xml"), entry->path());
+  EXPECT_EQ(4u, catalog.size());
+  EXPECT_FALSE(catalog.findNearest(0.05, 0.0, "Shade"));
+
+  catalog.clear();
+  EXPECT_EQ(0u, catalog.size());
+  EXPECT_FALSE(catalog.findNearest(0.05, 0.0, "Blind"));
+
+  openstudio::filesystem::remove_all(dir);
+}
+
+TEST(Radiance, BSDFCatalog_LoadDirectory)
+{
+  openstudio::path dir = openstudio::tempDir() / toPath("BSDFCatalog_LoadDirectory");
+  openstudio::filesystem::remove_all(dir);
+
+  writeBSDFComponent(dir / toPath("a"), "cloth_light", 0.15, 10.0, "Shade");
+  writeBSDFComponent(dir / toPath("b"), "blinds_45", 0.3, 0.0, "Blind");
+  openstudio::filesystem::create_directories(dir / toPath("not_a_component"));
+
+  BSDFCatalog& catalog = BSDFCatalog::instance();
+  catalog.clear();
+  EXPECT_EQ(2u, catalog.loadDirectory(dir));
+  EXPECT_EQ(2u, catalog.size());
+
+  boost::optional<BSDFCatalogEntry> entry = catalog.findNearest(0.15, 10.0, "Shade");
+  ASSERT_TRUE(entry);
+  EXPECT_EQ(dir / toPath("a") / toPath("files") / toPath("cloth_light.xml"), entry->path());
+  EXPECT_TRUE(openstudio::filesystem::exists(entry->path()));
+
+  entry = catalog.findNearest(0.3, 0.0, "Blind");
+  ASSERT_TRUE(entry);
+  EXPECT_EQ(dir / toPath("b") / toPath("files") / toPath("blinds_45.xml"), entry->path());
+
+  EXPECT_EQ(0u, catalog.loadDirectory(dir / toPath("missing")));
+
+  catalog.clear();
+  openstudio::filesystem::remove_all(dir);
+}
@@ -35,6 +35,7 @@
 #include "../../model/Building.hpp"
 #include "../../model/Building_Impl.hpp"
 #include "../../model/Space.hpp"
+#include "../../model/Space_Impl.hpp"
 #include "../../model/Surface.hpp"
 #include "../../model/SubSurface.hpp"
 #include "../../model/SubSurface_Impl.hpp"
@@ -56,6 +57,13 @@
 #include <utilities/idd/BuildingSurface_Detailed_FieldEnums.hxx>
 #include <utilities/idd/FenestrationSurface_Detailed_FieldEnums.hxx>
 
+#include <resources.hxx>
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <set>
+
 using namespace openstudio;
 using namespace openstudio::model;
 using namespace openstudio::radiance;
@@ -233,6 +241,90 @@ TEST(Radiance, ForwardTranslator_ExampleModel)
 }
 
 
+// the surfaces of a space are written in the order of the model's objects, which follows their allocation and so
+// changes from one run to the next, sort the surface blocks before comparing a scene with the baseline
+static std::string sortSurfaceBlocks(const std::string& scene){
+  // each block runs from its "# surface: " line to the next one, including the blank line that ends it
+  std::string::size_type begin = scene.find("\n# surface: ");
+  if (begin != std::string::npos){
+    ++begin;
+  }
+  std::string result = scene.substr(0, begin);
+  std::vector<std::string> blocks;
+  while (begin != std::string::npos){
+    std::string::size_type end = scene.find("\n# surface: ", begin);
+    if (end != std::string::npos){
+      ++end;
+    }
+    blocks.push_back(scene.substr(begin, end == std::string::npos ? std::string::npos : end - begin));
+    begin = end;
+  }
+  std::sort(blocks.begin(), blocks.end());
+  for (const std::string& block : blocks){
+    result += block;
+  }
+  return result;
+}
+
+TEST(Radiance, ForwardTranslator_ExampleModelSceneFiles)
+{
+  // the example model saved to a file, exampleModel() names its surfaces in allocation order too
+  boost::optional<Model> loadedModel = Model::load(resourcesPath() / toPath("radiance/ExampleModel/exampleModel.osm"));
+  ASSERT_TRUE(loadedModel);
+  Model model = *loadedModel;
+
+  openstudio::path outpath = toPath("./ForwardTranslator_ExampleModelSceneFiles");
+  openstudio::filesystem::remove_all(outpath);
+
+  ForwardTranslator ft;
+  std::vector<path> outpaths = ft.translateModel(outpath, model);
+  ASSERT_FALSE(outpaths.empty());
+
+  // files shared by all spaces are written once
+  std::set<path> uniquePaths(outpaths.begin(), outpaths.end());
+  EXPECT_EQ(uniquePaths.size(), outpaths.size()) << printPaths(outpaths);
+
+  // surface polygons computed ahead of the spaces match getPolygons
+  for (const Space& space : model.getConcreteModelObjects<Space>()){
+    path sceneFile = outpath / toPath("scene") / toPath(cleanName(space.nameString()) + ".rad");
+    ASSERT_TRUE(openstudio::filesystem::exists(sceneFile));
+    std::ifstream scene(toSystemFilename(sceneFile));
+    std::string sceneString((std::istreambuf_iterator<char>(scene)), std::istreambuf_iterator<char>());
+
+    for (const Surface& surface : space.surfaces()){
+      if (surface.isAirWall()){
+        continue;
+      }
+      for (const Point3dVector& polygon : ForwardTranslator::getPolygons(surface)){
+        std::string polygonVertices;
+        for (const Point3d& vertex : polygon){
+          polygonVertices += formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n";
+        }
+        EXPECT_NE(std::string::npos, sceneString.find(polygonVertices)) << surface.nameString();
+      }
+    }
+  }
+
+  // scene and material files match the baseline written before surface polygons were computed in parallel
+  std::vector<std::string> baselineFiles{"materials/materials.rad", "materials/materials_WG0.rad", "materials/materials_blackout.rad",
+                                         "materials/materials_vmx.rad", "scene/Space_1.rad", "scene/Space_2.rad", "scene/Space_3.rad",
+                                         "scene/Space_4.rad", "scene/glazing/WG0.rad", "scene/shading_building.rad", "scene/shading_site.rad"};
+  for (const std::string& baselineFile : baselineFiles){
+    path expectedPath = resourcesPath() / toPath("radiance/ExampleModel") / toPath(baselineFile);
+    path actualPath = outpath / toPath(baselineFile);
+    ASSERT_TRUE(openstudio::filesystem::exists(expectedPath)) << baselineFile;
+    ASSERT_TRUE(openstudio::filesystem::exists(actualPath)) << baselineFile;
+    EXPECT_NE(uniquePaths.end(), uniquePaths.find(actualPath)) << baselineFile;
+
+    std::ifstream expected(toSystemFilename(expectedPath));
+    std::ifstream actual(toSystemFilename(actualPath));
+    std::string expectedString((std::istreambuf_iterator<char>(expected)), std::istreambuf_iterator<char>());
+    std::string actualString((std::istreambuf_iterator<char>(actual)), std::istreambuf_iterator<char>());
+    EXPECT_FALSE(actualString.empty()) << baselineFile;
+    EXPECT_EQ(sortSurfaceBlocks(expectedString), sortSurfaceBlocks(actualString)) << baselineFile;
+  }
+}
+
 TEST(Radiance, ForwardTranslator_ExampleModelWithShadingControl)
 {
   Model model = exampleModel();
@@ -533,7 +533,7 @@ namespace sdd {
 
       equipment.setName(spaceName + " Water Use Equipment");
 
-      if( boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(hotWtrHtgSchRefElement.text().as_string()) )
+      if( boost::optional<model::Schedule> schedule = scheduleByName(hotWtrHtgSchRefElement.text().as_string(), model) )
       {
         equipment.setFlowRateFractionSchedule(schedule.get());
       }
@@ -625,7 +625,7 @@ namespace sdd {
 
           if (occSchRefElement) {
             std::string scheduleName = escapeName(occSchRefElement.text().as_string());
-            boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+            boost::optional<model::Schedule> schedule = scheduleByName(scheduleName, model);
             if (schedule){
               people.setNumberofPeopleSchedule(*schedule);
             }else{
@@ -713,7 +713,7 @@ namespace sdd {
 
             if (infSchRefElement) {
               std::string scheduleName = escapeName(infSchRefElement.text().as_string());
-              boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+              boost::optional<model::Schedule> schedule = scheduleByName(scheduleName, model);
               if (schedule){
                 spaceInfiltrationDesignFlowRate.setSchedule(*schedule);
               }else{
@@ -795,7 +795,7 @@ namespace sdd {
 
         if (intLtgRegSchRefElement){
           std::string scheduleName = escapeName(intLtgRegSchRefElement.text().as_string());
-          boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+          boost::optional<model::Schedule> schedule = scheduleByName(scheduleName, model);
           if (schedule){
             lights.setSchedule(*schedule);
           }else{
@@ -845,7 +845,7 @@ namespace sdd {
 
         if (intLtgNonRegSchRefElement){
           std::string scheduleName = escapeName(intLtgNonRegSchRefElement.text().as_string());
-          boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+          boost::optional<model::Schedule> schedule = scheduleByName(scheduleName, model);
           if (schedule){
             lights.setSchedule(*schedule);
           }else{
@@ -910,7 +910,7 @@ namespace sdd {
 
         if (recptPwrDensSchRefElement){
           std::string scheduleName = escapeName(recptPwrDensSchRefElement.text().as_string());
-          boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+          boost::optional<model::Schedule> schedule = scheduleByName(scheduleName, model);
           if (schedule){
             electricEquipment.setSchedule(*schedule);
           }else{
@@ -962,7 +962,7 @@ namespace sdd {
 
         if (gasEqpPwrDensSchRefElement){
           std::string scheduleName = escapeName(gasEqpPwrDensSchRefElement.text().as_string());
-          boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+          boost::optional<model::Schedule> schedule = scheduleByName(scheduleName, model);
           if (schedule){
             gasEquipment.setSchedule(*schedule);
           }else{
@@ -1013,7 +1013,7 @@ namespace sdd {
 
         if (procElecSchRefElement){
           std::string scheduleName = escapeName(procElecSchRefElement.text().as_string());
-          boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+          boost::optional<model::Schedule> schedule = scheduleByName(scheduleName, model);
           if (schedule){
             electricEquipment.setSchedule(*schedule);
           }else{
@@ -1064,7 +1064,7 @@ namespace sdd {
 
         if (commRfrgEqpSchRefElement){
           std::string scheduleName = escapeName(commRfrgEqpSchRefElement.text().as_string());
-          boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+          boost::optional<model::Schedule> schedule = scheduleByName(scheduleName, model);
           if (schedule){
             electricEquipment.setSchedule(*schedule);
           }else{
@@ -1110,7 +1110,7 @@ namespace sdd {
 
         if (elevSchRefElement){
           std::string scheduleName = escapeName(elevSchRefElement.text().as_string());
-          boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+          boost::optional<model::Schedule> schedule = scheduleByName(scheduleName, model);
           if (schedule){
             electricEquipment.setSchedule(*schedule);
           }else{
@@ -1156,7 +1156,7 @@ namespace sdd {
 
         if (escalSchRefElement){
           std::string scheduleName = escapeName(escalSchRefElement.text().as_string());
-          boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+          boost::optional<model::Schedule> schedule = scheduleByName(scheduleName, model);
           if (schedule){
             electricEquipment.setSchedule(*schedule);
           }else{
@@ -1207,7 +1207,7 @@ namespace sdd {
 
         if (procGasSchRefElement){
           std::string scheduleName = escapeName(procGasSchRefElement.text().as_string());
-          boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+          boost::optional<model::Schedule> schedule = scheduleByName(scheduleName, model);
           if (schedule){
             gasEquipment.setSchedule(*schedule);
           }else{
@@ -1745,7 +1745,7 @@ namespace sdd {
           pugi::xml_node scheduleReferenceElement = element.child("TransSchRef");
           if (scheduleReferenceElement){
             scheduleName = escapeName(scheduleReferenceElement.text().as_string());
-            schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+            schedule = scheduleByName(scheduleName, model);
             if (!schedule){
               LOG(Error, "Cannot find shading schedule '" << scheduleName << "' for shading surface '" << name << "'");
             }
@@ -516,7 +516,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateVRFS
   {
     pugi::xml_node element = vrfSysElement.child("AvailSchRef");
     std::string name = escapeName(element.text().as_string());
-    if( auto schedule = model.getModelObjectByName<model::Schedule>(name) ) {
+    if( auto schedule = scheduleByName(name, model) ) {
       vrf.setAvailabilitySchedule(schedule.get());
     }
   }
@@ -561,7 +561,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateVRFS
 
   {
     auto element = vrfSysElement.child("CtrlSchRef");
-    if( auto schedule = model.getModelObjectByName<model::Schedule>(element.text().as_string()) ) {
+    if( auto schedule = scheduleByName(element.text().as_string(), model) ) {
       vrf.setThermostatPrioritySchedule(schedule.get());
     }
   }
@@ -814,7 +814,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateVRFS
       const std::function<boost::optional<model::Curve>(model::AirConditionerVariableRefrigerantFlow &)> & osGetter) {
 
     std::string value = vrfSysElement.child(elementName.c_str()).text().as_string();
-    auto newcurve = model.getModelObjectByName<model::Curve>(value);
+    auto newcurve = curveByName(value, model);
     if( newcurve ) {
       if( auto oldcurve = osGetter(vrf) ) {
         if( oldcurve.get() != newcurve.get() ) {
@@ -994,7 +994,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateAirS
   boost::optional<model::Schedule> availabilitySchedule;
   if( airHndlrAvailSchElement )
   {
-      availabilitySchedule = model.getModelObjectByName<model::Schedule>(airHndlrAvailSchElement.text().as_string());
+      availabilitySchedule = scheduleByName(airHndlrAvailSchElement.text().as_string(), model);
   }
 
   if( availabilitySchedule )
@@ -1471,7 +1471,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateAirS
       // MinOAFracSchRef
       pugi::xml_node minOAFracSchRefElement = airSystemOACtrlElement.child("MinOAFracSchRef");
       if( boost::optional<model::Schedule> schedule =
-          model.getModelObjectByName<model::Schedule>(minOAFracSchRefElement.text().as_string()) )
+          scheduleByName(minOAFracSchRefElement.text().as_string(), model) )
       {
         oaController.setMinimumFractionofOutdoorAirSchedule(schedule.get());
       }
@@ -1479,7 +1479,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateAirS
       // MaxOAFracSchRef
       pugi::xml_node maxOAFracSchRefElement = airSystemOACtrlElement.child("MaxOAFracSchRef");
       if( boost::optional<model::Schedule> schedule =
-          model.getModelObjectByName<model::Schedule>(maxOAFracSchRefElement.text().as_string()) ) {
+          scheduleByName(maxOAFracSchRefElement.text().as_string(), model) ) {
         oaController.setMaximumFractionofOutdoorAirSchedule(schedule.get());
       } else {
         // MaxOARat
@@ -1513,7 +1513,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateAirS
 
       // EconoAvailSchRef
       auto econoAvailSchRef = airSystemOACtrlElement.child("EconoAvailSchRef").text().as_string();
-      if( auto schedule = model.getModelObjectByName<model::Schedule>(econoAvailSchRef) ) {
+      if( auto schedule = scheduleByName(econoAvailSchRef, model) ) {
         oaController.setTimeofDayEconomizerControlSchedule(schedule.get());
       }
 
@@ -1561,7 +1561,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateAirS
         pugi::xml_node oaSchRefElement = airSystemOACtrlElement.child("OASchRef");
 
         boost::optional<model::Schedule> schedule;
-        schedule = model.getModelObjectByName<model::Schedule>(oaSchRefElement.text().as_string());
+        schedule = scheduleByName(oaSchRefElement.text().as_string(), model);
 
         if( schedule )
         {
@@ -1716,7 +1716,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateAirS
         } else if( istringEqual(tempCtrl,"Scheduled") ) {
           hx.setSupplyAirOutletTemperatureControl(true);
           auto schRef = htRcvryElement.child("TempSetptSchRef").text().as_string();
-          auto sch = model.getModelObjectByName<model::Schedule>(schRef);
+          auto sch = scheduleByName(schRef, model);
           if( sch ) {
             model::SetpointManagerScheduled spm(model,sch.get());
             spm.setName(hx.nameString() + " Setpoint");
@@ -2001,7 +2001,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateAirS
   {
     pugi::xml_node clgSetPtSchRefElement = airSystemElement.child("ClgSetptSchRef");
 
-    boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(clgSetPtSchRefElement.text().as_string());
+    boost::optional<model::Schedule> schedule = scheduleByName(clgSetPtSchRefElement.text().as_string(), model);
 
     if( ! schedule )
     {
@@ -2132,7 +2132,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateAirS
 
     pugi::xml_node clgSetptSchRefElement = airSystemElement.child("ClgSetptSchRef");
     std::string clgSetptSchRef = escapeName(clgSetptSchRefElement.text().as_string());
-    coolingSchedule = model.getModelObjectByName<model::Schedule>(clgSetptSchRef);
+    coolingSchedule = scheduleByName(clgSetptSchRef, model);
 
     if( ! coolingSchedule ) {
       LOG(Warn,nameElement.text().as_string() << " requests scheduled dual setpoint control, but does not define schedules."
@@ -2146,7 +2146,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateAirS
 
     pugi::xml_node htgSetptSchRefElement = airSystemElement.child("HtgSetptSchRef");
     std::string htgSetptSchRef = escapeName(htgSetptSchRefElement.text().as_string());
-    heatingSchedule = model.getModelObjectByName<model::Schedule>(htgSetptSchRef);
+    heatingSchedule = scheduleByName(htgSetptSchRef, model);
 
     if( ! heatingSchedule ) {
       LOG(Warn,nameElement.text().as_string() << " requests scheduled dual setpoint control, but does not define schedules."
@@ -2253,8 +2253,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
     pugi::xml_node hirCurveElement =
       heatingCoilElement.child("FurnHIR_fPLRCrvRef");
     hirCurve =
-      model.getModelObjectByName<model::Curve>(
-        hirCurveElement.text().as_string());
+      curveByName(hirCurveElement.text().as_string(), model);
     if( hirCurve )
     {
       coil.setPartLoadFractionCorrelationCurve(hirCurve.get());
@@ -2501,8 +2500,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
       pugi::xml_node totalHeatingCapacityFunctionofTemperatureCurveElement =
         heatingCoilElement.child("HtPumpCap_fTempCrvRef");
       totalHeatingCapacityFunctionofTemperatureCurve =
-        model.getModelObjectByName<model::Curve>(
-          totalHeatingCapacityFunctionofTemperatureCurveElement.text().as_string());
+        curveByName(totalHeatingCapacityFunctionofTemperatureCurveElement.text().as_string(), model);
 
       if( ! totalHeatingCapacityFunctionofTemperatureCurve )
       {
@@ -2522,8 +2520,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
       pugi::xml_node totalHeatingCapacityFunctionofFlowFractionCurveElement =
         heatingCoilElement.child("HtPumpCap_fFlowCrvRef");
       totalHeatingCapacityFunctionofFlowFractionCurve =
-        model.getModelObjectByName<model::Curve>(
-          totalHeatingCapacityFunctionofFlowFractionCurveElement.text().as_string());
+        curveByName(totalHeatingCapacityFunctionofFlowFractionCurveElement.text().as_string(), model);
 
       if( ! totalHeatingCapacityFunctionofFlowFractionCurve )
       {
@@ -2543,8 +2540,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
       pugi::xml_node energyInputRatioFunctionofTemperatureCurveElement =
         heatingCoilElement.child("HtPumpEIR_fTempCrvRef");
       energyInputRatioFunctionofTemperatureCurve =
-        model.getModelObjectByName<model::Curve>(
-          energyInputRatioFunctionofTemperatureCurveElement.text().as_string());
+        curveByName(energyInputRatioFunctionofTemperatureCurveElement.text().as_string(), model);
 
       if( ! energyInputRatioFunctionofTemperatureCurve )
       {
@@ -2564,8 +2560,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
       pugi::xml_node energyInputRatioFunctionofFlowFractionCurveElement =
         heatingCoilElement.child("HtPumpEIR_fFlowCrvRef");
       energyInputRatioFunctionofFlowFractionCurve =
-        model.getModelObjectByName<model::Curve>(
-          energyInputRatioFunctionofFlowFractionCurveElement.text().as_string());
+        curveByName(energyInputRatioFunctionofFlowFractionCurveElement.text().as_string(), model);
 
       if( ! energyInputRatioFunctionofFlowFractionCurve )
       {
@@ -2584,8 +2579,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
       pugi::xml_node partLoadFractionCorrelationCurveElement =
         heatingCoilElement.child("HtPumpEIR_fPLFCrvRef");
       partLoadFractionCorrelationCurve =
-        model.getModelObjectByName<model::Curve>(
-          partLoadFractionCorrelationCurveElement.text().as_string());
+        curveByName(partLoadFractionCorrelationCurveElement.text().as_string(), model);
 
       if( ! partLoadFractionCorrelationCurve )
       {
@@ -2751,7 +2745,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateFan(
   //AvailSchRef
   pugi::xml_node availSchRefElement = fanElement.child("AvailSchRef");
   std::string availSchRef = escapeName(availSchRefElement.text().as_string());
-  auto availSch = model.getModelObjectByName<model::Schedule>(availSchRef);
+  auto availSch = scheduleByName(availSchRef, model);
 
   // FanControlMethod
   pugi::xml_node fanControlMethodElement = fanElement.child("CtrlMthdSim");
@@ -2881,7 +2875,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateFan(
         // Pwr_fPLRCrvRef
         pugi::xml_node pwr_fPLRCrvElement = fanElement.child("Pwr_fPLRCrvRef");
         boost::optional<model::Curve> pwr_fPLRCrv;
-        pwr_fPLRCrv = model.getModelObjectByName<model::Curve>(pwr_fPLRCrvElement.text().as_string());
+        pwr_fPLRCrv = curveByName(pwr_fPLRCrvElement.text().as_string(), model);
         if( pwr_fPLRCrv )
         {
           fan.setFanPowerRatioFunctionofSpeedRatioCurve(pwr_fPLRCrv.get());
@@ -2991,7 +2985,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateFan(
     // Pwr_fPLRCrvRef
     pugi::xml_node pwr_fPLRCrvElement = fanElement.child("Pwr_fPLRCrvRef");
     boost::optional<model::Curve> pwr_fPLRCrv;
-    pwr_fPLRCrv = model.getModelObjectByName<model::Curve>(pwr_fPLRCrvElement.text().as_string());
+    pwr_fPLRCrv = curveByName(pwr_fPLRCrvElement.text().as_string(), model);
     if( pwr_fPLRCrv )
     {
       if( boost::optional<model::CurveCubic> curveCubic = pwr_fPLRCrv->optionalCast<model::CurveCubic>() )
@@ -3048,7 +3042,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateHtRc
   // AvailSchRef
   auto availSchRefElement = element.child("AvailSchRef");
   auto availSchRef = escapeName(availSchRefElement.text().as_string());
-  auto availSch = model.getModelObjectByName<model::Schedule>(availSchRef);
+  auto availSch = scheduleByName(availSchRef, model);
   if( availSch ) {
     hx.setAvailabilitySchedule(availSch.get());
   }
@@ -3449,7 +3443,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
 
       boost::optional<model::Curve> coolingCurveFofTemp;
       pugi::xml_node cap_fTempCrvRefElement = coolingCoilElement.child("Cap_fTempCrvRef");
-      coolingCurveFofTemp = model.getModelObjectByName<model::Curve>(cap_fTempCrvRefElement.text().as_string());
+      coolingCurveFofTemp = curveByName(cap_fTempCrvRefElement.text().as_string(), model);
       if( ! coolingCurveFofTemp )
       {
         LOG(Error,"Coil: " << nameElement.text().as_string() << "Broken Cap_fTempCrvRef");
@@ -3473,7 +3467,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
 
       boost::optional<model::Curve> coolingCurveFofFlow;
       pugi::xml_node cap_fFlowCrvRefElement = coolingCoilElement.child("Cap_fFlowCrvRef");
-      coolingCurveFofFlow = model.getModelObjectByName<model::Curve>(cap_fFlowCrvRefElement.text().as_string());
+      coolingCurveFofFlow = curveByName(cap_fFlowCrvRefElement.text().as_string(), model);
       if( ! coolingCurveFofFlow )
       {
         LOG(Error,"Coil: " << nameElement.text().as_string() << "Broken Cap_fFlowCrvRef");
@@ -3493,7 +3487,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
 
       boost::optional<model::Curve> energyInputRatioFofTemp;
       pugi::xml_node dxEIR_fTempCrvRefElement = coolingCoilElement.child("DXEIR_fTempCrvRef");
-      energyInputRatioFofTemp = model.getModelObjectByName<model::Curve>(dxEIR_fTempCrvRefElement.text().as_string());
+      energyInputRatioFofTemp = curveByName(dxEIR_fTempCrvRefElement.text().as_string(), model);
       if( ! energyInputRatioFofTemp )
       {
         LOG(Error,"Coil: " << nameElement.text().as_string() << "Broken DXEIR_fTempCrvRef");
@@ -3517,7 +3511,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
 
       boost::optional<model::Curve> energyInputRatioFofFlow;
       pugi::xml_node dxEIR_fFlowCrvRefElement = coolingCoilElement.child("DXEIR_fFlowCrvRef");
-      energyInputRatioFofFlow = model.getModelObjectByName<model::Curve>(dxEIR_fFlowCrvRefElement.text().as_string());
+      energyInputRatioFofFlow = curveByName(dxEIR_fFlowCrvRefElement.text().as_string(), model);
       if( ! energyInputRatioFofFlow )
       {
         model::CurveQuadratic _energyInputRatioFofFlow(model);
@@ -3533,7 +3527,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
 
       boost::optional<model::Curve> partLoadFraction;
       pugi::xml_node dxEIR_fPLFCrvRefElement = coolingCoilElement.child("DXEIR_fPLFCrvRef");
-      partLoadFraction = model.getModelObjectByName<model::Curve>(dxEIR_fPLFCrvRefElement.text().as_string());
+      partLoadFraction = curveByName(dxEIR_fPLFCrvRefElement.text().as_string(), model);
       if( ! partLoadFraction )
       {
         LOG(Error,"Coil: " << nameElement.text().as_string() << "Broken DXEIR_fPLFCrvRef");
@@ -3642,7 +3636,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
 
       boost::optional<model::Curve> coolingCurveFofTemp;
       pugi::xml_node cap_fTempCrvRefElement = coolingCoilElement.child("Cap_fTempCrvRef");
-      coolingCurveFofTemp = model.getModelObjectByName<model::Curve>(cap_fTempCrvRefElement.text().as_string());
+      coolingCurveFofTemp = curveByName(cap_fTempCrvRefElement.text().as_string(), model);
       if( ! coolingCurveFofTemp )
       {
         LOG(Error,"Coil: " << nameElement.text().as_string() << "Broken Cap_fTempCrvRef");
@@ -3666,7 +3660,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
 
       boost::optional<model::Curve> coolingCurveFofFlow;
       pugi::xml_node cap_fFlowCrvRefElement = coolingCoilElement.child("Cap_fFlowCrvRef");
-      coolingCurveFofFlow = model.getModelObjectByName<model::Curve>(cap_fFlowCrvRefElement.text().as_string());
+      coolingCurveFofFlow = curveByName(cap_fFlowCrvRefElement.text().as_string(), model);
       if( ! coolingCurveFofFlow )
       {
         LOG(Error,"Coil: " << nameElement.text().as_string() << "Broken Cap_fFlowCrvRef");
@@ -3686,7 +3680,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
 
       boost::optional<model::Curve> energyInputRatioFofTemp;
       pugi::xml_node dxEIR_fTempCrvRefElement = coolingCoilElement.child("DXEIR_fTempCrvRef");
-      energyInputRatioFofTemp = model.getModelObjectByName<model::Curve>(dxEIR_fTempCrvRefElement.text().as_string());
+      energyInputRatioFofTemp = curveByName(dxEIR_fTempCrvRefElement.text().as_string(), model);
       if( ! energyInputRatioFofTemp )
       {
         LOG(Error,"Coil: " << nameElement.text().as_string() << "Broken DXEIR_fTempCrvRef");
@@ -3710,7 +3704,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
 
       boost::optional<model::Curve> energyInputRatioFofFlow;
       pugi::xml_node dxEIR_fFlowCrvRefElement = coolingCoilElement.child("DXEIR_fFlowCrvRef");
-      energyInputRatioFofFlow = model.getModelObjectByName<model::Curve>(dxEIR_fFlowCrvRefElement.text().as_string());
+      energyInputRatioFofFlow = curveByName(dxEIR_fFlowCrvRefElement.text().as_string(), model);
       if( ! energyInputRatioFofFlow )
       {
         model::CurveQuadratic _energyInputRatioFofFlow(model);
@@ -3726,7 +3720,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
 
       boost::optional<model::Curve> partLoadFraction;
       pugi::xml_node dxEIR_fPLFCrvRefElement = coolingCoilElement.child("DXEIR_fPLFCrvRef");
-      partLoadFraction = model.getModelObjectByName<model::Curve>(dxEIR_fPLFCrvRefElement.text().as_string());
+      partLoadFraction = curveByName(dxEIR_fPLFCrvRefElement.text().as_string(), model);
       if( ! partLoadFraction )
       {
         LOG(Error,"Coil: " << nameElement.text().as_string() << "Broken DXEIR_fPLFCrvRef");
@@ -4145,7 +4139,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateTher
 
     pugi::xml_node exhAvailSchRefElement = thermalZoneElement.child("ExhAvailSchRef");
     std::string exhAvailSchRef = escapeName(exhAvailSchRefElement.text().as_string());
-    boost::optional<model::Schedule> exhAvailSch = model.getModelObjectByName<model::Schedule>(exhAvailSchRef);
+    boost::optional<model::Schedule> exhAvailSch = scheduleByName(exhAvailSchRef, model);
     if( exhAvailSch )
     {
       exhaustFan.setAvailabilitySchedule(exhAvailSch.get());
@@ -4168,7 +4162,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateTher
 
     pugi::xml_node exhFlowSchRefElement = thermalZoneElement.child("ExhFlowSchRef");
     std::string exhFlowSchRef = escapeName(exhFlowSchRefElement.text().as_string());
-    boost::optional<model::Schedule> exhFlowSch = model.getModelObjectByName<model::Schedule>(exhFlowSchRef);
+    boost::optional<model::Schedule> exhFlowSch = scheduleByName(exhFlowSchRef, model);
     if( exhFlowSch )
     {
       exhaustFan.setFlowFractionSchedule(exhFlowSch.get());
@@ -4186,7 +4180,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateTher
 
     pugi::xml_node exhMinTempSchRefElement = thermalZoneElement.child("ExhMinTempSchRef");
     std::string exhMinTempSchRef = escapeName(exhMinTempSchRefElement.text().as_string());
-    boost::optional<model::Schedule> exhMinTempSch = model.getModelObjectByName<model::Schedule>(exhMinTempSchRef);
+    boost::optional<model::Schedule> exhMinTempSch = scheduleByName(exhMinTempSchRef, model);
     if( exhMinTempSch )
     {
       exhaustFan.setMinimumZoneTemperatureLimitSchedule(exhMinTempSch.get());
@@ -4194,7 +4188,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateTher
 
     pugi::xml_node exhBalancedSchRefElement = thermalZoneElement.child("ExhBalancedSchRef");
     std::string exhBalancedSchRef = escapeName(exhBalancedSchRefElement.text().as_string());
-    boost::optional<model::Schedule> exhBalancedSch = model.getModelObjectByName<model::Schedule>(exhBalancedSchRef);
+    boost::optional<model::Schedule> exhBalancedSch = scheduleByName(exhBalancedSchRef, model);
     if( exhBalancedSch )
     {
       exhaustFan.setBalancedExhaustFractionSchedule(exhBalancedSch.get());
@@ -4714,7 +4708,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateTher
   pugi::xml_node clgTstatSchRefElement = thermalZoneElement.child("ClgTstatSchRef");
   if (clgTstatSchRefElement){
     std::string scheduleName = escapeName(clgTstatSchRefElement.text().as_string());
-    boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+    boost::optional<model::Schedule> schedule = scheduleByName(scheduleName, model);
     if (schedule){
       if (optionalThermostat){
         optionalThermostat->setCoolingSchedule(*schedule);
@@ -4744,7 +4738,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateTher
   pugi::xml_node htgTstatSchRefElement = thermalZoneElement.child("HtgTstatSchRef");
   if (htgTstatSchRefElement){
     std::string scheduleName = escapeName(htgTstatSchRefElement.text().as_string());
-    boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+    boost::optional<model::Schedule> schedule = scheduleByName(scheduleName, model);
     if (schedule){
       if (optionalThermostat){
         optionalThermostat->setHeatingSchedule(*schedule);
@@ -4854,14 +4848,14 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateTher
     for( const auto & info : priAirCondInfo ) {
       if (info.ZnSysElement) {
         auto availSchRefElement = info.ZnSysElement.child("AvailSchRef");
-        if( auto availSch = model.getModelObjectByName<model::Schedule>(availSchRefElement.text().as_string()) ) {
+        if( auto availSch = scheduleByName(availSchRefElement.text().as_string(), model) ) {
           zoneVent.setSchedule(availSch.get());
           break;
         }
       } else if (info.AirSysElement) {
         auto availSchRefElement = info.AirSysElement.child("AvailSchRef");
-        auto availSch = model.getModelObjectByName<model::Schedule>(availSchRefElement.text().as_string());
-        if( auto availSch = model.getModelObjectByName<model::Schedule>(availSchRefElement.text().as_string()) ) {
+        auto availSch = scheduleByName(availSchRefElement.text().as_string(), model);
+        if( auto availSch = scheduleByName(availSchRefElement.text().as_string(), model) ) {
           zoneVent.setSchedule(availSch.get());
           break;
         }
@@ -4890,7 +4884,7 @@ boost::optional<model::ModelObject> ReverseTranslator::translateTrmlUnit(const p
 
   // AvailSchRef
   pugi::xml_node availSchRefElement = trmlUnitElement.child("AvailSchRef");
-  boost::optional<model::Schedule> availSch = model.getModelObjectByName<model::Schedule>(availSchRefElement.text().as_string());
+  boost::optional<model::Schedule> availSch = scheduleByName(availSchRefElement.text().as_string(), model);
 
   // Type
   pugi::xml_node typeElement = trmlUnitElement.child("TypeSim");
@@ -4930,7 +4924,7 @@ boost::optional<model::ModelObject> ReverseTranslator::translateTrmlUnit(const p
     model::AirTerminalSingleDuctVAVNoReheat terminal(model,schedule);
 
     pugi::xml_node minAirFracSchRefElement = trmlUnitElement.child("MinAirFracSchRef");
-    if( boost::optional<model::Schedule> minAirFracSch = model.getModelObjectByName<model::Schedule>(minAirFracSchRefElement.text().as_string()) )
+    if( boost::optional<model::Schedule> minAirFracSch = scheduleByName(minAirFracSchRefElement.text().as_string(), model) )
     {
       terminal.setZoneMinimumAirFlowInputMethod("Scheduled");
       terminal.setMinimumAirFlowFractionSchedule(minAirFracSch.get());
@@ -4988,7 +4982,7 @@ boost::optional<model::ModelObject> ReverseTranslator::translateTrmlUnit(const p
     model::AirTerminalSingleDuctVAVReheat terminal(model,schedule,coil.get());
 
     pugi::xml_node minAirFracSchRefElement = trmlUnitElement.child("MinAirFracSchRef");
-    if( boost::optional<model::Schedule> minAirFracSch = model.getModelObjectByName<model::Schedule>(minAirFracSchRefElement.text().as_string()) )
+    if( boost::optional<model::Schedule> minAirFracSch = scheduleByName(minAirFracSchRefElement.text().as_string(), model) )
     {
       terminal.setZoneMinimumAirFlowMethod("Scheduled");
       terminal.setMinimumAirFlowFractionSchedule(minAirFracSch.get());
@@ -5411,21 +5405,21 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateFlui
 
     {
       auto schRef = thrmlEngyStorElement.child("ChlrOnlySchRef").text().as_string();
-      if( auto sch = model.getModelObjectByName<model::Schedule>(schRef) ) {
+      if( auto sch = scheduleByName(schRef, model) ) {
         plantLoop.setPlantEquipmentOperationCoolingLoadSchedule(sch.get());
       }
     }
 
     {
       auto schRef = thrmlEngyStorElement.child("DischrgSchRef").text().as_string();
-      if( auto sch = model.getModelObjectByName<model::Schedule>(schRef) ) {
+      if( auto sch = scheduleByName(schRef, model) ) {
         plantLoop.setPrimaryPlantEquipmentOperationSchemeSchedule(sch.get());
       }
     }
 
     {
       auto schRef = thrmlEngyStorElement.child("ChrgSchRef").text().as_string();
-      if( auto sch = model.getModelObjectByName<model::Schedule>(schRef) ) {
+      if( auto sch = scheduleByName(schRef, model) ) {
         plantLoop.setComponentSetpointOperationSchemeSchedule(sch.get());
       }
     }
@@ -5906,7 +5900,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateFlui
   {
     pugi::xml_node tempSetPtSchRefElement = fluidSysElement.child("TempSetptSchRef");
 
-    boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(tempSetPtSchRefElement.text().as_string());
+    boost::optional<model::Schedule> schedule = scheduleByName(tempSetPtSchRefElement.text().as_string(), model);
 
     if( ! schedule )
     {
@@ -6391,7 +6385,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateBoil
 
   boost::optional<model::Curve> hirfPLRCrv;
   pugi::xml_node hirfPLRCrvRefElement = boilerElement.child("HIR_fPLRCrvRef");
-  hirfPLRCrv = model.getModelObjectByName<model::Curve>(hirfPLRCrvRefElement.text().as_string());
+  hirfPLRCrv = curveByName(hirfPLRCrvRefElement.text().as_string(), model);
   if( hirfPLRCrv )
   {
     boiler.setNormalizedBoilerEfficiencyCurve(hirfPLRCrv.get());
@@ -6839,7 +6833,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateThrm
   tes.setUseSideHeatTransferEffectiveness(1.0);
 
   std::string dischrgSchRef = tesElement.child("DischrgSchRef").text().as_string();
-  if( auto schedule = model.getModelObjectByName<model::Schedule>(dischrgSchRef) ) {
+  if( auto schedule = scheduleByName(dischrgSchRef, model) ) {
     tes.setUseSideAvailabilitySchedule(schedule.get());
   }
 
@@ -6863,7 +6857,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateThrm
   tes.setSourceSideHeatTransferEffectiveness(1.0);
 
   std::string chrgSchRef = tesElement.child("ChrgSchRef").text().as_string();
-  if( auto schedule = model.getModelObjectByName<model::Schedule>(chrgSchRef) ) {
+  if( auto schedule = scheduleByName(chrgSchRef, model) ) {
     tes.setSourceSideAvailabilitySchedule(schedule.get());
   }
 
@@ -6983,7 +6977,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateChil
 
     {
       auto curveElement = chillerElement.child("HIR_fPLRCrvRef");
-      if( auto curve = model.getModelObjectByName<model::Curve>(curveElement.text().as_string()) ) {
+      if( auto curve = curveByName(curveElement.text().as_string(), model) ) {
         auto oldCurve = chiller.generatorHeatInputFunctionofPartLoadRatioCurve();
         if( chiller.setGeneratorHeatInputFunctionofPartLoadRatioCurve(curve.get()) ) {
           oldCurve.remove();
@@ -6993,7 +6987,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateChil
 
     {
       auto curveElement = chillerElement.child("HIR_fCndTempCrvRef");
-      if( auto curve = model.getModelObjectByName<model::Curve>(curveElement.text().as_string()) ) {
+      if( auto curve = curveByName(curveElement.text().as_string(), model) ) {
         auto oldCurve = chiller.generatorHeatInputCorrectionFunctionofCondenserTemperatureCurve();
         if( chiller.setGeneratorHeatInputCorrectionFunctionofCondenserTemperatureCurve(curve.get()) ) {
           oldCurve.remove();
@@ -7003,7 +6997,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateChil
 
     {
       auto curveElement = chillerElement.child("HIR_fEvapTempCrvRef");
-      if( auto curve = model.getModelObjectByName<model::Curve>(curveElement.text().as_string()) ) {
+      if( auto curve = curveByName(curveElement.text().as_string(), model) ) {
         auto oldCurve = chiller.generatorHeatInputCorrectionFunctionofChilledWaterTemperatureCurve();
         if( chiller.setGeneratorHeatInputCorrectionFunctionofChilledWaterTemperatureCurve(curve.get()) ) {
           oldCurve.remove();
@@ -7013,7 +7007,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateChil
 
     {
       auto curveElement = chillerElement.child("Cap_fCndTempCrvRef");
-      if( auto curve = model.getModelObjectByName<model::Curve>(curveElement.text().as_string()) ) {
+      if( auto curve = curveByName(curveElement.text().as_string(), model) ) {
         auto oldCurve = chiller.capacityCorrectionFunctionofCondenserTemperatureCurve();
         if( chiller.setCapacityCorrectionFunctionofCondenserTemperatureCurve(curve.get()) ) {
           oldCurve.remove();
@@ -7023,7 +7017,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateChil
 
     {
       auto curveElement = chillerElement.child("Cap_fEvapTempCrvRef");
-      if( auto curve = model.getModelObjectByName<model::Curve>(curveElement.text().as_string()) ) {
+      if( auto curve = curveByName(curveElement.text().as_string(), model) ) {
         auto oldCurve = chiller.capacityCorrectionFunctionofChilledWaterTemperatureCurve();
         if( chiller.setCapacityCorrectionFunctionofChilledWaterTemperatureCurve(curve.get()) ) {
           oldCurve.remove();
@@ -7033,7 +7027,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateChil
 
     {
       auto curveElement = chillerElement.child("Cap_fGenTempCrvRef");
-      if( auto curve = model.getModelObjectByName<model::Curve>(curveElement.text().as_string()) ) {
+      if( auto curve = curveByName(curveElement.text().as_string(), model) ) {
         auto oldCurve = chiller.capacityCorrectionFunctionofGeneratorTemperatureCurve();
         if( chiller.setCapacityCorrectionFunctionofGeneratorTemperatureCurve(curve.get()) ) {
           oldCurve.remove();
@@ -7309,7 +7303,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateWtrH
 
     {
       auto curveRef = element.child("HIR_fPLRCrvRef").text().as_string();
-      auto newcurve = model.getModelObjectByName<model::Curve>(curveRef);
+      auto newcurve = curveByName(curveRef, model);
       if( newcurve ) {
         auto oldcurve = waterHeater.partLoadFactorCurve();
         if( oldcurve && (oldcurve.get() != newcurve.get()) ) {
@@ -7400,7 +7394,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateWtrH
         const std::function<model::Curve(model::CoilWaterHeatingAirToWaterHeatPump &)> & osGetter) {
 
       auto value = element.child(elementName.c_str()).text().as_string();
-      auto newcurve = model.getModelObjectByName<model::Curve>(value);
+      auto newcurve = curveByName(value, model);
       if( newcurve ) {
         auto oldcurve = osGetter(coil);
         if( oldcurve != newcurve.get() ) {
@@ -7633,7 +7627,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateZnSy
 
   if (scheduleElement)
   {
-    schedule = model.getModelObjectByName<model::Schedule>(scheduleElement.text().as_string());
+    schedule = scheduleByName(scheduleElement.text().as_string(), model);
   }
 
   if( ! schedule )
@@ -8490,7 +8484,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
       const std::function<model::Curve(model::CoilHeatingDXVariableRefrigerantFlow &)> & osGetter) {
 
     auto value = element.child(elementName.c_str()).text().as_string();
-    auto newcurve = model.getModelObjectByName<model::Curve>(value);
+    auto newcurve = curveByName(value, model);
     if( newcurve ) {
       auto oldcurve = osGetter(coil);
       if( oldcurve != newcurve.get() ) {
@@ -8547,7 +8541,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
       const std::function<model::Curve(model::CoilCoolingDXVariableRefrigerantFlow &)> & osGetter) {
 
     auto value = element.child(elementName.c_str()).text().as_string();
-    auto newcurve = model.getModelObjectByName<model::Curve>(value);
+    auto newcurve = curveByName(value, model);
     if( newcurve ) {
       auto oldcurve = osGetter(coil);
       if( oldcurve != newcurve.get() ) {
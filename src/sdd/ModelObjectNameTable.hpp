@@ -0,0 +1,111 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef SDD_MODELOBJECTNAMETABLE_HPP
+#define SDD_MODELOBJECTNAMETABLE_HPP
+
+#include "../model/Model.hpp"
+
+#include "../utilities/core/Compare.hpp"
+
+#include <boost/algorithm/string/case_conv.hpp>
+
+#include <string>
+#include <unordered_map>
+
+namespace openstudio {
+  namespace sdd {
+
+    // Looks up model objects of type T by name without scanning the model on every call, as
+    // model.getModelObjectByName does. Model names are unique and compared case insensitively,
+    // so the table is keyed by lower case name. The table is rebuilt when objects have been added
+    // since it was built; a miss with an unchanged object count (e.g. after a rename) is confirmed
+    // against the model so the result always matches getModelObjectByName.
+    template <typename T>
+    class ModelObjectNameTable
+    {
+     public:
+
+      boost::optional<T> find(const std::string& name, const model::Model& model)
+      {
+        if (name.empty()){
+          return boost::none;
+        }
+
+        std::string key = boost::algorithm::to_lower_copy(name);
+        auto it = m_objects.find(key);
+        if (it != m_objects.end()){
+          // object may have been removed or renamed since it was added to the table
+          if (it->second.initialized() && istringEqual(it->second.nameString(), name)){
+            return it->second;
+          }
+          m_objects.erase(it);
+          m_numObjects.reset();
+        }
+
+        if (m_numObjects && (*m_numObjects == model.numObjects())){
+          // nothing was added, but an object may have been renamed to this name
+          boost::optional<T> object = model.getModelObjectByName<T>(name);
+          if (object){
+            m_objects.emplace(key, *object);
+          }
+          return object;
+        }
+
+        m_objects.clear();
+        for (const T& object : model.getModelObjects<T>()){
+          m_objects.emplace(boost::algorithm::to_lower_copy(object.nameString()), object);
+        }
+        m_numObjects = model.numObjects();
+
+        it = m_objects.find(key);
+        if (it != m_objects.end()){
+          return it->second;
+        }
+        return boost::none;
+      }
+
+      void clear()
+      {
+        m_objects.clear();
+        m_numObjects.reset();
+      }
+
+     private:
+
+      std::unordered_map<std::string, T> m_objects;
+
+      // number of objects in the model when the table was last built
+      boost::optional<unsigned> m_numObjects;
+    };
+
+  } // sdd
+} // openstudio
+
+#endif // SDD_MODELOBJECTNAMETABLE_HPP
@@ -90,6 +90,8 @@
 #include "../model/SiteWaterMainsTemperature_Impl.hpp"
 #include "../model/Schedule.hpp"
 #include "../model/Schedule_Impl.hpp"
+#include "../model/Curve.hpp"
+#include "../model/Curve_Impl.hpp"
 #include "../model/Splitter.hpp"
 #include "../model/Splitter_Impl.hpp"
 #include "../model/Mixer.hpp"
@@ -138,6 +140,7 @@
 
 #include <pugixml.hpp>
 
+
 namespace openstudio {
 namespace sdd {
 
@@ -182,6 +185,7 @@ namespace sdd {
         file.close();
         if (success) {
           result = this->convert(doc.document_element());
+          clearNameTables();
         } else{
           LOG(Error, "Could not open file '" << toString(path) << "'");
         }
@@ -195,6 +199,22 @@ namespace sdd {
     return result;
   }
 
+  boost::optional<model::Schedule> ReverseTranslator::scheduleByName(const std::string& name, const model::Model& model)
+  {
+    return m_schedulesByName.find(name, model);
+  }
+
+  boost::optional<model::Curve> ReverseTranslator::curveByName(const std::string& name, const model::Model& model)
+  {
+    return m_curvesByName.find(name, model);
+  }
+
+  void ReverseTranslator::clearNameTables()
+  {
+    m_schedulesByName.clear();
+    m_curvesByName.clear();
+  }
+
   std::vector<LogMessage> ReverseTranslator::warnings() const
   {
     std::vector<LogMessage> result;
@@ -237,6 +257,8 @@ namespace sdd {
   {
     boost::optional<model::Model> result;
 
+    clearNameTables();
+
     // get project, assume one project per file
     pugi::xml_node projectElement = root.child("Proj");
     if (!projectElement) {
@@ -1933,7 +1955,7 @@ namespace sdd {
 
     pugi::xml_node wtrMnTempSchRefElement = element.child("WtrMnTempSchRef");
     if (wtrMnTempSchRefElement){
-      boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(wtrMnTempSchRefElement.text().as_string());
+      boost::optional<model::Schedule> schedule = scheduleByName(wtrMnTempSchRefElement.text().as_string(), model);
       if (schedule){
         model::SiteWaterMainsTemperature waterMains = model.getUniqueModelObject<model::SiteWaterMainsTemperature>();
         waterMains.setTemperatureSchedule(*schedule);
@@ -31,6 +31,7 @@
 #define SDD_REVERSETRANSLATOR_HPP
 
 #include "SDDAPI.hpp"
+#include "ModelObjectNameTable.hpp"
 
 #include "../utilities/core/Path.hpp"
 #include "../utilities/core/Optional.hpp"
@@ -38,6 +39,7 @@
 #include "../utilities/core/StringStreamLogSink.hpp"
 
 #include "../model/Schedule.hpp"
+#include "../model/Curve.hpp"
 #include "../model/AvailabilityManagerOptimumStart.hpp"
 #include "../model/AvailabilityManagerNightCycle.hpp"
 #include "../model/ConstructionBase.hpp"
@@ -167,6 +169,14 @@ namespace sdd {
     // Return the "TrmlUnit" element serving a zone named znNameElement.text().as_string()
     pugi::xml_node findTrmlUnitElementForZone(const pugi::xml_node& znNameElement);
 
+    // Name resolution for schedule and curve references, these are used in many places and
+    // model.getModelObjectByName scans every object in the model on each call
+    boost::optional<model::Schedule> scheduleByName(const std::string& name, const openstudio::model::Model& model);
+    boost::optional<model::Curve> curveByName(const std::string& name, const openstudio::model::Model& model);
+    void clearNameTables();
+    ModelObjectNameTable<model::Schedule> m_schedulesByName;
+    ModelObjectNameTable<model::Curve> m_curvesByName;
+
     model::Schedule defaultDeckTempSchedule(openstudio::model::Model& model);
     boost::optional<model::Schedule> m_defaultDeckTempSchedule;
 
@@ -31,6 +31,7 @@
 #include "SDDFixture.hpp"
 
 #include "../ReverseTranslator.hpp"
+#include "../ModelObjectNameTable.hpp"
 
 #include "../../model/Model.hpp"
 #include "../../model/Facility.hpp"
@@ -51,6 +52,10 @@
 #include "../../model/YearDescription_Impl.hpp"
 #include "../../model/RunPeriodControlSpecialDays.hpp"
 #include "../../model/RunPeriodControlSpecialDays_Impl.hpp"
+#include "../../model/Schedule.hpp"
+#include "../../model/Schedule_Impl.hpp"
+#include "../../model/ScheduleConstant.hpp"
+#include "../../model/ScheduleConstant_Impl.hpp"
 
 
 #include "../../utilities/core/Optional.hpp"
@@ -58,6 +63,7 @@
 #include <resources.hxx>
 
 #include <sstream>
+#include <chrono>
 
 TEST_F(SDDFixture, ReverseTranslator_load) {
 
@@ -71,3 +77,67 @@ TEST_F(SDDFixture, ReverseTranslator_load) {
   EXPECT_TRUE(_m);
 
 }
+
+TEST_F(SDDFixture, ReverseTranslator_ImportTime) {
+
+  // schedule and curve references are resolved by name many times per air system, record import times to track this
+  for (const std::string& fileName : {"simxml/OffLrg-ThermalEnergyStorage_StoragePriority-ap.xml", "simxml/ClassLevel_Test-3.xml"}) {
+    openstudio::path p = resourcesPath() / openstudio::toPath(fileName);
+    ASSERT_TRUE(openstudio::filesystem::exists(p)) << "Path '" << p << "' doesn't exist.";
+
+    openstudio::sdd::ReverseTranslator rt;
+    auto start = std::chrono::steady_clock::now();
+    boost::optional<openstudio::model::Model> _m = rt.loadModel(p);
+    auto end = std::chrono::steady_clock::now();
+    ASSERT_TRUE(_m);
+
+    // the name tables must not carry over from the first model
+    boost::optional<openstudio::model::Model> _m2 = rt.loadModel(p);
+    ASSERT_TRUE(_m2);
+    EXPECT_EQ(_m->getModelObjects<openstudio::model::Schedule>().size(), _m2->getModelObjects<openstudio::model::Schedule>().size());
+    EXPECT_EQ(_m->objects().size(), _m2->objects().size());
+
+    RecordProperty(openstudio::toString(p.stem()) + "_TranslationTimeMs",
+                   std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()));
+  }
+}
+
+TEST_F(SDDFixture, ReverseTranslator_ModelObjectNameTable) {
+  openstudio::model::Model model;
+  openstudio::model::ScheduleConstant schedA(model);
+  schedA.setName("Schedule A");
+  openstudio::model::ScheduleConstant schedB(model);
+  schedB.setName("Schedule B");
+
+  openstudio::sdd::ModelObjectNameTable<openstudio::model::Schedule> table;
+  ASSERT_TRUE(table.find("schedule a", model));
+  EXPECT_EQ(schedA.handle(), table.find("schedule a", model)->handle());
+  EXPECT_FALSE(table.find("Schedule C", model));
+  EXPECT_FALSE(table.find("", model));
+
+  // renaming does not change the number of objects in the model
+  schedB.setName("Schedule C");
+  ASSERT_TRUE(table.find("Schedule C", model));
+  EXPECT_EQ(schedB.handle(), table.find("Schedule C", model)->handle());
+  EXPECT_FALSE(table.find("Schedule B", model));
+
+  // neither does removing one object and adding another
+  unsigned numObjects = model.numObjects();
+  schedA.remove();
+  openstudio::model::ScheduleConstant schedD(model);
+  schedD.setName("Schedule D");
+  ASSERT_EQ(numObjects, model.numObjects());
+  ASSERT_TRUE(table.find("Schedule D", model));
+  EXPECT_EQ(schedD.handle(), table.find("Schedule D", model)->handle());
+  EXPECT_FALSE(table.find("Schedule A", model));
+
+  // a new object takes the name of a renamed one
+  schedD.setName("Schedule E");
+  schedB.setName("Schedule D");
+  ASSERT_TRUE(table.find("Schedule D", model));
+  EXPECT_EQ(schedB.handle(), table.find("Schedule D", model)->handle());
+
+  table.clear();
+  ASSERT_TRUE(table.find("Schedule E", model));
+  EXPECT_EQ(schedD.handle(), table.find("Schedule E", model)->handle());
+}
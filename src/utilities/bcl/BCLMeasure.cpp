@@ -35,6 +35,7 @@
 #include "../core/StringHelpers.hpp"
 #include "../core/FileReference.hpp"
 #include "../core/Assert.hpp"
+#include "../core/Checksum.hpp"
 
 #include <OpenStudio.hxx>
 
@@ -46,8 +47,78 @@
 
 #include <src/utilities/embedded_files.hxx>
 
+#include <mutex>
+
 namespace openstudio{
 
+  namespace {
+
+    // file backing the ChecksumCache for measure files, loaded once per process
+    struct MeasureChecksumCacheFile {
+      std::mutex mutex;
+      boost::optional<openstudio::path> path;
+      bool loaded = false;
+    };
+
+    MeasureChecksumCacheFile& measureChecksumCacheFile()
+    {
+      static MeasureChecksumCacheFile file;
+      return file;
+    }
+
+    // call with the file's mutex locked
+    const openstudio::path& measureChecksumCachePath(MeasureChecksumCacheFile& file)
+    {
+      if (!file.path) {
+        file.path = openstudio::filesystem::home_path() / toPath("BCL") / toPath("measure_checksums.txt");
+      }
+      return *file.path;
+    }
+
+    void loadMeasureChecksumCache()
+    {
+      MeasureChecksumCacheFile& file = measureChecksumCacheFile();
+      std::lock_guard<std::mutex> lock(file.mutex);
+      if (file.loaded) {
+        return;
+      }
+      file.loaded = true;
+
+      const openstudio::path& cachePath = measureChecksumCachePath(file);
+      if (!cachePath.empty() && openstudio::filesystem::exists(cachePath)) {
+        ChecksumCache::instance().load(cachePath);
+      }
+    }
+
+    void saveMeasureChecksumCache()
+    {
+      ChecksumCacheSingleton& checksumCache = ChecksumCache::instance();
+      if (!checksumCache.isDirty()) {
+        return;
+      }
+
+      MeasureChecksumCacheFile& file = measureChecksumCacheFile();
+      std::lock_guard<std::mutex> lock(file.mutex);
+      const openstudio::path& cachePath = measureChecksumCachePath(file);
+      if (cachePath.empty()) {
+        return;
+      }
+
+      // pick up entries written by other processes since this one loaded the file
+      boost::system::error_code ec;
+      if (openstudio::filesystem::exists(cachePath, ec)) {
+        checksumCache.load(cachePath);
+      } else if (cachePath.has_parent_path()) {
+        openstudio::filesystem::create_directories(cachePath.parent_path(), ec);
+      }
+
+      if (!checksumCache.save(cachePath)) {
+        LOG_FREE(Warn, "utilities.bcl.BCLMeasure", "Could not save measure file checksums to '" << toString(cachePath) << "'");
+      }
+    }
+
+  } // namespace
+
   void BCLMeasure::createDirectory(const openstudio::path& dir) const {
     if (exists(dir)){
       if (!isEmptyDirectory(dir)){
@@ -590,6 +661,21 @@ namespace openstudio{
     return result;
   }
 
+  openstudio::path BCLMeasure::checksumCachePath()
+  {
+    MeasureChecksumCacheFile& file = measureChecksumCacheFile();
+    std::lock_guard<std::mutex> lock(file.mutex);
+    return measureChecksumCachePath(file);
+  }
+
+  void BCLMeasure::setChecksumCachePath(const openstudio::path& cachePath)
+  {
+    MeasureChecksumCacheFile& file = measureChecksumCacheFile();
+    std::lock_guard<std::mutex> lock(file.mutex);
+    file.path = cachePath;
+    file.loaded = false;
+  }
+
   openstudio::path BCLMeasure::directory() const
   {
     return m_directory;
@@ -1001,6 +1087,9 @@ namespace openstudio{
   {
     bool result = false;
 
+    // files hashed by an earlier process are not re-read if unchanged
+    loadMeasureChecksumCache();
+
     std::vector<BCLFileReference> filesToRemove;
     std::vector<BCLFileReference> filesToAdd;
     for (BCLFileReference file : m_bclXML.files()) {
@@ -1150,6 +1239,8 @@ namespace openstudio{
       }
     }
 
+    saveMeasureChecksumCache();
+
     for (const BCLFileReference& file : filesToRemove) {
       m_bclXML.removeFile(file.path());
     }
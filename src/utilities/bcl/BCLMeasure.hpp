@@ -279,6 +279,13 @@ namespace openstudio{
     /// get all measures in an input directory
     static std::vector<BCLMeasure> getMeasuresInDir(const openstudio::path& dir);
 
+    /// File where checkForUpdatesFiles keeps file checksums between processes so that unchanged files are
+    /// not re-read, defaults to measure_checksums.txt in the user's BCL directory
+    static openstudio::path checksumCachePath();
+
+    /// Set the file returned by checksumCachePath, an empty path keeps checksums for this process only
+    static void setChecksumCachePath(const openstudio::path& cachePath);
+
   //@}
   private:
     // configure logging
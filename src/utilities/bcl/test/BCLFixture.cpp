@@ -30,6 +30,7 @@
 #include "BCLFixture.hpp"
 
 #include "../LocalBCL.hpp"
+#include "../BCLMeasure.hpp"
 
 using openstudio::LocalBCL;
 using openstudio::Logger;
@@ -80,6 +81,9 @@ void BCLFixture::SetUpTestSuite() {
   // set up logging
   logFile = FileLogSink(toPath("./BCLFixture.log"));
   logFile->setLogLevel(Info);
+
+  // keep measure file checksums out of the user's BCL directory
+  openstudio::BCLMeasure::setChecksumCachePath(toPath("./BCLFixture_checksums.txt"));
 }
 
 void BCLFixture::TearDownTestSuite() {
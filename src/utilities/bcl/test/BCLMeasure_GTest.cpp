@@ -30,6 +30,7 @@
 #include <gtest/gtest.h>
 #include "BCLFixture.hpp"
 #include "../../core/PathHelpers.hpp"
+#include "../../core/Checksum.hpp"
 
 #include "../BCLMeasure.hpp"
 
@@ -122,6 +123,37 @@ TEST_F(BCLFixture, BCLMeasure)
   ASSERT_TRUE(measure2->primaryRubyScriptPath());
 }
 
+TEST_F(BCLFixture, BCLMeasure_ChecksumCache)
+{
+  openstudio::path cachePath = openstudio::filesystem::system_complete(toPath("./BCLMeasure_ChecksumCache.txt"));
+  if (exists(cachePath)) {
+    openstudio::filesystem::remove(cachePath);
+  }
+  BCLMeasure::setChecksumCachePath(cachePath);
+  EXPECT_EQ(cachePath, BCLMeasure::checksumCachePath());
+  ChecksumCache::instance().clear();
+
+  openstudio::path dir = resourcesPath() / toPath("/utilities/BCL/Measures/v2/SetWindowToWallRatioByFacade/");
+  boost::optional<BCLMeasure> measure = BCLMeasure::load(dir);
+  ASSERT_TRUE(measure);
+
+  EXPECT_FALSE(measure->checkForUpdatesFiles());
+  EXPECT_TRUE(exists(cachePath));
+  EXPECT_FALSE(ChecksumCache::instance().isDirty());
+  unsigned numEntries = ChecksumCache::instance().size();
+  EXPECT_EQ(6u, numEntries);
+
+  // simulate a new process, checksums come from the cache file rather than from re-reading the measure files
+  ChecksumCache::instance().clear();
+  BCLMeasure::setChecksumCachePath(cachePath);
+  EXPECT_FALSE(measure->checkForUpdatesFiles());
+  EXPECT_EQ(numEntries, ChecksumCache::instance().size());
+  EXPECT_FALSE(ChecksumCache::instance().isDirty());
+
+  ChecksumCache::instance().clear();
+  openstudio::filesystem::remove(cachePath);
+}
+
 TEST_F(BCLFixture, BCLMeasure_CTor)
 {
   openstudio::path dir = openstudio::filesystem::system_complete(toPath("./TestMeasure/"));
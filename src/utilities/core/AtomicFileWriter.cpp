@@ -0,0 +1,128 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "AtomicFileWriter.hpp"
+#include "UUID.hpp"
+
+#include <boost/system/error_code.hpp>
+
+namespace openstudio {
+
+  AtomicFileWriter::AtomicFileWriter(const path& p, size_t bufferSize)
+    : m_path(p),
+      m_tempPath(p),
+      m_bufferSize(bufferSize),
+      m_good(false),
+      m_committed(false)
+  {
+    m_tempPath += toPath("." + removeBraces(createUUID()) + ".tmp");
+    m_buffer.reserve(m_bufferSize);
+    m_file.open(m_tempPath, std::ios_base::out | std::ios_base::trunc);
+    m_good = m_file.good();
+  }
+
+  AtomicFileWriter::~AtomicFileWriter()
+  {
+    if (!m_committed) {
+      if (m_file.is_open()) {
+        m_file.close();
+      }
+      boost::system::error_code ec;
+      openstudio::filesystem::remove(m_tempPath, ec);
+    }
+  }
+
+  bool AtomicFileWriter::good() const
+  {
+    return m_good;
+  }
+
+  const path& AtomicFileWriter::destination() const
+  {
+    return m_path;
+  }
+
+  std::string& AtomicFileWriter::buffer()
+  {
+    return m_buffer;
+  }
+
+  void AtomicFileWriter::flushIfFull()
+  {
+    if (m_buffer.size() >= m_bufferSize) {
+      flush();
+    }
+  }
+
+  void AtomicFileWriter::flush()
+  {
+    if (m_good && !m_buffer.empty()) {
+      m_file.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+      m_good = m_file.good();
+    }
+    // keeps the capacity for the next batch of text
+    m_buffer.clear();
+  }
+
+  bool AtomicFileWriter::commit()
+  {
+    if (m_committed) {
+      return true;
+    }
+
+    flush();
+    m_file.close();
+    m_good = m_good && !m_file.fail();
+    if (!m_good) {
+      return false;
+    }
+
+    boost::system::error_code ec;
+    // the temporary file was created with default permissions, keep those of the file being replaced
+    openstudio::filesystem::file_status destinationStatus = openstudio::filesystem::status(m_path, ec);
+    if (!ec && openstudio::filesystem::exists(destinationStatus)) {
+      openstudio::filesystem::permissions(m_tempPath, destinationStatus.permissions(), ec);
+      if (ec) {
+        m_good = false;
+        return false;
+      }
+    }
+
+    ec.clear();
+    openstudio::filesystem::rename(m_tempPath, m_path, ec);
+    if (ec) {
+      m_good = false;
+      return false;
+    }
+
+    m_committed = true;
+    return true;
+  }
+
+} // openstudio
@@ -0,0 +1,88 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_CORE_ATOMICFILEWRITER_HPP
+#define UTILITIES_CORE_ATOMICFILEWRITER_HPP
+
+#include "../UtilitiesAPI.hpp"
+#include "Filesystem.hpp"
+#include "Path.hpp"
+
+#include <string>
+
+namespace openstudio {
+
+  /** Writes a file through a large reusable in-memory buffer. Text is written to a uniquely named
+   *  temporary file next to the destination, and commit renames it over the destination, so
+   *  readers never see a partially written file. If commit is not called, or fails, the
+   *  temporary file is removed and the destination is left untouched. An existing destination
+   *  keeps its permissions. */
+  class UTILITIES_API AtomicFileWriter {
+   public:
+
+    /// opens a temporary file next to p, buffering up to bufferSize bytes between writes
+    explicit AtomicFileWriter(const path& p, size_t bufferSize = 1 << 20);
+
+    /// removes the temporary file if commit was not called or failed
+    ~AtomicFileWriter();
+
+    AtomicFileWriter(const AtomicFileWriter&) = delete;
+    AtomicFileWriter& operator=(const AtomicFileWriter&) = delete;
+
+    /// returns true if the temporary file was opened and nothing has failed yet
+    bool good() const;
+
+    /// the destination path
+    const path& destination() const;
+
+    /// the buffer to append text to, call flushIfFull after appending
+    std::string& buffer();
+
+    /// writes the buffer to the temporary file once it holds at least bufferSize bytes
+    void flushIfFull();
+
+    /// writes any remaining text and renames the temporary file over the destination, returns false on failure
+    bool commit();
+
+   private:
+
+    void flush();
+
+    path m_path;
+    path m_tempPath;
+    size_t m_bufferSize;
+    std::string m_buffer;
+    openstudio::filesystem::ofstream m_file;
+    bool m_good;
+    bool m_committed;
+  };
+
+} // openstudio
+
+#endif // UTILITIES_CORE_ATOMICFILEWRITER_HPP
@@ -28,8 +28,11 @@
 ***********************************************************************************************************************/
 
 #include "Checksum.hpp"
+#include "AtomicFileWriter.hpp"
+#include "Filesystem.hpp"
 
 #include <sstream>
+#include <vector>
 
 #include <boost/crc.hpp>
 
@@ -61,19 +64,22 @@ namespace openstudio {
   std::string checksum(std::istream& is)
   {
     boost::crc_32_type  crc;
+
+    // read in large blocks, ignored characters are compacted out of the buffer in place
+    // without branching so the result is identical to hashing the filtered stream
+    const std::streamsize n = 65536;
+    std::vector<char> buffer(static_cast<size_t>(n));
     do{
-      const std::streamsize n = 1024;
-      char  buffer[n];
-      is.read(buffer, n);
-      std::streamsize readSize = is.gcount();
-      //crc.process_bytes(buffer, readSize);
-
-      size_t stringSize = static_cast<size_t>(readSize);
-      std::string str(buffer, stringSize);
-      str.erase( std::remove_if( str.begin(), str.end(), openstudio::detail::checksumIgnore ), str.end() );
-      stringSize = str.size();
-
-      crc.process_bytes(str.c_str(), stringSize);
+      is.read(buffer.data(), n);
+      const char* in = buffer.data();
+      const char* end = in + is.gcount();
+      char* out = buffer.data();
+      for (; in != end; ++in) {
+        *out = *in;
+        out += !openstudio::detail::checksumIgnore(*in);
+      }
+
+      crc.process_block(buffer.data(), out);
     } while ( is );
 
     std::stringstream ss;
@@ -107,4 +113,154 @@ namespace openstudio {
     return result;
   }
 
+  ChecksumCacheSingleton::ChecksumCacheSingleton()
+    : m_dirty(false)
+  {
+  }
+
+  std::string ChecksumCacheSingleton::checksum(const path& p)
+  {
+    boost::system::error_code ec;
+    if (!openstudio::filesystem::is_regular_file(p, ec)) {
+      return openstudio::checksum(p);
+    }
+
+    std::uintmax_t fileSize = openstudio::filesystem::file_size(p, ec);
+    if (ec) {
+      return openstudio::checksum(p);
+    }
+
+    std::time_t lastWriteTime = openstudio::filesystem::last_write_time(p, ec);
+    if (ec) {
+      return openstudio::checksum(p);
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      auto it = m_entries.find(p);
+      if ((it != m_entries.end()) && (it->second.fileSize == fileSize) && (it->second.lastWriteTime == lastWriteTime)) {
+        return it->second.checksum;
+      }
+    }
+
+    std::string result = openstudio::checksum(p);
+
+    // a file written in the last couple of seconds may be written again without changing its
+    // last write time (which has one second resolution), do not trust the cache for it yet
+    if (std::difftime(std::time(nullptr), lastWriteTime) > 2.0) {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_entries[p] = Entry{fileSize, lastWriteTime, result};
+      m_dirty = true;
+    }
+
+    return result;
+  }
+
+  bool ChecksumCacheSingleton::load(const path& cacheFile)
+  {
+    openstudio::filesystem::ifstream ifs(cacheFile);
+    if (!ifs) {
+      return false;
+    }
+
+    std::map<path, Entry> entries;
+    std::string line;
+    while (std::getline(ifs, line)) {
+      // each line is "checksum fileSize lastWriteTime path", path is last as it may contain spaces
+      std::istringstream iss(line);
+      Entry entry;
+      long long lastWriteTime;
+      if (!(iss >> entry.checksum >> entry.fileSize >> lastWriteTime) || (entry.checksum.size() != 8)) {
+        continue;
+      }
+      entry.lastWriteTime = static_cast<std::time_t>(lastWriteTime);
+
+      std::string pathString;
+      iss.get();
+      if (!std::getline(iss, pathString) || pathString.empty()) {
+        continue;
+      }
+      entries[toPath(pathString)] = entry;
+    }
+
+    // entries hashed by this process are at least as recent as those in the file
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto& entry : entries) {
+      m_entries.insert(entry);
+    }
+
+    return true;
+  }
+
+  bool ChecksumCacheSingleton::save(const path& cacheFile)
+  {
+    std::map<path, Entry> entries;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      entries = m_entries;
+    }
+
+    // entries for deleted or moved files would otherwise accumulate in the file forever
+    std::vector<path> missing;
+    for (const auto& entry : entries) {
+      boost::system::error_code ec;
+      if (!openstudio::filesystem::is_regular_file(entry.first, ec)) {
+        missing.push_back(entry.first);
+      }
+    }
+    for (const auto& p : missing) {
+      entries.erase(p);
+    }
+
+    // the file is shared between processes, write it to a temporary file and rename it into place
+    // so that a concurrent load or a crash never sees a partial cache
+    AtomicFileWriter writer(cacheFile);
+    for (const auto& entry : entries) {
+      std::string& buffer = writer.buffer();
+      buffer += entry.second.checksum;
+      buffer += ' ';
+      buffer += std::to_string(entry.second.fileSize);
+      buffer += ' ';
+      buffer += std::to_string(static_cast<long long>(entry.second.lastWriteTime));
+      buffer += ' ';
+      buffer += toString(entry.first);
+      buffer += '\n';
+      writer.flushIfFull();
+    }
+    if (!writer.commit()) {
+      return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& p : missing) {
+      m_entries.erase(p);
+    }
+    m_dirty = false;
+    return true;
+  }
+
+  void ChecksumCacheSingleton::remove(const path& p)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.erase(p);
+  }
+
+  void ChecksumCacheSingleton::clear()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+  }
+
+  unsigned ChecksumCacheSingleton::size() const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return static_cast<unsigned>(m_entries.size());
+  }
+
+  bool ChecksumCacheSingleton::isDirty() const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_dirty;
+  }
+
 } // openstudio
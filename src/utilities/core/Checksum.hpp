@@ -31,10 +31,15 @@
 #define UTILITIES_CORE_CHECKSUM_HPP
 
 #include "Path.hpp"
+#include "Singleton.hpp"
 #include "../UtilitiesAPI.hpp"
 
 #include <string>
 #include <ostream>
+#include <map>
+#include <mutex>
+#include <ctime>
+#include <cstdint>
 
 namespace openstudio {
 
@@ -50,6 +55,65 @@ namespace openstudio {
   /// returns the CRC-16 checksum of the first len bytes of data.  Replaces Qt implementation qChecksum.
   UTILITIES_API int crc16(const char *ptr, int count);
 
+  /** Singleton cache of file checksums keyed on (path, size, last write time).  A file whose size and
+   *  last write time are unchanged since it was last hashed is not re-read.  The cache may be saved to
+   *  and loaded from disk so that it persists between processes. */
+  class UTILITIES_API ChecksumCacheSingleton {
+
+    friend class Singleton<ChecksumCacheSingleton>;
+
+   public:
+
+    /// return 8 character hex checksum of file contents, same result as checksum(const path&)
+    std::string checksum(const path& p);
+
+    /// merge entries from a cache file written by save, keeping entries already in the cache, returns false if the file could not be read
+    bool load(const path& cacheFile);
+
+    /// drop entries for files that no longer exist, then atomically replace cacheFile with the remaining
+    /// entries, returns false if the file could not be written
+    bool save(const path& cacheFile);
+
+    /// remove the entry for p, if any
+    void remove(const path& p);
+
+    /// remove all entries
+    void clear();
+
+    /// number of cached entries
+    unsigned size() const;
+
+    /// true if files have been hashed into the cache since the last save
+    bool isDirty() const;
+
+   private:
+
+    /// private constructor
+    ChecksumCacheSingleton();
+
+    struct Entry {
+      std::uintmax_t fileSize;
+      std::time_t lastWriteTime;
+      std::string checksum;
+    };
+
+    mutable std::mutex m_mutex;
+
+    std::map<path, Entry> m_entries;
+
+    bool m_dirty;
+  };
+
+#if _WIN32 || _MSC_VER
+
+  /// Explicitly instantiate and export ChecksumCacheSingleton Singleton template instance
+  /// so that the same instance is shared between the DLL's that link to Utilities.dll
+  UTILITIES_TEMPLATE_EXT template class UTILITIES_API openstudio::Singleton<ChecksumCacheSingleton>;
+
+#endif
+
+  typedef openstudio::Singleton<ChecksumCacheSingleton> ChecksumCache;
+
 } // openstudio
 
 
@@ -5,6 +5,8 @@
   #include <utilities/core/Checksum.hpp>
 %}
 
+%template(ChecksumCache) openstudio::Singleton<openstudio::ChecksumCacheSingleton>;
+
 %include <utilities/core/Checksum.hpp>
 
 #endif //UTILITIES_CORE_CHECKSUM_I
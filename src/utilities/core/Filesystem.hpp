@@ -56,6 +56,8 @@ namespace filesystem {
   using boost::filesystem::filesystem_error;
   using boost::filesystem::copy_option;
   using boost::filesystem::directory_entry;
+  using boost::filesystem::file_status;
+  using boost::filesystem::perms;
 
   // functions
   using boost::filesystem::basename;
@@ -76,8 +78,11 @@ namespace filesystem {
   using boost::filesystem::is_regular_file;
   using boost::filesystem::is_symlink;
   using boost::filesystem::last_write_time;
+  using boost::filesystem::permissions;
   using boost::filesystem::remove;
   using boost::filesystem::remove_all;
+  using boost::filesystem::rename;
+  using boost::filesystem::status;
   using boost::filesystem::file_size;
   using boost::filesystem::system_complete;
   using boost::filesystem::temp_directory_path;
@@ -0,0 +1,94 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_CORE_PARALLEL_HPP
+#define UTILITIES_CORE_PARALLEL_HPP
+
+#include "System.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace openstudio {
+
+  /** Calls func(i) for each i in [0, n), splitting the range into contiguous blocks run on up to
+   *  System::numberOfProcessors() threads.  func must only modify state owned by index i.  Ranges smaller
+   *  than 2*minBlockSize are run on the calling thread.  If any call throws, the first exception is
+   *  rethrown on the calling thread once all threads have finished. */
+  template <typename Func>
+  void parallelFor(std::size_t n, Func func, std::size_t minBlockSize = 64)
+  {
+    std::size_t numThreads = std::min<std::size_t>(System::numberOfProcessors(), n / std::max<std::size_t>(minBlockSize, 1));
+    if (numThreads < 2) {
+      for (std::size_t i = 0; i < n; ++i) {
+        func(i);
+      }
+      return;
+    }
+
+    std::exception_ptr exception;
+    std::mutex exceptionMutex;
+    auto runBlock = [&](std::size_t begin, std::size_t end) {
+      try {
+        for (std::size_t i = begin; i < end; ++i) {
+          func(i);
+        }
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(exceptionMutex);
+        if (!exception) {
+          exception = std::current_exception();
+        }
+      }
+    };
+
+    std::size_t blockSize = (n + numThreads - 1) / numThreads;
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads - 1);
+    for (std::size_t t = 1; t < numThreads; ++t) {
+      std::size_t begin = std::min(n, t * blockSize);
+      std::size_t end = std::min(n, begin + blockSize);
+      threads.emplace_back(runBlock, begin, end);
+    }
+    runBlock(0, std::min(n, blockSize));
+    for (auto& thread : threads) {
+      thread.join();
+    }
+
+    if (exception) {
+      std::rethrow_exception(exception);
+    }
+  }
+
+} // openstudio
+
+#endif // UTILITIES_CORE_PARALLEL_HPP
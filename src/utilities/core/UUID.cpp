@@ -31,7 +31,14 @@
 #include "String.hpp"
 #include "StaticInitializer.hpp"
 
+#include <atomic>
 #include <sstream>
+#include <random>
+#include <cstring>
+
+#if !(defined (_WIN32) || defined (_WIN64))
+#include <pthread.h>
+#endif
 
 #include <boost/uuid/uuid_io.hpp>
 #include <boost/uuid/uuid_generators.hpp>
@@ -56,6 +63,110 @@ namespace openstudio {
       BoostGeneratorsInitializer m_i;
     };
 
+    /// Incremented in the child process after fork, a forked child would otherwise continue the parent's
+    /// generator states and create the same UUIDs as the parent.
+    std::atomic<unsigned> forkGeneration(0);
+
+#if !(defined (_WIN32) || defined (_WIN64))
+    void onForkChild()
+    {
+      ++forkGeneration;
+    }
+#endif
+
+    bool registerForkHandler()
+    {
+#if !(defined (_WIN32) || defined (_WIN64))
+      pthread_atfork(nullptr, nullptr, &onForkChild);
+#endif
+      return true;
+    }
+
+    /// Generates version 4 UUIDs from a xoshiro256** generator seeded once per thread from the OS entropy source,
+    /// and again in a child process after fork. Handles only need to be unique, not unpredictable, so this avoids
+    /// going back to the OS for every UUID.
+    class FastUUIDGenerator
+    {
+    public:
+      FastUUIDGenerator()
+      {
+        seed();
+      }
+
+      boost::uuids::uuid operator()()
+      {
+        if (m_forkGeneration != forkGeneration.load(std::memory_order_relaxed)) {
+          seed();
+        }
+
+        uint64_t words[2] = { next(), next() };
+        boost::uuids::uuid result;
+        static_assert(sizeof(words) == sizeof(result.data), "UUID is 128 bits");
+        std::memcpy(result.data, words, sizeof(words));
+
+        // RFC 4122 version 4 (random) and variant 1 bits
+        result.data[6] = static_cast<uint8_t>((result.data[6] & 0x0F) | 0x40);
+        result.data[8] = static_cast<uint8_t>((result.data[8] & 0x3F) | 0x80);
+        return result;
+      }
+
+    private:
+      void seed()
+      {
+        m_forkGeneration = forkGeneration.load(std::memory_order_relaxed);
+        std::random_device device;
+        for (uint64_t& word : m_state) {
+          word = (static_cast<uint64_t>(device()) << 32) ^ static_cast<uint64_t>(device());
+        }
+        // the all zero state is the only one that xoshiro can not leave
+        if ((m_state[0] | m_state[1] | m_state[2] | m_state[3]) == 0) {
+          m_state[0] = 0x9E3779B97F4A7C15ull;
+        }
+      }
+
+      static uint64_t rotl(uint64_t x, int k)
+      {
+        return (x << k) | (x >> (64 - k));
+      }
+
+      uint64_t next()
+      {
+        const uint64_t result = rotl(m_state[1] * 5, 7) * 9;
+        const uint64_t t = m_state[1] << 17;
+        m_state[2] ^= m_state[0];
+        m_state[3] ^= m_state[1];
+        m_state[1] ^= m_state[2];
+        m_state[0] ^= m_state[3];
+        m_state[2] ^= t;
+        m_state[3] = rotl(m_state[3], 45);
+        return result;
+      }
+
+      uint64_t m_state[4];
+      unsigned m_forkGeneration;
+    };
+
+    FastUUIDGenerator& fastUUIDGenerator()
+    {
+      static const bool forkHandlerRegistered = registerForkHandler();
+      (void)forkHandlerRegistered;
+      thread_local FastUUIDGenerator gen;
+      return gen;
+    }
+
+    /// Writes the 36 character lowercase form of uuid, as boost::uuids::operator<< does, to out.
+    void writeUUIDChars(const boost::uuids::uuid& uuid, char* out)
+    {
+      static const char hex[] = "0123456789abcdef";
+      for (size_t i = 0; i < 16; ++i) {
+        if (i == 4 || i == 6 || i == 8 || i == 10) {
+          *out++ = '-';
+        }
+        *out++ = hex[(uuid.data[i] >> 4) & 0x0F];
+        *out++ = hex[uuid.data[i] & 0x0F];
+      }
+    }
+
   }
 
 
@@ -71,13 +182,7 @@ UUID::UUID(const boost::uuids::uuid &t_other)
 
 UUID UUID::random_generate()
 {
-  static boost::thread_specific_ptr<boost::uuids::random_generator> gen;
-
-  if (gen.get() == nullptr) {
-    gen.reset(new boost::uuids::random_generator);
-  }
-
-  return UUID((*gen)());
+  return UUID(detail::fastUUIDGenerator()());
 }
 
 UUID UUID::string_generate(const std::string &t_str)
@@ -131,11 +236,10 @@ bool operator> ( const UUID & lhs, const UUID & rhs ) {
 
 std::string toString(const UUID& uuid)
 {
-  std::stringstream ss;
-  ss << '{';
-  boost::uuids::operator<<(ss, uuid);
-  ss << '}';
-  return ss.str();
+  std::string result(38, '{');
+  detail::writeUUIDChars(uuid, &result[1]);
+  result[37] = '}';
+  return result;
 }
 
 
@@ -149,9 +253,9 @@ std::string createUniqueName(const std::string& prefix) {
 }
 
 std::string removeBraces(const UUID& uuid) {
-  std::stringstream ss;
-  boost::uuids::operator<<(ss, uuid);
-  return ss.str();
+  std::string result(36, '-');
+  detail::writeUUIDChars(uuid, &result[0]);
+  return result;
 }
 
 std::ostream& operator<<(std::ostream& os,const UUID& uuid) {
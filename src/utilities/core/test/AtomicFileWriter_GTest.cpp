@@ -0,0 +1,121 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "../AtomicFileWriter.hpp"
+#include "../Filesystem.hpp"
+#include "../FilesystemHelpers.hpp"
+
+using namespace openstudio;
+
+TEST(AtomicFileWriter, Commit)
+{
+  openstudio::path dir = openstudio::filesystem::create_temporary_directory(toPath("AtomicFileWriter"));
+  ASSERT_FALSE(dir.empty());
+  openstudio::path p = dir / toPath("file.txt");
+
+  // small buffer so that text is flushed several times
+  {
+    AtomicFileWriter writer(p, 16);
+    ASSERT_TRUE(writer.good());
+    EXPECT_EQ(p, writer.destination());
+    for (unsigned i = 0; i < 100; ++i) {
+      writer.buffer() += "line " + std::to_string(i) + "\n";
+      writer.flushIfFull();
+    }
+    EXPECT_FALSE(openstudio::filesystem::exists(p));
+    EXPECT_TRUE(writer.commit());
+  }
+  ASSERT_TRUE(openstudio::filesystem::exists(p));
+  std::string text = openstudio::filesystem::read_as_string(p);
+  EXPECT_EQ(0u, text.find("line 0\n"));
+  EXPECT_NE(std::string::npos, text.find("line 99\n"));
+
+  // not committing leaves the existing file untouched
+  {
+    AtomicFileWriter writer(p);
+    ASSERT_TRUE(writer.good());
+    writer.buffer() += "replaced";
+  }
+  EXPECT_EQ(text, openstudio::filesystem::read_as_string(p));
+
+  // committing replaces it
+  {
+    AtomicFileWriter writer(p);
+    writer.buffer() += "replaced";
+    EXPECT_TRUE(writer.commit());
+  }
+  EXPECT_EQ("replaced", openstudio::filesystem::read_as_string(p));
+
+  // only the destination is left in the directory
+  EXPECT_EQ(1u, openstudio::filesystem::directory_files(dir).size());
+  openstudio::filesystem::remove_all(dir);
+}
+
+TEST(AtomicFileWriter, BadPath)
+{
+  openstudio::path p = toPath("AtomicFileWriterMissingDirectory/file.txt");
+  AtomicFileWriter writer(p);
+  EXPECT_FALSE(writer.good());
+  writer.buffer() += "text";
+  EXPECT_FALSE(writer.commit());
+  EXPECT_FALSE(openstudio::filesystem::exists(p));
+}
+
+TEST(AtomicFileWriter, KeepsPermissions)
+{
+  openstudio::path dir = openstudio::filesystem::create_temporary_directory(toPath("AtomicFileWriter"));
+  ASSERT_FALSE(dir.empty());
+  openstudio::path p = dir / toPath("file.txt");
+
+  {
+    AtomicFileWriter writer(p);
+    writer.buffer() += "original";
+    EXPECT_TRUE(writer.commit());
+  }
+
+  openstudio::filesystem::perms expected = boost::filesystem::owner_read | boost::filesystem::owner_write;
+#if (defined (_WIN32) || defined (_WIN64))
+  // only the read-only attribute exists on Windows, keep the file writable so it can be replaced
+  expected = openstudio::filesystem::status(p).permissions();
+#endif
+  openstudio::filesystem::permissions(p, expected);
+  ASSERT_EQ(expected, openstudio::filesystem::status(p).permissions());
+
+  {
+    AtomicFileWriter writer(p);
+    writer.buffer() += "replaced";
+    EXPECT_TRUE(writer.commit());
+  }
+  EXPECT_EQ("replaced", openstudio::filesystem::read_as_string(p));
+  EXPECT_EQ(expected, openstudio::filesystem::status(p).permissions());
+
+  openstudio::filesystem::remove_all(dir);
+}
@@ -32,12 +32,14 @@
 #include "../Checksum.hpp"
 #include "../UUID.hpp"
 #include "../Containers.hpp"
+#include "../Filesystem.hpp"
 
 #include <resources.hxx>
 
 using openstudio::path;
 using openstudio::toPath;
 using openstudio::checksum;
+using openstudio::ChecksumCache;
 using openstudio::createUUID;
 using openstudio::StringVector;
 using openstudio::toString;
@@ -113,6 +115,103 @@ TEST(Checksum, Paths)
   EXPECT_EQ("00000000", checksum(p));
 }
 
+TEST(Checksum, LargeStreams)
+{
+  // ignored characters on either side of the internal read block boundaries must not change the result
+  string withCR;
+  string withoutCR;
+  for (unsigned i = 0; i < 200000; ++i) {
+    char c = static_cast<char>('a' + (i % 26));
+    withCR += c;
+    withoutCR += c;
+    if (i % 7 == 0) {
+      withCR += '\r';
+    }
+  }
+  EXPECT_EQ(checksum(withoutCR), checksum(withCR));
+  EXPECT_NE("00000000", checksum(withCR));
+}
+
+TEST(Checksum, ChecksumCache)
+{
+  path p = toPath("./ChecksumCache.txt");
+  path cacheFile = toPath("./ChecksumCache.cache");
+  if (openstudio::filesystem::exists(p)) {
+    openstudio::filesystem::remove(p);
+  }
+  if (openstudio::filesystem::exists(cacheFile)) {
+    openstudio::filesystem::remove(cacheFile);
+  }
+
+  ChecksumCache::instance().clear();
+  EXPECT_EQ(0u, ChecksumCache::instance().size());
+
+  // missing files are not cached
+  EXPECT_EQ("00000000", ChecksumCache::instance().checksum(p));
+  EXPECT_EQ(0u, ChecksumCache::instance().size());
+
+  openstudio::filesystem::ofstream file(p);
+  ASSERT_TRUE(file.is_open());
+  file << "Hi there";
+  file.close();
+
+  // recently written files are hashed but not cached
+  EXPECT_EQ("1AD514BA", ChecksumCache::instance().checksum(p));
+  EXPECT_EQ(0u, ChecksumCache::instance().size());
+
+  std::time_t lastWriteTime = std::time(nullptr) - 60;
+  openstudio::filesystem::last_write_time(p, lastWriteTime);
+  EXPECT_EQ("1AD514BA", ChecksumCache::instance().checksum(p));
+  EXPECT_EQ(1u, ChecksumCache::instance().size());
+
+  // same size and last write time, file is not re-read
+  file.open(p);
+  ASSERT_TRUE(file.is_open());
+  file << "HI there";
+  file.close();
+  openstudio::filesystem::last_write_time(p, lastWriteTime);
+  EXPECT_EQ("1AD514BA", ChecksumCache::instance().checksum(p));
+  EXPECT_EQ("D5682D26", checksum(p));
+
+  // cache persists through save and load
+  EXPECT_TRUE(ChecksumCache::instance().save(cacheFile));
+  ChecksumCache::instance().clear();
+  EXPECT_EQ(0u, ChecksumCache::instance().size());
+  EXPECT_TRUE(ChecksumCache::instance().load(cacheFile));
+  EXPECT_EQ(1u, ChecksumCache::instance().size());
+  EXPECT_EQ("1AD514BA", ChecksumCache::instance().checksum(p));
+
+  // changed last write time, file is re-read
+  openstudio::filesystem::last_write_time(p, lastWriteTime - 60);
+  EXPECT_EQ("D5682D26", ChecksumCache::instance().checksum(p));
+
+  // entries for deleted files are dropped on save
+  path deleted = toPath("./ChecksumCache_Deleted.txt");
+  file.open(deleted);
+  ASSERT_TRUE(file.is_open());
+  file << "Bye there";
+  file.close();
+  openstudio::filesystem::last_write_time(deleted, lastWriteTime);
+  ChecksumCache::instance().checksum(deleted);
+  EXPECT_EQ(2u, ChecksumCache::instance().size());
+  openstudio::filesystem::remove(deleted);
+  EXPECT_TRUE(ChecksumCache::instance().save(cacheFile));
+  EXPECT_FALSE(ChecksumCache::instance().isDirty());
+  EXPECT_EQ(1u, ChecksumCache::instance().size());
+  ChecksumCache::instance().clear();
+  EXPECT_TRUE(ChecksumCache::instance().load(cacheFile));
+  EXPECT_EQ(1u, ChecksumCache::instance().size());
+
+  // the cache file is replaced by rename, no temporary file is left next to it
+  for (const auto& entry : openstudio::filesystem::directory_iterator(openstudio::filesystem::system_complete(cacheFile).parent_path())) {
+    EXPECT_EQ(std::string::npos, toString(entry.path().filename()).find("ChecksumCache.cache."));
+  }
+
+  ChecksumCache::instance().clear();
+  openstudio::filesystem::remove(p);
+  openstudio::filesystem::remove(cacheFile);
+}
+
 TEST(Checksum, UUIDs) {
   StringVector checksums;
   for (unsigned i = 0, n = 1000; i < n; ++i) {
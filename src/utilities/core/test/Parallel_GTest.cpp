@@ -0,0 +1,65 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "../Parallel.hpp"
+
+#include <numeric>
+#include <stdexcept>
+
+using openstudio::parallelFor;
+
+TEST(Parallel, ParallelFor)
+{
+  std::vector<unsigned> values(100000, 0);
+  parallelFor(values.size(), [&values](size_t i) { values[i] = static_cast<unsigned>(i % 7); }, 1);
+  for (size_t i = 0; i < values.size(); ++i) {
+    ASSERT_EQ(i % 7, values[i]);
+  }
+
+  // small ranges run on the calling thread
+  std::vector<unsigned> small(3, 0);
+  parallelFor(small.size(), [&small](size_t i) { small[i] = 1; });
+  EXPECT_EQ(3u, std::accumulate(small.begin(), small.end(), 0u));
+
+  // nothing to do
+  parallelFor(0, [](size_t) { FAIL(); });
+}
+
+TEST(Parallel, ParallelFor_Exception)
+{
+  std::vector<unsigned> values(10000, 0);
+  EXPECT_THROW(parallelFor(values.size(), [&values](size_t i) {
+    if (i == 5000) {
+      throw std::runtime_error("failure");
+    }
+    values[i] = 1;
+  }, 1), std::runtime_error);
+}
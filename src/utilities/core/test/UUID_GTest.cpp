@@ -32,8 +32,18 @@
 #include "../UUID.hpp"
 #include "../String.hpp"
 
+#include <boost/uuid/uuid_generators.hpp>
+#include <boost/uuid/uuid_io.hpp>
+
+#include <chrono>
 #include <iostream>
 #include <set>
+#include <thread>
+
+#if !(defined (_WIN32) || defined (_WIN64))
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
 
 using std::cout;
 using openstudio::UUID;
@@ -93,3 +103,119 @@ TEST(UUID, UUID_UID) {
   EXPECT_EQ(uuid,toUUID(uuidStr));
   EXPECT_EQ(uuid,toUUID(uidStr)); // no extra conversion process
 }
+
+TEST(UUID, Version4)
+{
+  // all created UUIDs are RFC 4122 version 4 and match uuidInString
+  std::vector<UUID> uuids;
+  for (unsigned i = 0; i < 1000; ++i) {
+    uuids.push_back(createUUID());
+  }
+  for (const UUID& uuid : uuids) {
+    EXPECT_EQ(boost::uuids::uuid::version_random_number_based, uuid.version());
+    EXPECT_EQ(boost::uuids::uuid::variant_rfc_4122, uuid.variant());
+    std::string str = toString(uuid);
+    EXPECT_TRUE(boost::regex_match(str, openstudio::uuidInString()));
+    EXPECT_EQ(uuid, toUUID(str));
+  }
+
+  // formatting matches boost
+  UUID uuid = createUUID();
+  stringstream ss;
+  ss << "{" << boost::uuids::to_string(uuid) << "}";
+  EXPECT_EQ(ss.str(), toString(uuid));
+  EXPECT_EQ("{00000000-0000-0000-0000-000000000000}", toString(UUID()));
+}
+
+TEST(UUID, Threads)
+{
+  // uuids created on several threads do not collide
+  unsigned numThreads = 4;
+  unsigned numUUIDS = 100000;
+  std::vector<std::vector<UUID> > results(numThreads);
+  std::vector<std::thread> threads;
+  for (unsigned i = 0; i < numThreads; ++i) {
+    threads.push_back(std::thread([&results, i, numUUIDS]() {
+      for (unsigned j = 0; j < numUUIDS; ++j) {
+        results[i].push_back(createUUID());
+      }
+    }));
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  std::set<UUID> uuids;
+  for (const std::vector<UUID>& result : results) {
+    EXPECT_EQ(numUUIDS, result.size());
+    uuids.insert(result.begin(), result.end());
+  }
+  EXPECT_EQ(numThreads * numUUIDS, uuids.size());
+}
+
+#if !(defined (_WIN32) || defined (_WIN64))
+TEST(UUID, Fork)
+{
+  // a forked child does not continue the parent's sequence
+  createUUID();
+  int fds[2];
+  ASSERT_EQ(0, pipe(fds));
+  pid_t pid = fork();
+  ASSERT_NE(-1, pid);
+  if (pid == 0) {
+    std::string str = toString(createUUID());
+    ssize_t written = write(fds[1], str.data(), str.size());
+    _exit(written == static_cast<ssize_t>(str.size()) ? 0 : 1);
+  }
+  close(fds[1]);
+  std::string parentStr = toString(createUUID());
+  std::string childStr(parentStr.size(), ' ');
+  ssize_t numRead = read(fds[0], &childStr[0], childStr.size());
+  close(fds[0]);
+  int status = 0;
+  waitpid(pid, &status, 0);
+  ASSERT_EQ(static_cast<ssize_t>(parentStr.size()), numRead);
+  EXPECT_TRUE(WIFEXITED(status) && (WEXITSTATUS(status) == 0));
+  EXPECT_NE(parentStr, childStr);
+  EXPECT_FALSE(toUUID(childStr).isNull());
+}
+#endif
+
+TEST(UUID, Benchmark)
+{
+  unsigned numUUIDS = 1000000;
+
+  auto start = std::chrono::steady_clock::now();
+  boost::uuids::random_generator gen;
+  unsigned nonNull = 0;
+  for (unsigned i = 0; i < numUUIDS; ++i) {
+    nonNull += gen().is_nil() ? 0 : 1;
+  }
+  auto end = std::chrono::steady_clock::now();
+  RecordProperty("BoostRandomGeneratorTimeMs", std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()));
+
+  start = std::chrono::steady_clock::now();
+  for (unsigned i = 0; i < numUUIDS; ++i) {
+    nonNull += createUUID().isNull() ? 0 : 1;
+  }
+  end = std::chrono::steady_clock::now();
+  RecordProperty("CreateUUIDTimeMs", std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()));
+
+  std::vector<UUID> uuids;
+  uuids.reserve(numUUIDS);
+  for (unsigned i = 0; i < numUUIDS; ++i) {
+    uuids.push_back(createUUID());
+  }
+
+  start = std::chrono::steady_clock::now();
+  size_t length = 0;
+  for (const UUID& uuid : uuids) {
+    length += toString(uuid).size();
+  }
+  end = std::chrono::steady_clock::now();
+  RecordProperty("ToStringTimeMs", std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()));
+
+  EXPECT_EQ(2 * numUUIDS, nonNull);
+  EXPECT_EQ(numUUIDS, uuids.size());
+  EXPECT_EQ(38 * numUUIDS, length);
+}
@@ -33,6 +33,7 @@
 %template(OptionalEndUseType) boost::optional<openstudio::EndUseType>;
 %template(BuildingSectorVector) std::vector<openstudio::BuildingSector>;
 %template(OptionalBuildingSector) boost::optional<openstudio::BuildingSector>;
+%template(OptionalTimeSeriesAggregation) boost::optional<openstudio::TimeSeriesAggregation>;
 
 %include <utilities/data/DataEnums.hpp>
 %include <utilities/data/Attribute.i>
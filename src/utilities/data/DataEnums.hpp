@@ -215,6 +215,25 @@ OPENSTUDIO_ENUM(BuildingSector,
   ((Commercial)(NonResidential))
   ((Residential)));
 
+/** \class TimeSeriesAggregation
+ *  \brief How TimeSeries::resample combines the values reported in each interval of the result. Mean is weighted by
+ *  the length of each reporting interval, Percentile interpolates linearly between the closest ranks.
+ *  \details See the OPENSTUDIO_ENUM documentation in utilities/core/Enum.hpp. The actual macro call is:
+ *  \code
+OPENSTUDIO_ENUM(TimeSeriesAggregation,
+  ((Sum))
+  ((Mean))
+  ((Minimum))
+  ((Maximum))
+  ((Percentile)));
+ *  \endcode */
+OPENSTUDIO_ENUM(TimeSeriesAggregation,
+  ((Sum))
+  ((Mean))
+  ((Minimum))
+  ((Maximum))
+  ((Percentile)));
+
 } // openstudio
 
 #endif // UTILITIES_DATA_DATAENUMS_HPP
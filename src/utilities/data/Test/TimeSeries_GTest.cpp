@@ -35,6 +35,9 @@
 #include "../../time/Date.hpp"
 #include "../../time/Time.hpp"
 
+#include <chrono>
+#include <set>
+
 using namespace std;
 using namespace boost;
 using namespace openstudio;
@@ -1134,6 +1137,361 @@ TEST_F(DataFixture,TimeSeries_AddSubtractSameTimePeriod)
   EXPECT_DOUBLE_EQ(6.75, ans.value(Time(0,1,30,0)));*/
 }
 
+// the values operator+ and operator- returned when they looked up each date time in the union of both series
+void expectAlignedValues(const TimeSeries& ts1, const TimeSeries& ts2)
+{
+  std::set<DateTime> dateTimesSet;
+  DateTimeVector dateTimes1 = ts1.dateTimes();
+  DateTimeVector dateTimes2 = ts2.dateTimes();
+  dateTimesSet.insert(dateTimes1.begin(), dateTimes1.end());
+  dateTimesSet.insert(dateTimes2.begin(), dateTimes2.end());
+  DateTimeVector dateTimes(dateTimesSet.begin(), dateTimesSet.end());
+
+  TimeSeries sum = ts1 + ts2;
+  TimeSeries diff = ts1 - ts2;
+  DateTimeVector sumDateTimes = sum.dateTimes();
+  ASSERT_EQ(dateTimes.size(), sumDateTimes.size());
+  ASSERT_EQ(dateTimes.size(), diff.values().size());
+  for (unsigned i = 0; i < dateTimes.size(); ++i) {
+    EXPECT_EQ(dateTimes[i], sumDateTimes[i]);
+    EXPECT_EQ(ts1.value(dateTimes[i]) + ts2.value(dateTimes[i]), sum.values(i)) << dateTimes[i];
+    EXPECT_EQ(ts1.value(dateTimes[i]) - ts2.value(dateTimes[i]), diff.values(i)) << dateTimes[i];
+  }
+}
+
+TEST_F(DataFixture, TimeSeries_AddSubtractAligned)
+{
+  std::string units = "W";
+
+  unsigned numHours = 24 * 40;
+  Vector hourlyValues = linspace(1, numHours, numHours);
+  Vector quarterHourlyValues = linspace(0.25, numHours, 4 * numHours);
+
+  // same date times, with and without a year
+  DateTime firstReport(Date(MonthOfYear::Jan, 1, 2009), Time(0, 1, 0, 0));
+  TimeSeries hourly(firstReport, Time(0, 1, 0, 0), hourlyValues, units);
+  TimeSeries hourly2(firstReport, Time(0, 1, 0, 0), 2.0 * hourlyValues, units);
+  expectAlignedValues(hourly, hourly2);
+
+  DateTime firstReportNoYear(Date(MonthOfYear::Jan, 1), Time(0, 1, 0, 0));
+  TimeSeries hourlyNoYear(firstReportNoYear, Time(0, 1, 0, 0), hourlyValues, units);
+  expectAlignedValues(hourlyNoYear, hourlyNoYear * 3.0);
+
+  // different intervals
+  TimeSeries quarterHourlyNoYear(DateTime(Date(MonthOfYear::Jan, 1), Time(0, 0, 15, 0)), Time(0, 0, 15, 0), quarterHourlyValues, units);
+  expectAlignedValues(hourlyNoYear, quarterHourlyNoYear);
+  expectAlignedValues(quarterHourlyNoYear, hourlyNoYear);
+
+  // detailed series offset from the interval series, running past its end
+  DateTimeVector dateTimes;
+  Vector detailedValues(700);
+  for (unsigned i = 0; i < 700; ++i) {
+    dateTimes.push_back(DateTime(Date(MonthOfYear::Jan, 2), Time(0, 0, 30 + 90 * i, 0)));
+    detailedValues[i] = 0.5 * i;
+  }
+  TimeSeries detailed(dateTimes, detailedValues, units);
+  expectAlignedValues(hourlyNoYear, detailed);
+  expectAlignedValues(detailed, hourlyNoYear);
+
+  // wrap around dates
+  TimeSeries wrapAround(DateTime(Date(MonthOfYear::Dec, 15), Time(0, 1, 0, 0)), Time(0, 1, 0, 0), hourlyValues, units);
+  expectAlignedValues(wrapAround, wrapAround);
+  expectAlignedValues(wrapAround, hourlyNoYear);
+}
+
+TEST_F(DataFixture, TimeSeries_SumAligned)
+{
+  std::string units = "W";
+  unsigned numHours = 24 * 40;
+  DateTime firstReport(Date(MonthOfYear::Jan, 1, 2009), Time(0, 1, 0, 0));
+
+  // series over the same period at different intervals
+  TimeSeriesVector timeSeriesVector;
+  timeSeriesVector.push_back(TimeSeries(firstReport, Time(0, 1, 0, 0), linspace(1, numHours, numHours), units));
+  timeSeriesVector.push_back(TimeSeries(firstReport - Time(0, 0, 30, 0), Time(0, 0, 30, 0), linspace(0.5, numHours, 2 * numHours), units));
+  timeSeriesVector.push_back(TimeSeries(firstReport - Time(0, 0, 45, 0), Time(0, 0, 15, 0), linspace(0.25, numHours, 4 * numHours), units));
+  timeSeriesVector.push_back(TimeSeries(firstReport, Time(0, 1, 0, 0), linspace(-1, -1.0 * numHours, numHours), units));
+
+  TimeSeries repeated = timeSeriesVector[0];
+  for (unsigned i = 1; i < timeSeriesVector.size(); ++i) {
+    repeated = repeated + timeSeriesVector[i];
+  }
+
+  TimeSeries result = sum(timeSeriesVector);
+  DateTimeVector dateTimes = result.dateTimes();
+  DateTimeVector repeatedDateTimes = repeated.dateTimes();
+  ASSERT_EQ(4 * numHours, dateTimes.size());
+  ASSERT_EQ(repeatedDateTimes.size(), dateTimes.size());
+  for (unsigned i = 0; i < dateTimes.size(); ++i) {
+    EXPECT_EQ(repeatedDateTimes[i], dateTimes[i]);
+    EXPECT_EQ(repeated.values(i), result.values(i)) << dateTimes[i];
+  }
+
+  // units must match
+  timeSeriesVector.push_back(TimeSeries(firstReport, Time(0, 1, 0, 0), linspace(1, numHours, numHours), "C"));
+  EXPECT_TRUE(sum(timeSeriesVector).values().empty());
+}
+
+TEST_F(DataFixture, TimeSeries_SumStaggered)
+{
+  std::string units = "W";
+  Date date(MonthOfYear::Jan, 1, 2009);
+
+  // each series starts before the ones already summed
+  TimeSeriesVector timeSeriesVector;
+  timeSeriesVector.push_back(TimeSeries(DateTimeVector(1, DateTime(date, Time(0, 2, 0, 0))), createVector(std::vector<double>{1}), units));
+  timeSeriesVector.push_back(TimeSeries(DateTime(date, Time(0, 1, 30, 0)), Time(0, 1, 0, 0), createVector(std::vector<double>{10, 20}), units));
+  timeSeriesVector.push_back(TimeSeries(DateTimeVector(1, DateTime(date, Time(0, 1, 0, 0))), createVector(std::vector<double>{100}), units));
+
+  TimeSeries repeated = timeSeriesVector[0];
+  for (unsigned i = 1; i < timeSeriesVector.size(); ++i) {
+    repeated = repeated + timeSeriesVector[i];
+  }
+
+  // before the first report of the series summed so far, they count as 0. at 01:00 the second
+  // series on its own would already report its first value
+  TimeSeries result = sum(timeSeriesVector);
+  DateTimeVector dateTimes = result.dateTimes();
+  ASSERT_EQ(4u, dateTimes.size());
+  EXPECT_EQ(DateTime(date, Time(0, 1, 0, 0)), dateTimes[0]);
+  EXPECT_EQ(100.0, result.values(0));
+  EXPECT_EQ(10.0, result.values(1));
+  EXPECT_EQ(21.0, result.values(2));
+  EXPECT_EQ(20.0, result.values(3));
+
+  ASSERT_EQ(repeated.values().size(), result.values().size());
+  for (unsigned i = 0; i < dateTimes.size(); ++i) {
+    EXPECT_EQ(repeated.dateTimes()[i], dateTimes[i]);
+    EXPECT_EQ(repeated.values(i), result.values(i)) << dateTimes[i];
+  }
+}
+
+TEST_F(DataFixture, TimeSeries_SumBenchmark)
+{
+  // many meters reported at the same hours, as summed for end use reports
+  unsigned numSeries = 500;
+  DateTime firstReport(Date(MonthOfYear::Jan, 1, 2009), Time(0, 1, 0, 0));
+  TimeSeriesVector timeSeriesVector;
+  for (unsigned i = 0; i < numSeries; ++i) {
+    timeSeriesVector.push_back(TimeSeries(firstReport, Time(0, 1, 0, 0), linspace(i, i + 8759, 8760), "J"));
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  TimeSeries result = sum(timeSeriesVector);
+  auto end = std::chrono::steady_clock::now();
+  RecordProperty("SumTimeMs", std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()));
+
+  ASSERT_EQ(8760u, result.values().size());
+  EXPECT_DOUBLE_EQ(numSeries * (numSeries - 1) / 2.0, result.values(0));
+  EXPECT_DOUBLE_EQ(numSeries * (numSeries - 1) / 2.0 + numSeries * 8759.0, result.values(8759));
+
+  // aligned series added pairwise
+  start = std::chrono::steady_clock::now();
+  TimeSeries pairwise = timeSeriesVector[0];
+  for (unsigned i = 1; i < 50; ++i) {
+    pairwise = pairwise + timeSeriesVector[i];
+  }
+  end = std::chrono::steady_clock::now();
+  RecordProperty("PairwiseAdd50TimeMs", std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()));
+  EXPECT_EQ(8760u, pairwise.values().size());
+}
+
+TEST_F(DataFixture, TimeSeries_ResampleDaily)
+{
+  // hourly values 1 to 8760 for 2009
+  DateTime firstReport(Date(MonthOfYear::Jan, 1, 2009), Time(0, 1, 0, 0));
+  TimeSeries hourly(firstReport, Time(0, 1, 0, 0), linspace(1, 8760, 8760), "W");
+
+  TimeSeries daily = hourly.resample(Time(1), TimeSeriesAggregation::Sum);
+  ASSERT_EQ(365u, daily.values().size());
+  EXPECT_EQ("W", daily.units());
+  ASSERT_TRUE(daily.intervalLength());
+  EXPECT_EQ(Time(1), *daily.intervalLength());
+  EXPECT_EQ(DateTime(Date(MonthOfYear::Jan, 2, 2009)), daily.firstReportDateTime());
+  EXPECT_EQ(DateTime(Date(MonthOfYear::Jan, 1, 2010)), daily.dateTimes().back());
+  for (unsigned d = 0; d < 365; ++d) {
+    EXPECT_DOUBLE_EQ(24.0 * 24.0 * d + 300.0, daily.values()[d]);
+  }
+
+  TimeSeries dailyMean = hourly.resample(Time(1), TimeSeriesAggregation::Mean);
+  TimeSeries dailyMin = hourly.resample(Time(1), TimeSeriesAggregation::Minimum);
+  TimeSeries dailyMax = hourly.resample(Time(1), TimeSeriesAggregation::Maximum);
+  TimeSeries dailyMedian = hourly.resample(Time(1), TimeSeriesAggregation::Percentile);
+  TimeSeries daily95 = hourly.resample(Time(1), TimeSeriesAggregation::Percentile, 95.0);
+  ASSERT_EQ(365u, dailyMean.values().size());
+  ASSERT_EQ(365u, dailyMin.values().size());
+  ASSERT_EQ(365u, dailyMax.values().size());
+  ASSERT_EQ(365u, dailyMedian.values().size());
+  ASSERT_EQ(365u, daily95.values().size());
+  for (unsigned d = 0; d < 365; ++d) {
+    EXPECT_DOUBLE_EQ(24.0 * d + 12.5, dailyMean.values()[d]);
+    EXPECT_DOUBLE_EQ(24.0 * d + 1.0, dailyMin.values()[d]);
+    EXPECT_DOUBLE_EQ(24.0 * d + 24.0, dailyMax.values()[d]);
+    EXPECT_DOUBLE_EQ(24.0 * d + 12.5, dailyMedian.values()[d]);
+    EXPECT_NEAR(24.0 * d + 22.85, daily95.values()[d], 1.0e-9);
+  }
+
+  // on peak hours, reporting intervals ending after noon up to 6 pm
+  TimeSeries onPeakMax = hourly.resample(Time(1), TimeSeriesAggregation::Maximum, Time(0, 12), Time(0, 18));
+  TimeSeries onPeakSum = hourly.resample(Time(1), TimeSeriesAggregation::Sum, Time(0, 12), Time(0, 18));
+  ASSERT_EQ(365u, onPeakMax.values().size());
+  ASSERT_EQ(365u, onPeakSum.values().size());
+  EXPECT_EQ(DateTime(Date(MonthOfYear::Jan, 2, 2009)), onPeakMax.firstReportDateTime());
+  for (unsigned d = 0; d < 365; ++d) {
+    EXPECT_DOUBLE_EQ(24.0 * d + 18.0, onPeakMax.values()[d]);
+    EXPECT_DOUBLE_EQ(6.0 * 24.0 * d + 93.0, onPeakSum.values()[d]);
+  }
+
+  // night hours wrap around midnight
+  TimeSeries nightSum = hourly.resample(Time(1), TimeSeriesAggregation::Sum, Time(0, 22), Time(0, 6));
+  ASSERT_EQ(365u, nightSum.values().size());
+  for (unsigned d = 0; d < 365; ++d) {
+    EXPECT_DOUBLE_EQ(8.0 * 24.0 * d + 68.0, nightSum.values()[d]);
+  }
+
+  // a window with no reports
+  TimeSeries empty = hourly.resample(Time(1), TimeSeriesAggregation::Sum, Time(0, 12, 10), Time(0, 12, 20));
+  EXPECT_TRUE(empty.values().empty());
+}
+
+TEST_F(DataFixture, TimeSeries_ResampleHourly)
+{
+  // 15 minute values for one day
+  DateTime firstReport(Date(MonthOfYear::Jan, 1, 2009), Time(0, 0, 15, 0));
+  TimeSeries timestep(firstReport, Time(0, 0, 15, 0), linspace(1, 96, 96), "W");
+
+  TimeSeries hourlySum = timestep.resample(Time(0, 1), TimeSeriesAggregation::Sum);
+  TimeSeries hourlyMean = timestep.resample(Time(0, 1), TimeSeriesAggregation::Mean);
+  ASSERT_EQ(24u, hourlySum.values().size());
+  ASSERT_EQ(24u, hourlyMean.values().size());
+  EXPECT_EQ(DateTime(Date(MonthOfYear::Jan, 1, 2009), Time(0, 1)), hourlySum.firstReportDateTime());
+  ASSERT_TRUE(hourlySum.intervalLength());
+  EXPECT_EQ(Time(0, 1), *hourlySum.intervalLength());
+  for (unsigned h = 0; h < 24; ++h) {
+    EXPECT_DOUBLE_EQ(16.0 * h + 10.0, hourlySum.values()[h]);
+    EXPECT_DOUBLE_EQ(4.0 * h + 2.5, hourlyMean.values()[h]);
+  }
+
+  // series starting mid hour only fill part of their first hour
+  DateTimeVector dateTimes;
+  dateTimes.push_back(DateTime(Date(MonthOfYear::Jan, 1, 2009), Time(0, 0, 45, 0)));
+  dateTimes.push_back(DateTime(Date(MonthOfYear::Jan, 1, 2009), Time(0, 1, 0, 0)));
+  dateTimes.push_back(DateTime(Date(MonthOfYear::Jan, 1, 2009), Time(0, 1, 15, 0)));
+  Vector values = linspace(1, 3, 3);
+  TimeSeries partial(dateTimes, values, "W");
+  TimeSeries partialSum = partial.resample(Time(0, 1), TimeSeriesAggregation::Sum);
+  ASSERT_EQ(2u, partialSum.values().size());
+  EXPECT_DOUBLE_EQ(3.0, partialSum.values()[0]);
+  EXPECT_DOUBLE_EQ(3.0, partialSum.values()[1]);
+  EXPECT_EQ(DateTime(Date(MonthOfYear::Jan, 1, 2009), Time(0, 1)), partialSum.firstReportDateTime());
+  EXPECT_EQ(DateTime(Date(MonthOfYear::Jan, 1, 2009), Time(0, 2)), partialSum.dateTimes().back());
+}
+
+TEST_F(DataFixture, TimeSeries_ResampleMeanWeighted)
+{
+  // reporting intervals of 1, 2 and 3 hours
+  DateTime firstReport(Date(MonthOfYear::Jan, 1, 2009), Time(0, 1, 0, 0));
+  std::vector<long> timeInSeconds{3600, 10800, 21600};
+  Vector values = linspace(1, 3, 3);
+  TimeSeries timeSeries(firstReport, timeInSeconds, values, "C");
+
+  TimeSeries dailyMean = timeSeries.resample(Time(1), TimeSeriesAggregation::Mean);
+  ASSERT_EQ(1u, dailyMean.values().size());
+  EXPECT_DOUBLE_EQ(50400.0 / 21600.0, dailyMean.values()[0]);
+  EXPECT_DOUBLE_EQ(timeSeries.averageValue(), dailyMean.values()[0]);
+  EXPECT_EQ(DateTime(Date(MonthOfYear::Jan, 2, 2009)), dailyMean.firstReportDateTime());
+}
+
+TEST_F(DataFixture, TimeSeries_ResampleMonthly)
+{
+  DateTime firstReport(Date(MonthOfYear::Jan, 1, 2009), Time(0, 1, 0, 0));
+  TimeSeries hourly(firstReport, Time(0, 1, 0, 0), Vector(8760, 1.0), "kWh");
+
+  TimeSeries monthly = hourly.resampleMonthly(TimeSeriesAggregation::Sum);
+  ASSERT_EQ(12u, monthly.values().size());
+  EXPECT_FALSE(monthly.intervalLength());
+  DateTimeVector dateTimes = monthly.dateTimes();
+  ASSERT_EQ(12u, dateTimes.size());
+  for (unsigned m = 1; m <= 12; ++m) {
+    Date monthStart(monthOfYear(m), 1, 2009);
+    Date monthEnd = (m == 12) ? Date(MonthOfYear::Jan, 1, 2010) : Date(monthOfYear(m + 1), 1, 2009);
+    EXPECT_DOUBLE_EQ(24.0 * (monthEnd - monthStart).days(), monthly.values()[m - 1]);
+    EXPECT_EQ(DateTime(monthEnd), dateTimes[m - 1]);
+    EXPECT_DOUBLE_EQ(24.0 * (monthEnd - monthStart).days(), monthly.value(DateTime(monthEnd)));
+  }
+
+  // the time of day window applies to every day, weekends included
+  TimeSeries onPeak = hourly.resampleMonthly(TimeSeriesAggregation::Sum, Time(0, 12), Time(0, 18));
+  ASSERT_EQ(12u, onPeak.values().size());
+  EXPECT_DOUBLE_EQ(6.0 * 31.0, onPeak.values()[0]);
+  EXPECT_DOUBLE_EQ(6.0 * 28.0, onPeak.values()[1]);
+
+  // a series spanning part of two months
+  DateTime midMonth(Date(MonthOfYear::Jan, 31, 2009), Time(0, 1, 0, 0));
+  TimeSeries twoDays(midMonth, Time(0, 1, 0, 0), linspace(1, 48, 48), "kWh");
+  TimeSeries twoMonths = twoDays.resampleMonthly(TimeSeriesAggregation::Maximum);
+  ASSERT_EQ(2u, twoMonths.values().size());
+  EXPECT_DOUBLE_EQ(24.0, twoMonths.values()[0]);
+  EXPECT_DOUBLE_EQ(48.0, twoMonths.values()[1]);
+  EXPECT_EQ(DateTime(Date(MonthOfYear::Feb, 1, 2009)), twoMonths.firstReportDateTime());
+  EXPECT_EQ(DateTime(Date(MonthOfYear::Mar, 1, 2009)), twoMonths.dateTimes().back());
+}
+
+TEST_F(DataFixture, TimeSeries_CoincidentPeak)
+{
+  DateTime firstReport(Date(MonthOfYear::Jan, 1, 2009), Time(0, 1, 0, 0));
+  Vector values1(24, 0.0);
+  values1[3] = 5.0;
+  values1[5] = 1.0;
+  Vector values2(24, 0.0);
+  values2[3] = 2.0;
+  values2[5] = 4.0;
+  values2[10] = 6.0;
+  TimeSeriesVector timeSeriesVector;
+  timeSeriesVector.push_back(TimeSeries(firstReport, Time(0, 1), values1, "W"));
+  timeSeriesVector.push_back(TimeSeries(firstReport, Time(0, 1), values2, "W"));
+
+  // the individual peaks are at 4 am and 11 am, together they peak at 4 am
+  boost::optional<DateTime> peak = coincidentPeakDateTime(timeSeriesVector);
+  ASSERT_TRUE(peak);
+  EXPECT_EQ(DateTime(Date(MonthOfYear::Jan, 1, 2009), Time(0, 4)), *peak);
+  EXPECT_DOUBLE_EQ(5.0, timeSeriesVector[0].value(*peak));
+  EXPECT_DOUBLE_EQ(2.0, timeSeriesVector[1].value(*peak));
+
+  EXPECT_FALSE(coincidentPeakDateTime(TimeSeriesVector()));
+}
+
+TEST_F(DataFixture, TimeSeries_ResampleBenchmark)
+{
+  // 10 minute values for a year, as reported at each zone timestep
+  unsigned numSeries = 20;
+  unsigned numValues = 6 * 8760;
+  DateTime firstReport(Date(MonthOfYear::Jan, 1, 2009), Time(0, 0, 10, 0));
+  TimeSeriesVector timeSeriesVector;
+  for (unsigned i = 0; i < numSeries; ++i) {
+    timeSeriesVector.push_back(TimeSeries(firstReport, Time(0, 0, 10, 0), linspace(i, i + numValues - 1, numValues), "W"));
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  for (const TimeSeries& timeSeries : timeSeriesVector) {
+    TimeSeries hourly = timeSeries.resample(Time(0, 1), TimeSeriesAggregation::Mean);
+    TimeSeries daily = timeSeries.resample(Time(1), TimeSeriesAggregation::Maximum, Time(0, 12), Time(0, 18));
+    TimeSeries monthly = timeSeries.resampleMonthly(TimeSeriesAggregation::Percentile, 95.0);
+    EXPECT_EQ(8760u, hourly.values().size());
+    EXPECT_EQ(365u, daily.values().size());
+    EXPECT_EQ(12u, monthly.values().size());
+  }
+  auto end = std::chrono::steady_clock::now();
+  RecordProperty("ResampleTimeMs", std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()));
+
+  start = std::chrono::steady_clock::now();
+  boost::optional<DateTime> peak = coincidentPeakDateTime(timeSeriesVector);
+  end = std::chrono::steady_clock::now();
+  RecordProperty("CoincidentPeakTimeMs", std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()));
+  ASSERT_TRUE(peak);
+  EXPECT_EQ(DateTime(Date(MonthOfYear::Jan, 1, 2010)), *peak);
+}
+
 TEST_F(DataFixture, TimeSeries_Multiply8760)
 {
   // Test out mulitplication on a detailed series and an iterval series
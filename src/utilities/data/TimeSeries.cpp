@@ -30,6 +30,8 @@
 #include "TimeSeries.hpp"
 #include "../core/Assert.hpp"
 
+#include <algorithm>
+#include <iterator>
 
 using namespace std;
 using namespace boost;
@@ -579,15 +581,29 @@ double TimeSeries_Impl::value(const Time& timeFromFirstReport) const
 /// get value at date and time
 double TimeSeries_Impl::value(const DateTime& dateTime) const
 {
-  boost::optional<int> calendarYear = m_firstReportDateTime.date().baseYear();
+  DateTime firstReportDateTimeWithYear = this->firstReportDateTimeWithYear();
+  DateTime dateTimeWithYear = this->dateTimeWithYear(dateTime, firstReportDateTimeWithYear);
+
+  LOG(Debug, "Initial: dateTime=" << dateTime << ", m_firstReportDateTime=" << m_firstReportDateTime);
+  LOG(Debug, "Querying with dateTimeWithYear=" << dateTimeWithYear <<  ", firstReportDateTimeWithYear=" << firstReportDateTimeWithYear);
 
+  return value(dateTimeWithYear - firstReportDateTimeWithYear);
+}
+
+DateTime TimeSeries_Impl::firstReportDateTimeWithYear() const
+{
   // If our timeseries doesn't have a year, we force it to the assumed one
   DateTime firstReportDateTimeWithYear = m_firstReportDateTime;
-  int timeSeriesYear = m_firstReportDateTime.date().year();
-  if (!calendarYear) {
-    firstReportDateTimeWithYear = DateTime(Date(m_firstReportDateTime.date().monthOfYear(), m_firstReportDateTime.date().dayOfMonth(), timeSeriesYear),
+  if (!m_firstReportDateTime.date().baseYear()) {
+    firstReportDateTimeWithYear = DateTime(Date(m_firstReportDateTime.date().monthOfYear(), m_firstReportDateTime.date().dayOfMonth(), m_firstReportDateTime.date().year()),
                                            m_firstReportDateTime.time());
   }
+  return firstReportDateTimeWithYear;
+}
+
+DateTime TimeSeries_Impl::dateTimeWithYear(const DateTime& dateTime, const DateTime& firstReportDateTimeWithYear) const
+{
+  int timeSeriesYear = m_firstReportDateTime.date().year();
 
   // If our requested datetime doesn't have an assigned year, we default to the one of the **TimeSeries** (whether hard assigned or not)
   // Or the one right after in case it ends up before the start (try wrap-around)
@@ -609,10 +625,152 @@ double TimeSeries_Impl::value(const DateTime& dateTime) const
     }
   }
 
-  LOG(Debug, "Initial: dateTime=" << dateTime << ", m_firstReportDateTime=" << m_firstReportDateTime);
-  LOG(Debug, "Querying with dateTimeWithYear=" << dateTimeWithYear <<  ", firstReportDateTimeWithYear=" << firstReportDateTimeWithYear);
+  return dateTimeWithYear;
+}
 
-  return value(dateTimeWithYear - firstReportDateTimeWithYear);
+/// get values at date times
+Vector TimeSeries_Impl::values(const DateTimeVector& dateTimes) const
+{
+  DateTime firstReportDateTimeWithYear = this->firstReportDateTimeWithYear();
+
+  std::vector<long> secondsFromFirstReport(dateTimes.size());
+  for (unsigned i = 0; i < dateTimes.size(); ++i) {
+    secondsFromFirstReport[i] = (dateTimeWithYear(dateTimes[i], firstReportDateTimeWithYear) - firstReportDateTimeWithYear).totalSeconds();
+  }
+
+  return valuesAtSecondsFromFirstReport(secondsFromFirstReport);
+}
+
+Vector TimeSeries_Impl::valuesAtSecondsFromFirstReport(const std::vector<long>& secondsFromFirstReport) const
+{
+  Vector result(secondsFromFirstReport.size());
+  std::fill(result.begin(), result.end(), m_outOfRangeValue);
+
+  if (m_secondsFromFirstReport.empty()) {
+    LOG(Debug, "Cannot compute values because timeseries is empty");
+    return result;
+  }
+
+  long duration = m_secondsFromFirstReport.back();
+  unsigned numOutOfRange = 0;
+
+  if (m_intervalLength) {
+
+    // same look up as valueAtSecondsFromFirstReport, without a message per value
+    long secondsPerInterval = m_intervalLength->totalSeconds();
+    for (unsigned i = 0; i < secondsFromFirstReport.size(); ++i) {
+      long seconds = secondsFromFirstReport[i];
+      if ((seconds <= -secondsPerInterval) || (seconds > duration)) {
+        ++numOutOfRange;
+        continue;
+      }
+
+      unsigned index = 0;
+      if (seconds > 0) {
+        index = seconds / secondsPerInterval;
+        if (seconds % secondsPerInterval > 0) {
+          ++index;
+        }
+      }
+
+      // issue with daily, hourly flood plots when index == m_values.size()
+      if (index >= m_values.size()) {
+        LOG(Warn, "Timeseries index " << index << " is greater than or equal to values size " << m_values.size() << " and has been set to size - 1.");
+        index = index - 1;
+      }
+      result[i] = m_values[index];
+    }
+
+  } else {
+
+    // hold next value as interp does, keeping the position between sorted look ups instead of searching each time
+    auto begin = m_secondsFromFirstReport.begin();
+    auto next = begin;
+    for (unsigned i = 0; i < secondsFromFirstReport.size(); ++i) {
+      long seconds = secondsFromFirstReport[i];
+      if ((seconds < 0) || (seconds > duration)) {
+        ++numOutOfRange;
+        continue;
+      }
+
+      if (seconds < m_secondsFromFirstReport.front()) {
+        result[i] = 0.0;
+      } else if (seconds == m_secondsFromFirstReport.front()) {
+        result[i] = m_values[0];
+      } else if (seconds == duration) {
+        result[i] = m_values[m_values.size() - 1];
+      } else {
+        if ((next == m_secondsFromFirstReport.end()) || (next != begin && *(next - 1) >= seconds)) {
+          next = std::lower_bound(begin, m_secondsFromFirstReport.end(), seconds);
+        }
+        while (*next < seconds) {
+          ++next;
+        }
+        result[i] = m_values[next - begin];
+      }
+    }
+  }
+
+  if (numOutOfRange > 0) {
+    LOG(Debug, "Cannot compute " << numOutOfRange << " of " << secondsFromFirstReport.size() << " values outside of the timeseries");
+  }
+
+  return result;
+}
+
+bool TimeSeries_Impl::dateTimesMapToValues() const
+{
+  if (m_secondsFromFirstReport.empty()) {
+    return true;
+  }
+
+  // hold next look up returns values(i) only if reporting times are distinct
+  for (unsigned i = 1; i < m_secondsFromFirstReport.size(); ++i) {
+    if (m_secondsFromFirstReport[i] <= m_secondsFromFirstReport[i - 1]) {
+      return false;
+    }
+  }
+
+  // dateTimeWithYear leaves dateTimes() alone if the series has a year or does not run into the next one
+  if (m_firstReportDateTime.date().baseYear()) {
+    return true;
+  }
+  DateTime lastDateTime = m_firstReportDateTime + Time(0, 0, 0, m_secondsFromFirstReport.back());
+  return lastDateTime.date().year() == m_firstReportDateTime.date().year();
+}
+
+bool TimeSeries_Impl::hasSameAlignedDateTimes(const TimeSeries_Impl& other) const
+{
+  return (m_firstReportDateTime == other.m_firstReportDateTime) &&
+    (m_firstReportDateTime.date().baseYear() == other.m_firstReportDateTime.date().baseYear()) &&
+    (m_secondsFromFirstReport == other.m_secondsFromFirstReport) &&
+    dateTimesMapToValues() && other.dateTimesMapToValues();
+}
+
+void TimeSeries_Impl::alignedValues(const TimeSeries_Impl& other, DateTimeVector& dateTimes, Vector& values, Vector& otherValues) const
+{
+  if (hasSameAlignedDateTimes(other)) {
+    dateTimes = this->dateTimes();
+    values = m_values;
+    otherValues = other.m_values;
+    return;
+  }
+
+  // merge the ordered date times, keeping the first of equal date times as std::set::insert would
+  DateTimeVector dateTimes1 = this->dateTimes();
+  DateTimeVector dateTimes2 = other.dateTimes();
+  dateTimes.clear();
+  dateTimes.reserve(dateTimes1.size() + dateTimes2.size());
+  std::merge(dateTimes1.begin(), dateTimes1.end(), dateTimes2.begin(), dateTimes2.end(), std::back_inserter(dateTimes));
+  if (!std::is_sorted(dateTimes.begin(), dateTimes.end())) {
+    std::stable_sort(dateTimes.begin(), dateTimes.end());
+  }
+  dateTimes.erase(std::unique(dateTimes.begin(), dateTimes.end(), [](const DateTime& a, const DateTime& b) {
+    return !(a < b) && !(b < a);
+  }), dateTimes.end());
+
+  values = this->values(dateTimes);
+  otherValues = other.values(dateTimes);
 }
 
 /// get values between start and end date times
@@ -706,29 +864,14 @@ std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::operator+(const TimeSeries_Imp
   // if same units
   if (m_units == other.units()) {
 
-    // make unique, ordered set of all date times
-    std::set<DateTime> dateTimesSet;
-    DateTimeVector dateTimes1 = dateTimes();
-    DateTimeVector dateTimes2 = other.dateTimes();
-    dateTimesSet.insert(dateTimes1.begin(), dateTimes1.end());
-    dateTimesSet.insert(dateTimes2.begin(), dateTimes2.end());
-
-    // create vector out of set
-    DateTimeVector dateTimes(dateTimesSet.begin(), dateTimesSet.end());
-
-    // compute value at each date time
-    Vector values(dateTimesSet.size());
-    unsigned valueIndex = 0;
-    for (const DateTime& dt : dateTimes) {
-      values[valueIndex] = value(dt) + other.value(dt);
-
-      LOG(Debug, "At '" << dt << "' " << value(dt) << " + " << other.value(dt) << " = " << values[valueIndex]);
-
-      ++valueIndex;
-    }
+    // values of both at the union of their date times
+    DateTimeVector dateTimes;
+    Vector values;
+    Vector otherValues;
+    alignedValues(other, dateTimes, values, otherValues);
 
     // make new result
-    result = std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(dateTimes, values, m_units));
+    result = std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(dateTimes, values + otherValues, m_units));
 
   } else {
     LOG(Warn, "Adding timeseries with different units returns an empty timeseries");
@@ -745,29 +888,14 @@ std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::operator-(const TimeSeries_Imp
   // if same units
   if (m_units == other.units()) {
 
-    // make unique, ordered set of all date times
-    std::set<DateTime> dateTimesSet;
-    DateTimeVector dateTimes1 = dateTimes();
-    DateTimeVector dateTimes2 = other.dateTimes();
-    dateTimesSet.insert(dateTimes1.begin(), dateTimes1.end());
-    dateTimesSet.insert(dateTimes2.begin(), dateTimes2.end());
-
-    // create vector out of set
-    DateTimeVector dateTimes(dateTimesSet.begin(), dateTimesSet.end());
-
-    // compute value at each date time
-    Vector values(dateTimesSet.size());
-    unsigned valueIndex = 0;
-    for (const DateTime& dt : dateTimes) {
-      values[valueIndex] = value(dt) - other.value(dt);
-
-      LOG(Debug, "At '" << dt << "' " << value(dt) << " - " << other.value(dt) << " = " << values[valueIndex]);
-
-      ++valueIndex;
-    }
+    // values of both at the union of their date times
+    DateTimeVector dateTimes;
+    Vector values;
+    Vector otherValues;
+    alignedValues(other, dateTimes, values, otherValues);
 
     // make new result
-    result = std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(dateTimes, values, m_units));
+    result = std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(dateTimes, values - otherValues, m_units));
 
   } else {
     LOG(Warn, "Subtracting timeseries with different units returns an empty timeseries");
@@ -817,6 +945,204 @@ double TimeSeries_Impl::averageValue() const
   return 0;
 }
 
+std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::resample(const Time& intervalLength, const TimeSeriesAggregation& aggregation,
+                                                           const Time& windowStart, const Time& windowEnd, double percentile) const
+{
+  long secondsPerInterval = intervalLength.totalSeconds();
+  if (secondsPerInterval <= 0) {
+    LOG(Warn, "Cannot resample to interval length " << intervalLength << ", returning an empty timeseries");
+    return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl());
+  }
+
+  std::vector<long> bucketBoundaries;
+  if (!m_secondsFromStart.empty()) {
+    long startOfDayOffset = m_startDateTime.time().totalSeconds();
+    long firstEnd = startOfDayOffset + m_secondsFromStart.front();
+    long lastEnd = startOfDayOffset + m_secondsFromStart.back();
+
+    // intervals are counted from midnight, start with the one holding the end of the first reporting interval
+    long boundary = firstEnd - 1;
+    boundary = (boundary >= 0 ? boundary / secondsPerInterval : (boundary + 1) / secondsPerInterval - 1) * secondsPerInterval;
+    bucketBoundaries.push_back(boundary);
+    while (boundary < lastEnd) {
+      boundary += secondsPerInterval;
+      bucketBoundaries.push_back(boundary);
+    }
+  }
+
+  return resample(bucketBoundaries, aggregation, windowStart, windowEnd, percentile);
+}
+
+std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::resampleMonthly(const TimeSeriesAggregation& aggregation,
+                                                                  const Time& windowStart, const Time& windowEnd, double percentile) const
+{
+  std::vector<long> bucketBoundaries;
+  if (!m_secondsFromStart.empty()) {
+    Date startDate = m_startDateTime.date();
+    long startOfDayOffset = m_startDateTime.time().totalSeconds();
+    long firstEnd = startOfDayOffset + m_secondsFromStart.front();
+    long lastEnd = startOfDayOffset + m_secondsFromStart.back();
+
+    // midnight on the first of each month, starting with the month holding the end of the first reporting interval
+    Date firstDate = (DateTime(startDate) + Time(0, 0, 0, firstEnd - 1)).date();
+    unsigned monthOfYear = month(firstDate.monthOfYear());
+    int year = firstDate.year();
+    long boundary = (Date(openstudio::monthOfYear(monthOfYear), 1, year) - startDate).totalSeconds();
+    bucketBoundaries.push_back(boundary);
+    while (boundary < lastEnd) {
+      if (monthOfYear == 12) {
+        monthOfYear = 1;
+        ++year;
+      } else {
+        ++monthOfYear;
+      }
+      boundary = (Date(openstudio::monthOfYear(monthOfYear), 1, year) - startDate).totalSeconds();
+      bucketBoundaries.push_back(boundary);
+    }
+  }
+
+  return resample(bucketBoundaries, aggregation, windowStart, windowEnd, percentile);
+}
+
+std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::resample(const std::vector<long>& bucketBoundaries, const TimeSeriesAggregation& aggregation,
+                                                           const Time& windowStart, const Time& windowEnd, double percentile) const
+{
+  if (bucketBoundaries.size() < 2) {
+    LOG(Warn, "Cannot resample an empty timeseries");
+    return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl());
+  }
+
+  const long secondsPerDay = 86400;
+  long windowStartSeconds = windowStart.totalSeconds();
+  long windowEndSeconds = windowEnd.totalSeconds();
+  long startOfDayOffset = m_startDateTime.time().totalSeconds();
+
+  // boundaries of the buckets that have values, and the value of each
+  std::vector<long> resultBoundaries;
+  std::vector<double> resultValues;
+
+  unsigned count = 0;
+  double sum = 0.0;
+  double weightedSum = 0.0;
+  double totalWeight = 0.0;
+  double minimum = 0.0;
+  double maximum = 0.0;
+  std::vector<double> bucketValues;
+
+  unsigned bucket = 0;
+  auto finishBucket = [&]() {
+    if (count == 0) {
+      return;
+    }
+
+    double value = 0.0;
+    switch (aggregation.value()) {
+      case TimeSeriesAggregation::Sum:
+        value = sum;
+        break;
+      case TimeSeriesAggregation::Mean:
+        value = (totalWeight > 0.0) ? weightedSum / totalWeight : sum / count;
+        break;
+      case TimeSeriesAggregation::Minimum:
+        value = minimum;
+        break;
+      case TimeSeriesAggregation::Maximum:
+        value = maximum;
+        break;
+      case TimeSeriesAggregation::Percentile:
+      {
+        std::sort(bucketValues.begin(), bucketValues.end());
+        double rank = std::max(0.0, std::min(100.0, percentile)) / 100.0 * (bucketValues.size() - 1);
+        unsigned lower = static_cast<unsigned>(rank);
+        value = bucketValues[lower];
+        if (lower + 1 < bucketValues.size()) {
+          value += (rank - lower) * (bucketValues[lower + 1] - bucketValues[lower]);
+        }
+        break;
+      }
+    }
+
+    if (resultBoundaries.empty()) {
+      resultBoundaries.push_back(bucketBoundaries[bucket]);
+    }
+    resultBoundaries.push_back(bucketBoundaries[bucket + 1]);
+    resultValues.push_back(value);
+
+    count = 0;
+    sum = 0.0;
+    weightedSum = 0.0;
+    totalWeight = 0.0;
+    bucketValues.clear();
+  };
+
+  for (unsigned i = 0; i < m_values.size(); ++i) {
+    long end = startOfDayOffset + m_secondsFromStart[i];
+
+    // time of day at the end of the reporting interval, midnight ends the day
+    long timeOfDay = end % secondsPerDay;
+    if (timeOfDay <= 0) {
+      timeOfDay += secondsPerDay;
+    }
+    bool inWindow = (windowStartSeconds <= windowEndSeconds) ?
+      ((timeOfDay > windowStartSeconds) && (timeOfDay <= windowEndSeconds)) :
+      ((timeOfDay > windowStartSeconds) || (timeOfDay <= windowEndSeconds));
+    if (!inWindow) {
+      continue;
+    }
+
+    while ((bucket + 2 < bucketBoundaries.size()) && (end > bucketBoundaries[bucket + 1])) {
+      finishBucket();
+      ++bucket;
+    }
+
+    double value = m_values[i];
+    double weight = m_secondsFromStart[i] - (i > 0 ? m_secondsFromStart[i - 1] : 0);
+    if (count == 0) {
+      minimum = value;
+      maximum = value;
+    } else {
+      minimum = std::min(minimum, value);
+      maximum = std::max(maximum, value);
+    }
+    ++count;
+    sum += value;
+    weightedSum += weight * value;
+    totalWeight += weight;
+    if (aggregation == TimeSeriesAggregation::Percentile) {
+      bucketValues.push_back(value);
+    }
+  }
+  finishBucket();
+
+  if (resultValues.empty()) {
+    LOG(Warn, "No values to resample in the time of day window, returning an empty timeseries");
+    return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl());
+  }
+
+  // each value is reported at the end of its bucket
+  DateTime startOfDay(m_startDateTime.date());
+  DateTime firstReportDateTime = startOfDay + Time(0, 0, 0, resultBoundaries[1]);
+
+  bool fixedInterval = true;
+  long secondsPerInterval = resultBoundaries[1] - resultBoundaries[0];
+  for (unsigned k = 2; k < resultBoundaries.size(); ++k) {
+    if (resultBoundaries[k] - resultBoundaries[k - 1] != secondsPerInterval) {
+      fixedInterval = false;
+      break;
+    }
+  }
+
+  if (fixedInterval) {
+    return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(firstReportDateTime, Time(0, 0, 0, secondsPerInterval), createVector(resultValues), m_units));
+  }
+
+  std::vector<long> secondsFromStart(resultValues.size());
+  for (unsigned k = 0; k < resultValues.size(); ++k) {
+    secondsFromStart[k] = resultBoundaries[k + 1] - resultBoundaries[0];
+  }
+  return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(firstReportDateTime, secondsFromStart, createVector(resultValues), m_units));
+}
+
 } // detail
 
 TimeSeries::TimeSeries() :
@@ -961,6 +1287,28 @@ double TimeSeries::averageValue() const
   return m_impl->averageValue();
 }
 
+TimeSeries TimeSeries::resample(const Time& intervalLength, const TimeSeriesAggregation& aggregation, double percentile) const
+{
+  return TimeSeries(m_impl->resample(intervalLength, aggregation, Time(0), Time(1), percentile));
+}
+
+TimeSeries TimeSeries::resample(const Time& intervalLength, const TimeSeriesAggregation& aggregation,
+                                const Time& windowStart, const Time& windowEnd, double percentile) const
+{
+  return TimeSeries(m_impl->resample(intervalLength, aggregation, windowStart, windowEnd, percentile));
+}
+
+TimeSeries TimeSeries::resampleMonthly(const TimeSeriesAggregation& aggregation, double percentile) const
+{
+  return TimeSeries(m_impl->resampleMonthly(aggregation, Time(0), Time(1), percentile));
+}
+
+TimeSeries TimeSeries::resampleMonthly(const TimeSeriesAggregation& aggregation, const Time& windowStart, const Time& windowEnd,
+                                       double percentile) const
+{
+  return TimeSeries(m_impl->resampleMonthly(aggregation, windowStart, windowEnd, percentile));
+}
+
 TimeSeries::TimeSeries(std::shared_ptr<detail::TimeSeries_Impl> impl)
   : m_impl(impl)
 {}
@@ -972,20 +1320,61 @@ TimeSeries operator*(double d, const TimeSeries& series)
 
 TimeSeries sum(const std::vector<TimeSeries>& timeSeriesVector)
 {
-  TimeSeries result;
-  bool first = true;
+  if (timeSeriesVector.empty()) {
+    return TimeSeries();
+  }
+
+  const TimeSeries& first = timeSeriesVector.front();
+  if (first.values().empty()) {
+    LOG_FREE(Info, "zero.sum", "Could not sum the timeSeriesVector. Either the first series is empty, or the "
+      << "units are incompatible.");
+    return first;
+  }
+  if (timeSeriesVector.size() == 1u) {
+    return first;
+  }
+
+  bool sameDateTimes = true;
   for (const TimeSeries& ts : timeSeriesVector) {
-    if (first) { result = ts; } else { result = result + ts; }
-    if (result.values().empty()) {
+    if (ts.units() != first.units()) {
+      LOG_FREE(Warn, "utilities.TimeSeries_Impl", "Adding timeseries with different units returns an empty timeseries");
       LOG_FREE(Info, "zero.sum", "Could not sum the timeSeriesVector. Either the first series is empty, or the "
         << "units are incompatible.");
-      break;
+      return TimeSeries();
+    }
+    sameDateTimes = sameDateTimes && first.m_impl->hasSameAlignedDateTimes(*ts.m_impl);
+  }
+
+  // same date times, accumulate in order so each value is added up as repeated operator+ would
+  if (sameDateTimes) {
+    Vector values = first.values();
+    for (auto it = timeSeriesVector.begin() + 1; it != timeSeriesVector.end(); ++it) {
+      values += it->m_impl->values();
     }
-    first = false;
+    return TimeSeries(first.dateTimes(), values, first.units());
+  }
+
+  // otherwise fold with operator+, the running sum only has values at the date times added so far
+  // so a series counts as 0 before its first report
+  TimeSeries result = first;
+  for (auto it = timeSeriesVector.begin() + 1; it != timeSeriesVector.end(); ++it) {
+    result = result + *it;
   }
   return result;
 }
 
+boost::optional<DateTime> coincidentPeakDateTime(const std::vector<TimeSeries>& timeSeriesVector)
+{
+  TimeSeries total = sum(timeSeriesVector);
+  Vector values = total.values();
+  if (values.empty()) {
+    return boost::none;
+  }
+
+  unsigned peak = std::max_element(values.begin(), values.end()) - values.begin();
+  return total.firstReportDateTime() + Time(0, 0, 0, total.secondsFromFirstReport(peak));
+}
+
 boost::function1<TimeSeries, const std::vector<TimeSeries>&> sumTimeSeriesFunctor()
 {
   typedef TimeSeries(*functype)(const std::vector<TimeSeries>&);
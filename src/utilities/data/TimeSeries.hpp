@@ -32,6 +32,7 @@
 
 #include "../UtilitiesAPI.hpp"
 
+#include "DataEnums.hpp"
 #include "Vector.hpp"
 #include "../time/Date.hpp"
 #include "../time/Time.hpp"
@@ -96,6 +97,12 @@ public:
 
   Vector values(const DateTime& startDateTime, const DateTime& endDateTime) const;
 
+  /// values at each of dateTimes, which should be sorted, as value(const DateTime&) would return them
+  Vector values(const DateTimeVector& dateTimes) const;
+
+  /// true if other has the same date times as this and value(dateTimes()[i]) == values(i) for both
+  bool hasSameAlignedDateTimes(const TimeSeries_Impl& other) const;
+
   double outOfRangeValue() const;
 
   void setOutOfRangeValue(double value);
@@ -110,9 +117,36 @@ public:
 
   double averageValue() const;
 
+  std::shared_ptr<TimeSeries_Impl> resample(const Time& intervalLength, const TimeSeriesAggregation& aggregation,
+                                            const Time& windowStart, const Time& windowEnd, double percentile) const;
+
+  std::shared_ptr<TimeSeries_Impl> resampleMonthly(const TimeSeriesAggregation& aggregation,
+                                                   const Time& windowStart, const Time& windowEnd, double percentile) const;
+
 private:
 
   REGISTER_LOGGER("utilities.TimeSeries_Impl");
+
+  // m_firstReportDateTime with the year used to compare against other date times
+  DateTime firstReportDateTimeWithYear() const;
+
+  // dateTime with the year used by value(const DateTime&)
+  DateTime dateTimeWithYear(const DateTime& dateTime, const DateTime& firstReportDateTimeWithYear) const;
+
+  // valueAtSecondsFromFirstReport at each of secondsFromFirstReport, fastest if these are sorted
+  Vector valuesAtSecondsFromFirstReport(const std::vector<long>& secondsFromFirstReport) const;
+
+  // true if value(dateTimes()[i]) == values(i) for all i
+  bool dateTimesMapToValues() const;
+
+  // union of the date times of this and other, ordered and unique as in a std::set, and the values of each at those
+  void alignedValues(const TimeSeries_Impl& other, DateTimeVector& dateTimes, Vector& values, Vector& otherValues) const;
+
+  // aggregates the values whose reporting interval ends in (bucketBoundaries[k], bucketBoundaries[k + 1]] and in the time
+  // of day window into result value k, bucketBoundaries are in seconds from midnight of the start date
+  std::shared_ptr<TimeSeries_Impl> resample(const std::vector<long>& bucketBoundaries, const TimeSeriesAggregation& aggregation,
+                                            const Time& windowStart, const Time& windowEnd, double percentile) const;
+
   // fully qualified first report date
   DateTime m_firstReportDateTime;
 
@@ -299,6 +333,26 @@ public:
   /** Compute the time series average value */
   double averageValue() const;
 
+  /** Aggregates the values reported in each interval of length intervalLength, counting intervals from midnight of the
+   *  day the series starts, e.g. Time(0, 1) for hourly or Time(1) for daily results. A value belongs to the interval
+   *  containing the end of its reporting interval. Intervals with no values are left out of the result. percentile, from
+   *  0 to 100, is only used with TimeSeriesAggregation::Percentile. */
+  TimeSeries resample(const Time& intervalLength, const TimeSeriesAggregation& aggregation, double percentile = 50.0) const;
+
+  /** As resample above, using only the values whose reporting interval ends in the time of day window
+   *  (windowStart, windowEnd], e.g. Time(0, 12) to Time(0, 18) for on peak hours. The window wraps around midnight if
+   *  windowEnd is before windowStart. */
+  TimeSeries resample(const Time& intervalLength, const TimeSeriesAggregation& aggregation,
+                      const Time& windowStart, const Time& windowEnd, double percentile = 50.0) const;
+
+  /** As resample above, aggregating the values in each calendar month. */
+  TimeSeries resampleMonthly(const TimeSeriesAggregation& aggregation, double percentile = 50.0) const;
+
+  /** As resampleMonthly above, using only the values whose reporting interval ends in the time of day window
+   *  (windowStart, windowEnd]. */
+  TimeSeries resampleMonthly(const TimeSeriesAggregation& aggregation, const Time& windowStart, const Time& windowEnd,
+                             double percentile = 50.0) const;
+
   //@}
 private:
 
@@ -306,6 +360,8 @@ private:
   // constructor from impl
   TimeSeries(std::shared_ptr<detail::TimeSeries_Impl> impl);
 
+  friend UTILITIES_API TimeSeries sum(const std::vector<TimeSeries>& timeSeriesVector);
+
   // pointer to impl
   std::shared_ptr<detail::TimeSeries_Impl> m_impl;
 };
@@ -323,9 +379,16 @@ UTILITIES_API TimeSeries operator*(double d, const TimeSeries& series);
 // We should be able to tackle double/TimeSeries after adding get/setQuantity to
 // IdfObject.
 
-// Helper function to add up all the TimeSeries in timeSeriesVector.
+/** Helper function to add up all the TimeSeries in timeSeriesVector, with the same result as adding them one at a time
+ *  with operator+. The series summed so far count as zero before their first report. Series reported at the same date
+ *  times are added in one pass. Returns an empty TimeSeries if the first series is empty or if the units differ. */
 UTILITIES_API TimeSeries sum(const std::vector<TimeSeries>& timeSeriesVector);
 
+/** Returns the date and time at which the sum of the TimeSeries in timeSeriesVector peaks, the first one if the peak
+ *  is reached more than once. Each series' value(const DateTime&) there is its coincident value. Returns an empty
+ *  optional if the series cannot be summed. */
+UTILITIES_API boost::optional<DateTime> coincidentPeakDateTime(const std::vector<TimeSeries>& timeSeriesVector);
+
 /** Returns std::function pointer to sum(const std::vector<TimeSeries>&). */
 UTILITIES_API boost::function1<TimeSeries, const std::vector<TimeSeries>&> sumTimeSeriesFunctor();
 
@@ -15,6 +15,7 @@
   #include <utilities/geometry/Point3d.hpp>
   #include <utilities/geometry/PointLatLon.hpp>
   #include <utilities/geometry/Plane.hpp>
+  #include <utilities/geometry/PolygonBatch.hpp>
   #include <utilities/geometry/EulerAngles.hpp>
   #include <utilities/geometry/Geometry.hpp>
   #include <utilities/geometry/Transformation.hpp>
@@ -93,6 +94,7 @@
 %include <utilities/geometry/Point3d.hpp>
 %include <utilities/geometry/PointLatLon.hpp>
 %include <utilities/geometry/Plane.hpp>
+%include <utilities/geometry/PolygonBatch.hpp>
 %include <utilities/geometry/EulerAngles.hpp>
 %include <utilities/geometry/Geometry.hpp>
 %include <utilities/geometry/Transformation.hpp>
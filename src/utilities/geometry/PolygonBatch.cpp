@@ -0,0 +1,217 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "PolygonBatch.hpp"
+#include "Geometry.hpp"
+
+#include "../core/Assert.hpp"
+
+#include <boost/math/constants/constants.hpp>
+
+#include <cmath>
+
+namespace openstudio{
+
+  PolygonBatch::PolygonBatch()
+    : m_offsets(1, 0u), m_computed(false)
+  {}
+
+  void PolygonBatch::reserve(unsigned numPolygons, unsigned numVertices)
+  {
+    m_x.reserve(numVertices);
+    m_y.reserve(numVertices);
+    m_z.reserve(numVertices);
+    m_offsets.reserve(numPolygons + 1);
+  }
+
+  unsigned PolygonBatch::addPolygon(const std::vector<Point3d>& vertices)
+  {
+    for (const Point3d& vertex : vertices) {
+      m_x.push_back(vertex.x());
+      m_y.push_back(vertex.y());
+      m_z.push_back(vertex.z());
+    }
+    m_offsets.push_back(m_x.size());
+    m_computed = false;
+    return numPolygons() - 1;
+  }
+
+  unsigned PolygonBatch::numPolygons() const
+  {
+    return m_offsets.size() - 1;
+  }
+
+  std::vector<Point3d> PolygonBatch::vertices(unsigned index) const
+  {
+    OS_ASSERT(index < numPolygons());
+    std::vector<Point3d> result;
+    result.reserve(m_offsets[index + 1] - m_offsets[index]);
+    for (unsigned i = m_offsets[index]; i < m_offsets[index + 1]; ++i) {
+      result.push_back(Point3d(m_x[i], m_y[i], m_z[i]));
+    }
+    return result;
+  }
+
+  const std::vector<double>& PolygonBatch::areas() const
+  {
+    compute();
+    return m_areas;
+  }
+
+  double PolygonBatch::area(unsigned index) const
+  {
+    OS_ASSERT(index < numPolygons());
+    compute();
+    return m_areas[index];
+  }
+
+  boost::optional<Vector3d> PolygonBatch::outwardNormal(unsigned index) const
+  {
+    OS_ASSERT(index < numPolygons());
+    compute();
+    if (!m_valid[index]) {
+      return boost::none;
+    }
+    return Vector3d(m_nx[index], m_ny[index], m_nz[index]);
+  }
+
+  boost::optional<double> PolygonBatch::tilt(unsigned index) const
+  {
+    OS_ASSERT(index < numPolygons());
+    compute();
+    if (!m_valid[index]) {
+      return boost::none;
+    }
+    return m_tilts[index];
+  }
+
+  boost::optional<double> PolygonBatch::azimuth(unsigned index) const
+  {
+    OS_ASSERT(index < numPolygons());
+    compute();
+    if (!m_valid[index]) {
+      return boost::none;
+    }
+    return m_azimuths[index];
+  }
+
+  boost::optional<Point3d> PolygonBatch::centroid(unsigned index) const
+  {
+    OS_ASSERT(index < numPolygons());
+    compute();
+    if (!m_centroidValid[index]) {
+      return boost::none;
+    }
+    return Point3d(m_cx[index], m_cy[index], m_cz[index]);
+  }
+
+  void PolygonBatch::compute() const
+  {
+    if (m_computed) {
+      return;
+    }
+
+    unsigned n = numPolygons();
+    m_valid.assign(n, 0);
+    m_areas.assign(n, 0.0);
+    m_nx.assign(n, 0.0);
+    m_ny.assign(n, 0.0);
+    m_nz.assign(n, 0.0);
+    m_tilts.assign(n, 0.0);
+    m_azimuths.assign(n, 0.0);
+    m_cx.assign(n, 0.0);
+    m_cy.assign(n, 0.0);
+    m_cz.assign(n, 0.0);
+    m_centroidValid.assign(n, 0);
+
+    const double* x = m_x.data();
+    const double* y = m_y.data();
+    const double* z = m_z.data();
+    const Vector3d up(0.0, 0.0, 1.0);
+    const Vector3d north(0.0, 1.0, 0.0);
+
+    for (unsigned p = 0; p < n; ++p) {
+      unsigned begin = m_offsets[p];
+      unsigned end = m_offsets[p + 1];
+      if (end - begin < 3) {
+        continue;
+      }
+
+      // Newall vector, same operation order as getNewallVector
+      double x0 = x[begin], y0 = y[begin], z0 = z[begin];
+      double vx = 0.0, vy = 0.0, vz = 0.0;
+      for (unsigned i = begin + 1; i < end - 1; ++i) {
+        double ax = x[i] - x0, ay = y[i] - y0, az = z[i] - z0;
+        double bx = x[i + 1] - x0, by = y[i + 1] - y0, bz = z[i + 1] - z0;
+        vx += (ay * bz - az * by);
+        vy += (az * bx - ax * bz);
+        vz += (ax * by - ay * bx);
+      }
+
+      double length = std::sqrt(vx * vx + vy * vy + vz * vz);
+      m_areas[p] = length / 2.0;
+      if (!(length > 0)) {
+        continue;
+      }
+
+      double mult = 1.0 / length;
+      double nx = vx * mult, ny = vy * mult, nz = vz * mult;
+      m_valid[p] = 1;
+      m_nx[p] = nx;
+      m_ny[p] = ny;
+      m_nz[p] = nz;
+
+      Vector3d normal(nx, ny, nz);
+      m_tilts[p] = getAngle(normal, up);
+      double rawAngle = getAngle(normal, north);
+      m_azimuths[p] = (nx < 0.0) ? (-rawAngle + 2.0 * boost::math::constants::pi<double>()) : rawAngle;
+
+      // centroid of the triangle fan, each triangle weighted by its signed area along the normal
+      double w = 0.0, cx = 0.0, cy = 0.0, cz = 0.0;
+      for (unsigned i = begin + 1; i < end - 1; ++i) {
+        double ax = x[i] - x0, ay = y[i] - y0, az = z[i] - z0;
+        double bx = x[i + 1] - x0, by = y[i + 1] - y0, bz = z[i + 1] - z0;
+        double wi = (ay * bz - az * by) * nx + (az * bx - ax * bz) * ny + (ax * by - ay * bx) * nz;
+        w += wi;
+        cx += wi * (ax + bx);
+        cy += wi * (ay + by);
+        cz += wi * (az + bz);
+      }
+      if (w > 0.0) {
+        m_centroidValid[p] = 1;
+        m_cx[p] = x0 + cx / (3.0 * w);
+        m_cy[p] = y0 + cy / (3.0 * w);
+        m_cz[p] = z0 + cz / (3.0 * w);
+      }
+    }
+
+    m_computed = true;
+  }
+
+} // openstudio
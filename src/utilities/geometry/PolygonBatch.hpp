@@ -0,0 +1,110 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_GEOMETRY_POLYGONBATCH_HPP
+#define UTILITIES_GEOMETRY_POLYGONBATCH_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include "Point3d.hpp"
+#include "Vector3d.hpp"
+
+#include <boost/optional.hpp>
+
+#include <vector>
+
+namespace openstudio{
+
+  /** PolygonBatch stores the vertices of many polygons in flat coordinate arrays and computes their
+   *  areas, outward normals, tilts, azimuths and centroids in a single pass over those arrays.
+   *  Areas, outward normals, tilts and azimuths are computed with the same operations as getArea,
+   *  getOutwardNormal and PlanarSurface::tilt/azimuth, so results are identical.  Centroids are
+   *  computed from a triangle fan and agree with getCentroid to within round off. */
+  class UTILITIES_API PolygonBatch {
+  public:
+
+    PolygonBatch();
+
+    /// reserve space for numPolygons polygons with numVertices vertices in total
+    void reserve(unsigned numPolygons, unsigned numVertices);
+
+    /// add a polygon, returns its index
+    unsigned addPolygon(const std::vector<Point3d>& vertices);
+
+    /// number of polygons
+    unsigned numPolygons() const;
+
+    /// vertices of polygon index
+    std::vector<Point3d> vertices(unsigned index) const;
+
+    /// areas of all polygons, 0 for polygons with fewer than 3 vertices as in PlanarSurface::grossArea
+    const std::vector<double>& areas() const;
+
+    /// area of polygon index, same as areas()[index]
+    double area(unsigned index) const;
+
+    /// outward normal of polygon index, empty if it cannot be computed
+    boost::optional<Vector3d> outwardNormal(unsigned index) const;
+
+    /// angle between outward normal of polygon index and the z axis in radians
+    boost::optional<double> tilt(unsigned index) const;
+
+    /// angle between outward normal of polygon index and the y axis in radians, measured clockwise
+    boost::optional<double> azimuth(unsigned index) const;
+
+    /// centroid of polygon index, empty if it cannot be computed
+    boost::optional<Point3d> centroid(unsigned index) const;
+
+  private:
+
+    void compute() const;
+
+    // vertices of polygon i are at [m_offsets[i], m_offsets[i+1])
+    std::vector<double> m_x;
+    std::vector<double> m_y;
+    std::vector<double> m_z;
+    std::vector<unsigned> m_offsets;
+
+    mutable bool m_computed;
+    mutable std::vector<char> m_valid; // 1 if outward normal is defined
+    mutable std::vector<double> m_areas;
+    mutable std::vector<double> m_nx;
+    mutable std::vector<double> m_ny;
+    mutable std::vector<double> m_nz;
+    mutable std::vector<double> m_tilts;
+    mutable std::vector<double> m_azimuths;
+    mutable std::vector<double> m_cx;
+    mutable std::vector<double> m_cy;
+    mutable std::vector<double> m_cz;
+    mutable std::vector<char> m_centroidValid;
+  };
+
+} // openstudio
+
+#endif //UTILITIES_GEOMETRY_POLYGONBATCH_HPP
@@ -0,0 +1,163 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include "GeometryFixture.hpp"
+
+#include "../PolygonBatch.hpp"
+#include "../Geometry.hpp"
+#include "../Point3d.hpp"
+#include "../Vector3d.hpp"
+#include "../Transformation.hpp"
+
+#include <boost/math/constants/constants.hpp>
+
+#include <chrono>
+
+using namespace openstudio;
+
+void checkPolygonBatch(const PolygonBatch& batch, unsigned index, const std::vector<Point3d>& points)
+{
+  EXPECT_EQ(points, batch.vertices(index));
+
+  // same convention as PlanarSurface::grossArea
+  boost::optional<double> area = getArea(points);
+  EXPECT_EQ(area ? *area : 0.0, batch.area(index));
+  EXPECT_EQ(batch.areas()[index], batch.area(index));
+
+  boost::optional<Vector3d> normal = getOutwardNormal(points);
+  ASSERT_EQ(static_cast<bool>(normal), static_cast<bool>(batch.outwardNormal(index)));
+  if (normal) {
+    EXPECT_EQ(normal->x(), batch.outwardNormal(index)->x());
+    EXPECT_EQ(normal->y(), batch.outwardNormal(index)->y());
+    EXPECT_EQ(normal->z(), batch.outwardNormal(index)->z());
+
+    ASSERT_TRUE(batch.tilt(index));
+    EXPECT_EQ(getAngle(*normal, Vector3d(0, 0, 1)), *batch.tilt(index));
+    ASSERT_TRUE(batch.azimuth(index));
+    double azimuth = getAngle(*normal, Vector3d(0, 1, 0));
+    if (normal->x() < 0.0) {
+      azimuth = -azimuth + 2.0 * boost::math::constants::pi<double>();
+    }
+    EXPECT_EQ(azimuth, *batch.azimuth(index));
+  }
+
+  boost::optional<Point3d> centroid = getCentroid(points);
+  ASSERT_EQ(static_cast<bool>(centroid), static_cast<bool>(batch.centroid(index)));
+  if (centroid) {
+    EXPECT_NEAR(centroid->x(), batch.centroid(index)->x(), 1.0e-9);
+    EXPECT_NEAR(centroid->y(), batch.centroid(index)->y(), 1.0e-9);
+    EXPECT_NEAR(centroid->z(), batch.centroid(index)->z(), 1.0e-9);
+  }
+}
+
+TEST_F(GeometryFixture, PolygonBatch)
+{
+  std::vector<std::vector<Point3d> > polygons;
+
+  // floor
+  polygons.push_back({Point3d(0, 10, 0), Point3d(10, 10, 0), Point3d(10, 0, 0), Point3d(0, 0, 0)});
+
+  // roof
+  polygons.push_back({Point3d(0, 0, 3), Point3d(10, 0, 3), Point3d(10, 10, 3), Point3d(0, 10, 3)});
+
+  // walls facing each direction
+  polygons.push_back({Point3d(0, 0, 3), Point3d(0, 0, 0), Point3d(10, 0, 0), Point3d(10, 0, 3)});
+  polygons.push_back({Point3d(10, 0, 3), Point3d(10, 0, 0), Point3d(10, 10, 0), Point3d(10, 10, 3)});
+  polygons.push_back({Point3d(10, 10, 3), Point3d(10, 10, 0), Point3d(0, 10, 0), Point3d(0, 10, 3)});
+  polygons.push_back({Point3d(0, 10, 3), Point3d(0, 10, 0), Point3d(0, 0, 0), Point3d(0, 0, 3)});
+
+  // non-convex L shape, rotated and tilted
+  std::vector<Point3d> lShape{Point3d(0, 0, 0), Point3d(4, 0, 0), Point3d(4, 1, 0), Point3d(1, 1, 0), Point3d(1, 3, 0), Point3d(0, 3, 0)};
+  Transformation t = Transformation::translation(Vector3d(1.5, -2.0, 7.0)) *
+                     Transformation::rotation(Vector3d(1, 1, 0), 0.3) *
+                     Transformation::rotation(Vector3d(0, 0, 1), 1.1);
+  polygons.push_back(t * lShape);
+
+  // degenerate polygons
+  polygons.push_back({Point3d(0, 0, 0), Point3d(1, 1, 1)});
+  polygons.push_back({Point3d(0, 0, 0), Point3d(1, 1, 1), Point3d(2, 2, 2)});
+  polygons.push_back({});
+
+  PolygonBatch batch;
+  EXPECT_EQ(0u, batch.numPolygons());
+  for (const auto& polygon : polygons) {
+    batch.addPolygon(polygon);
+  }
+  ASSERT_EQ(polygons.size(), batch.numPolygons());
+  ASSERT_EQ(polygons.size(), batch.areas().size());
+
+  for (unsigned i = 0; i < polygons.size(); ++i) {
+    checkPolygonBatch(batch, i, polygons[i]);
+  }
+
+  EXPECT_DOUBLE_EQ(100.0, batch.areas()[0]);
+  EXPECT_DOUBLE_EQ(6.0, batch.areas()[6]);
+  EXPECT_DOUBLE_EQ(0.0, batch.areas()[7]);
+
+  // adding a polygon recomputes
+  batch.addPolygon(polygons[0]);
+  checkPolygonBatch(batch, batch.numPolygons() - 1, polygons[0]);
+}
+
+TEST_F(GeometryFixture, PolygonBatch_Benchmark)
+{
+  unsigned n = 100000;
+  std::vector<std::vector<Point3d> > polygons;
+  for (unsigned i = 0; i < n; ++i) {
+    double x = i % 1000;
+    double y = i / 1000;
+    polygons.push_back({Point3d(x, y + 1, 0), Point3d(x + 1, y + 1, 0), Point3d(x + 1, y, 0), Point3d(x, y, 0)});
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  double total = 0.0;
+  for (const auto& polygon : polygons) {
+    total += getArea(polygon).get();
+    total += getOutwardNormal(polygon)->z();
+  }
+  auto end = std::chrono::steady_clock::now();
+  RecordProperty("PerPolygonTimeMs", std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()));
+
+  start = std::chrono::steady_clock::now();
+  PolygonBatch batch;
+  batch.reserve(n, 4 * n);
+  for (const auto& polygon : polygons) {
+    batch.addPolygon(polygon);
+  }
+  double batchTotal = 0.0;
+  for (unsigned i = 0; i < n; ++i) {
+    batchTotal += batch.areas()[i];
+    batchTotal += batch.outwardNormal(i)->z();
+  }
+  end = std::chrono::steady_clock::now();
+  RecordProperty("BatchTimeMs", std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()));
+
+  EXPECT_EQ(total, batchTotal);
+}
@@ -9,6 +9,7 @@
   #include <utilities/idf/IdfObject.hpp>
   #include <utilities/idf/IdfObjectWatcher.hpp>
   #include <utilities/idf/IdfFile.hpp>
+  #include <utilities/idf/IdfWriter.hpp>
   #include <utilities/idf/ImfFile.hpp>
   #include <utilities/idf/Workspace.hpp>
   #include <utilities/idf/Workspace_Impl.hpp>
@@ -86,6 +87,9 @@
 // ignore detail namespace
 %ignore openstudio::detail;
 
+// scope based, bindings should call Workspace::beginBatchEdit and endBatchEdit instead
+%ignore openstudio::WorkspaceBatchEdit;
+
 // ignore functions taking streams that were not previously already ignored on a global scale
 %ignore openstudio::IdfFile::load(std::istream&);
 %ignore openstudio::IdfFile::load(std::istream&, IddFileType);
@@ -130,6 +134,7 @@
 %include <utilities/idf/IdfExtensibleGroup.hpp>
 %include <utilities/idf/ImfFile.hpp>
 %include <utilities/idf/IdfFile.hpp>
+%include <utilities/idf/IdfWriter.hpp>
 %include <utilities/idf/ObjectOrderBase.hpp>
 %include <utilities/idf/WorkspaceObjectOrder.hpp>
 %include <utilities/idf/WorkspaceExtensibleGroup.hpp>
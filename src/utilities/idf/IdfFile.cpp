@@ -482,10 +482,36 @@ std::ostream& IdfFile::print(std::ostream& os) const {
 
 bool IdfFile::save(const openstudio::path& p, bool overwrite) {
 
+  boost::optional<path> wp = savePath(p, overwrite, m_iddFileAndFactoryWrapper);
+  if (!wp) {
+    return false;
+  }
+
+  openstudio::filesystem::ofstream outFile(*wp);
+  if (outFile) {
+    try {
+      print(outFile);
+      outFile.close();
+      return true;
+    }
+    catch (...) {
+      LOG(Error,"Unable to write file to path '" << toString(*wp) << "'.");
+      return false;
+    }
+  }
+
+  LOG(Error,"Unable to write file to path '" << toString(*wp) << "'.");
+  return false;
+}
+
+boost::optional<openstudio::path> IdfFile::savePath(const openstudio::path& p,
+                                                    bool overwrite,
+                                                    const IddFileAndFactoryWrapper& iddFileAndFactoryWrapper)
+{
   // default extension
   std::string expectedExtension;
   bool enforceExtension = false;
-  OptionalIddFileType iddType = m_iddFileAndFactoryWrapper.iddFileType();
+  OptionalIddFileType iddType = iddFileAndFactoryWrapper.iddFileType();
   if (iddType) {
     if (*iddType == IddFileType::EnergyPlus) {
       expectedExtension = "idf";
@@ -516,28 +542,17 @@ bool IdfFile::save(const openstudio::path& p, bool overwrite) {
     if (!temp.empty()) {
       LOG(Info,"Save method failed because instructed not to overwrite path '"
         << toString(wp) << "'.");
-      return false;
+      return boost::none;
     }
   }
 
-  if (makeParentFolder(wp)) {
-    openstudio::filesystem::ofstream outFile(wp);
-    if (outFile) {
-      try {
-        print(outFile);
-        outFile.close();
-        return true;
-      }
-      catch (...) {
-        LOG(Error,"Unable to write file to path '" << toString(wp) << "'.");
-        return false;
-      }
-    }
+  if (!makeParentFolder(wp)) {
+    LOG(Error,"Unable to write file to path '" << toString(wp) << "', because parent directory "
+        << "could not be created.");
+    return boost::none;
   }
 
-  LOG(Error,"Unable to write file to path '" << toString(wp) << "', because parent directory "
-      << "could not be created.");
-  return false;
+  return wp;
 }
 
 // PRIVATE
@@ -44,6 +44,7 @@
 namespace openstudio{
 
 // FORWARD DECLARATIONS
+class IdfWriter;
 class ProgressBar;
 class StrictnessLevel;
 class ValidityReport;
@@ -223,9 +224,17 @@ class UTILITIES_API IdfFile {
 
  protected:
   friend class detail::Workspace_Impl;
+  friend class IdfWriter;
 
   IddFileAndFactoryWrapper iddFileAndFactoryWrapper() const;
   void setIddFileAndFactoryWrapper(const IddFileAndFactoryWrapper& iddFileAndFactoryWrapper);
+
+  /** Returns the path that save writes to for p, after applying the default extension for the
+   *  IddFileType of iddFileAndFactoryWrapper, and creates its parent folder. Returns boost::none
+   *  if the file exists and overwrite is false, or if the parent folder can not be created. */
+  static boost::optional<openstudio::path> savePath(const openstudio::path& p,
+                                                    bool overwrite,
+                                                    const IddFileAndFactoryWrapper& iddFileAndFactoryWrapper);
  private:
 
   std::string m_header;
@@ -364,7 +364,7 @@ namespace detail {
   void IdfObject_Impl::setComment(const std::string& comment, bool checkValidity)
   {
     m_comment = makeComment(comment);
-    m_diffs.push_back(IdfObjectDiff(boost::none, boost::none, boost::none));
+    recordDiff(boost::none, boost::none, boost::none);
   }
 
   bool IdfObject_Impl::setFieldComment(unsigned index, const std::string& cmnt) {
@@ -383,7 +383,7 @@ namespace detail {
 
       m_fieldComments[index] = makeComment(cmnt);
 
-      m_diffs.push_back(IdfObjectDiff(index, m_fields[index], m_fields[index]));
+      recordDiff(index, m_fields[index], m_fields[index]);
 
       return true;
     }
@@ -442,17 +442,17 @@ namespace detail {
       if (n == 0 && i == 1) {
         OS_ASSERT(!m_handle.isNull());
         m_fields.push_back(toString(m_handle));
-        m_diffs.push_back(IdfObjectDiff(0u,boost::none,m_fields.back()));
+        recordDiff(0u,boost::none,m_fields.back());
       }
       n = numFields();
       if (i < n) {
         std::string oldName = m_fields[i];
         m_fields[i] = newName;
-        m_diffs.push_back(IdfObjectDiff(i, oldName, newName));
+        recordDiff(i, oldName, newName);
       }
       else {
         m_fields.push_back(newName);
-        m_diffs.push_back(IdfObjectDiff(i, boost::none, newName));
+        recordDiff(i, boost::none, newName);
       }
       //return decoded string since we might have made changes to it if its an EMS object.
       newName = decodeString(newName);
@@ -533,7 +533,7 @@ namespace detail {
       OS_ASSERT(index < m_fields.size());
 
       m_fields[index] = value;
-      m_diffs.push_back(IdfObjectDiff(index, oldValue, value));
+      recordDiff(index, oldValue, value);
       return result;
     }
     return false;
@@ -646,7 +646,7 @@ namespace detail {
         (m_iddObject.isExtensibleField(index) && (m_iddObject.properties().numExtensible == 1)))
     {
       m_fields.push_back(value);
-      m_diffs.push_back(IdfObjectDiff(index, boost::none, value));
+      recordDiff(index, boost::none, value);
       return true;
     }
     return false;
@@ -871,7 +871,7 @@ namespace detail {
 
       // record diffs for each field going backwards
       for (unsigned i = 0; i < groupSize; ++i){
-        m_diffs.push_back(IdfObjectDiff(numBeforePop-1-i, result[i], boost::none));
+        recordDiff(numBeforePop-1-i, result[i], boost::none);
       }
 
       m_fields.resize(numAfterPop);
@@ -1271,111 +1271,146 @@ namespace detail {
   }
 
   std::ostream& IdfObject_Impl::print(std::ostream& os) const {
+    std::string buffer;
+    appendIdfText(buffer, std::vector<std::pair<unsigned, std::string> >(), nullptr);
+    os << buffer;
+    return os;
+  }
+
+  std::ostream& IdfObject_Impl::printName(std::ostream& os, bool hasFields) const {
+    std::string buffer;
+    appendName(buffer, hasFields);
+    os << buffer;
+    return os;
+  }
+
+  std::ostream& IdfObject_Impl::printField(std::ostream& os,
+                                           unsigned index,
+                                           bool isLastField) const
+  {
+    if (index < numFields()) {
+      static int textWidth(0);
+      std::string buffer;
+      appendField(buffer, index, m_fields[index], isLastField, textWidth, nullptr);
+      os << buffer;
+    } // if index < numFields()
+    return os;
+  }
+
+  void IdfObject_Impl::appendIdfText(std::string& buffer,
+                                     const std::vector<std::pair<unsigned, std::string> >& fieldValues,
+                                     std::vector<std::string>* defaultFieldComments) const
+  {
     unsigned n = numFields();
-    if (n == 0) {
-      printName(os,false);
-    }
-    else {
-      printName(os,true);
-    }
+    appendName(buffer, n != 0);
 
+    int textWidth(0);
     for (unsigned i = 0; i < n; ++i) {
-      if (i < n-1) {
-        printField(os,i);
-      }
-      else {
-        printField(os,i,true);
+      const std::string* value = &m_fields[i];
+      for (const std::pair<unsigned, std::string>& fieldValue : fieldValues) {
+        if (fieldValue.first == i) {
+          value = &fieldValue.second;
+        }
       }
+      appendField(buffer, i, *value, i == n - 1, textWidth, defaultFieldComments);
     }
 
-    os << std::endl;
-
-    return os;
+    buffer += '\n';
   }
 
-  std::ostream& IdfObject_Impl::printName(std::ostream& os, bool hasFields) const {
+  void IdfObject_Impl::appendName(std::string& buffer, bool hasFields) const {
     // print comment, if any
     if (!m_comment.empty()){
-      os << m_comment << std::endl;
+      buffer += m_comment;
+      buffer += '\n';
     }
 
     // if this is a comment only object, return
     // todo, tighten up handling of comments with comment only object type
     if (boost::iequals(m_iddObject.name(), iddRegex::commentOnlyObjectName()) ){
-      return os;
+      return;
     }
 
-    os << m_iddObject.name();
+    buffer += m_iddObject.name();
 
     if (hasFields) {
-      os << "," << std::endl;
+      buffer += ",\n";
     }
     else {
-      os << ";" << std::endl;
+      buffer += ";\n";
     }
-
-    return os;
   }
 
-  std::ostream& IdfObject_Impl::printField(std::ostream& os,
-                                           unsigned index,
-                                           bool isLastField) const
+  void IdfObject_Impl::appendField(std::string& buffer,
+                                   unsigned index,
+                                   const std::string& value,
+                                   bool isLastField,
+                                   int& textWidth,
+                                   std::vector<std::string>* defaultFieldComments) const
   {
-    if (index < numFields()) {
-      // different formatting for vertices
-      if ((m_iddObject.properties().format == "vertices") && (m_iddObject.isExtensibleField(index))) {
-        ExtensibleIndex eIndex = m_iddObject.extensibleIndex(index);
-        static int textWidth(0);
-        if (eIndex.field == 0) {
-          os << "  ";
-          textWidth = 0;
-        }
-        else {
-          os << " ";
+    // different formatting for vertices
+    if ((m_iddObject.properties().format == "vertices") && (m_iddObject.isExtensibleField(index))) {
+      ExtensibleIndex eIndex = m_iddObject.extensibleIndex(index);
+      if (eIndex.field == 0) {
+        buffer += "  ";
+        textWidth = 0;
+      }
+      else {
+        buffer += ' ';
+      }
+      // field value
+      buffer += value;
+      // delimiter
+      buffer += (isLastField ? ';' : ',');
+      textWidth += value.size();
+      // comment
+      if (eIndex.field == m_iddObject.properties().numExtensible - 1) {
+        int numSpaces = IdfObject::printedFieldSpace() - textWidth - 4;
+        if (numSpaces > 0) {
+          buffer.append(numSpaces, ' ');
         }
-        // field value
-        os << m_fields[index];
-        // delimiter
-        if (isLastField) {
-          os << ";";
+        buffer += " !- X,Y,Z Vertex ";
+        buffer += std::to_string(eIndex.group + 1);
+        IddField iddField = m_iddObject.getField(index).get();
+        if (OptionalString units = iddField.properties().units) {
+          buffer += " {";
+          buffer += *units;
+          buffer += '}';
         }
-        else {
-          os << ",";
+        buffer += '\n';
+      }
+    }
+    else {
+      // field value
+      buffer += "  ";
+      buffer += value;
+      // delimiter
+      buffer += (isLastField ? ';' : ',');
+      // field comment
+      int numSpaces = IdfObject::printedFieldSpace() - int(value.size());
+      if (numSpaces > 0) {
+        buffer.append(numSpaces, ' ');
+      }
+      buffer += ' ';
+      if ((index < m_fieldComments.size()) && !m_fieldComments[index].empty()) {
+        buffer += m_fieldComments[index];
+      }
+      else if (defaultFieldComments) {
+        // default comments depend only on the IddObject, so are computed once per field
+        if (defaultFieldComments->size() <= index) {
+          defaultFieldComments->resize(index + 1);
         }
-        textWidth += m_fields[index].size();
-        // comment
-        if (eIndex.field == m_iddObject.properties().numExtensible - 1) {
-          int numSpaces = IdfObject::printedFieldSpace() - textWidth - 4;
-          if (numSpaces > 0) {
-            os << std::setw(numSpaces) << " ";
-          }
-          os << " !- X,Y,Z Vertex " << eIndex.group + 1;
-          IddField iddField = m_iddObject.getField(index).get();
-          if (OptionalString units = iddField.properties().units) {
-            os << " {" << *units << "}";
-          }
-          os << std::endl;
+        std::string& comment = (*defaultFieldComments)[index];
+        if (comment.empty()) {
+          comment = fieldComment(index, true).get();
         }
+        buffer += comment;
       }
       else {
-        // field value
-        os << "  " << m_fields[index];
-        // delimiter
-        if (isLastField) {
-          os << ";";
-        }
-        else {
-          os << ",";
-        }
-        // field comment
-        int numSpaces = IdfObject::printedFieldSpace() - int(m_fields[index].size());
-        if (numSpaces > 0) {
-          os << std::setw(numSpaces) << " ";
-        }
-        os << " " << fieldComment(index,true) << std::endl;
+        buffer += fieldComment(index, true).get();
       }
-    } // if index < numFields()
-    return os;
+      buffer += '\n';
+    }
   }
 
   void IdfObject_Impl::emitChangeSignals()
@@ -1416,7 +1451,32 @@ namespace detail {
 
     this->onChange.nano_emit();
 
-    m_diffs.clear();
+    clearDiffs();
+  }
+
+  bool IdfObject_Impl::diffsObserved() const
+  {
+    return !(this->onNameChange.empty() && this->onDataChange.empty());
+  }
+
+  void IdfObject_Impl::recordDiff(boost::optional<unsigned> index, const boost::optional<std::string>& oldValue, const boost::optional<std::string>& newValue)
+  {
+    if (diffsObserved()){
+      m_diffs.push_back(IdfObjectDiff(index, oldValue, newValue));
+    } else if (m_diffs.empty()){
+      // nothing will look at the values, only record that there is a change to signal
+      m_diffs.push_back(IdfObjectDiff(index, boost::none, boost::none));
+    }
+  }
+
+  void IdfObject_Impl::clearDiffs()
+  {
+    // release the memory of large batches of diffs rather than keeping it for the life of the object
+    if (m_diffs.capacity() > 16){
+      std::vector<IdfObjectDiff>().swap(m_diffs);
+    } else {
+      m_diffs.clear();
+    }
   }
 
   // PRIVATE
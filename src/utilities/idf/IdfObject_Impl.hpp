@@ -348,6 +348,17 @@ namespace detail {
      *  field value is followed by a ','. Otherwise, the object is ended by using a ';'. */
     std::ostream& printField(std::ostream& os, unsigned index, bool isLastField=false) const;
 
+    /** Appends this object to buffer as Idf text, exactly as print writes it. Entries of
+     *  fieldValues (index, encoded value) replace the stored values of those fields. If not null,
+     *  defaultFieldComments caches the default comment of each field of this object's IddObject
+     *  between calls, and must only be reused for objects of the same type. */
+    void appendIdfText(std::string& buffer,
+                       const std::vector<std::pair<unsigned, std::string> >& fieldValues,
+                       std::vector<std::string>* defaultFieldComments) const;
+
+    /** Converts a user string to one that can be written to file, for use in fieldValues. */
+    std::string encodeString(const std::string& value) const;
+
     //@}
     /** @name Type Casting */
     //@{
@@ -367,6 +378,9 @@ namespace detail {
     /** Emits signals after batch update and error checking is complete, clears the diffs */
     virtual void emitChangeSignals();
 
+    /** Returns true if a slot is connected to a signal that reports which fields changed. */
+    virtual bool diffsObserved() const;
+
     //@}
 
     //@}
@@ -400,9 +414,14 @@ namespace detail {
     std::vector<std::string> m_fields;
     std::vector<std::string> m_fieldComments; // only populated if encounter non-empty, non-default comment
 
-    // idf differences
+    // idf differences, field values are only recorded if diffsObserved(), otherwise a single
+    // diff is kept until the change signals are emitted
     std::vector<IdfObjectDiff> m_diffs;
 
+    void recordDiff(boost::optional<unsigned> index, const boost::optional<std::string>& oldValue, const boost::optional<std::string>& newValue);
+
+    void clearDiffs();
+
     // GETTER HELPERS
 
     std::vector<std::string> fields() const;
@@ -424,6 +443,21 @@ namespace detail {
 
     virtual bool fieldIsNonnullIfRequired(unsigned index) const;
 
+    // SERIALIZATION HELPERS
+
+    void appendName(std::string& buffer, bool hasFields) const;
+
+    // textWidth carries the width of the vertex printed so far between the fields of a vertex
+    void appendField(std::string& buffer,
+                     unsigned index,
+                     const std::string& value,
+                     bool isLastField,
+                     int& textWidth,
+                     std::vector<std::string>* defaultFieldComments) const;
+
+    // convert a string in file to one the use sees
+    std::string decodeString(const std::string& string) const;
+
    private:
 
     IdfObject_Impl(){}
@@ -463,12 +497,6 @@ namespace detail {
     /** Check fieldValue against bounds in iddField. */
     bool withinBounds(double fieldValue,const IddField& iddField) const;
 
-    // convert a user string to one that can be written to file
-    std::string encodeString(const std::string& value) const;
-
-    // convert a string in file to one the use sees
-    std::string decodeString(const std::string& string) const;
-
     // configure logging
     REGISTER_LOGGER("utilities.idf.IdfObject");
   };
@@ -0,0 +1,211 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "IdfWriter.hpp"
+#include "IdfFile.hpp"
+#include "IdfObject_Impl.hpp"
+
+#include "../idd/Comments.hpp"
+#include "../core/AtomicFileWriter.hpp"
+#include "../core/UUID.hpp"
+
+#include <boost/algorithm/string/case_conv.hpp>
+
+#include <unordered_map>
+
+namespace openstudio {
+
+IdfWriter::IdfWriter(IddFileType iddFileType)
+  : m_iddFileAndFactoryWrapper(iddFileType)
+{}
+
+std::string IdfWriter::header() const {
+  return m_header;
+}
+
+void IdfWriter::setHeader(const std::string& header) {
+  m_header = header;
+}
+
+bool IdfWriter::print(const std::vector<IdfObject>& objects, std::ostream& os) const {
+  std::string buffer;
+  buffer.reserve(1 << 20);
+  write(objects, buffer, [&]() {
+    if (buffer.size() >= (1 << 20)) {
+      os << buffer;
+      buffer.clear();
+    }
+  });
+  os << buffer;
+  return os.good();
+}
+
+bool IdfWriter::save(const std::vector<IdfObject>& objects, const openstudio::path& p, bool overwrite) const {
+
+  boost::optional<path> wp = IdfFile::savePath(p, overwrite, m_iddFileAndFactoryWrapper);
+  if (!wp) {
+    return false;
+  }
+
+  AtomicFileWriter writer(*wp);
+  if (!writer.good()) {
+    LOG(Error,"Unable to write file to path '" << toString(*wp) << "'.");
+    return false;
+  }
+
+  write(objects, writer.buffer(), [&]() { writer.flushIfFull(); });
+
+  if (!writer.commit()) {
+    LOG(Error,"Unable to write file to path '" << toString(*wp) << "'.");
+    return false;
+  }
+  return true;
+}
+
+void IdfWriter::write(const std::vector<IdfObject>& objects,
+                      std::string& buffer,
+                      const std::function<void()>& flushIfFull) const
+{
+  // header, as in Workspace::save
+  std::string header = makeComment(m_header);
+  if (!header.empty()) {
+    buffer += header;
+    buffer += '\n';
+  }
+  buffer += '\n';
+
+  std::size_t n = objects.size();
+  std::vector<std::shared_ptr<detail::IdfObject_Impl> > impls(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    impls[i] = objects[i].getImpl<detail::IdfObject_Impl>();
+  }
+
+  // step 1: names. objects without a name get one. the Workspace visits objects from last to
+  // first when resolving name conflicts, so the last object keeps a name and each earlier object
+  // whose name is already used in one of its reference lists is renamed, as the Workspace
+  // constructor and resolvePotentialNameConflicts would do with fast naming
+  std::vector<std::string> names(n);
+  std::vector<std::vector<std::pair<unsigned, std::string> > > fieldValues(n);
+  std::unordered_map<std::string, std::unordered_map<std::string, std::size_t> > referencesMap;
+  for (std::size_t i = n; i-- > 0; ) {
+    const detail::IdfObject_Impl& impl = *impls[i];
+    OptionalString name = impl.name();
+    if (!name) {
+      continue;
+    }
+    bool rename = name->empty() && impl.name(true).get().empty();
+
+    if (!name->empty()) {
+      std::string lName = boost::to_lower_copy(*name);
+      for (const std::string& referenceName : impl.iddObject().references()) {
+        // original names, the first object with a name is the one that pointers resolve to
+        auto inserted = referencesMap[referenceName].emplace(lName, i);
+        if (!inserted.second) {
+          if (!rename) {
+            LOG(Info,"Renamed " << impl.briefDescription() << " to avoid a name conflict.");
+            rename = true;
+          }
+          inserted.first->second = i;
+        }
+      }
+    }
+
+    if (rename) {
+      name = toString(createUUID());
+      fieldValues[i].push_back(std::make_pair(impl.iddObject().nameFieldIndex().get(), impl.encodeString(*name)));
+    }
+    names[i] = *name;
+  }
+
+  // step 2: object-list fields. pointers are resolved by the original names before conflicts are
+  // resolved, so they point at the first object with the target name under its (possibly new)
+  // name, or the field is cleared if there is no target, as WorkspaceObject_Impl::initializeOnAdd would
+  for (std::size_t i = 0; i < n; ++i) {
+    const detail::IdfObject_Impl& impl = *impls[i];
+    OptionalUnsigned nameFieldIndex = impl.iddObject().nameFieldIndex();
+    for (unsigned index : impl.objectListFields()) {
+      OptionalString targetName;
+      if (nameFieldIndex && (*nameFieldIndex == index)) {
+        targetName = impl.name();
+      }
+      else {
+        targetName = impl.getString(index);
+      }
+      if (!targetName || targetName->empty()) {
+        continue;
+      }
+
+      std::string lTargetName = boost::to_lower_copy(*targetName);
+      boost::optional<std::size_t> target;
+      for (const std::string& referenceName : impl.iddObject().objectLists(index)) {
+        auto referenceIt = referencesMap.find(referenceName);
+        if (referenceIt != referencesMap.end()) {
+          auto it = referenceIt->second.find(lTargetName);
+          if ((it != referenceIt->second.end()) && (!target || (it->second < *target))) {
+            target = it->second;
+          }
+        }
+      }
+
+      if (target) {
+        fieldValues[i].push_back(std::make_pair(index, impl.encodeString(names[*target])));
+        // forward references if is object-list and defines references simultaneously
+        for (const std::string& referenceName : impl.iddObject().getField(index)->properties().references) {
+          referencesMap[referenceName].emplace(lTargetName, *target);
+        }
+      }
+      else {
+        LOG(Warn,impl.briefDescription() << ", points to an object named " << *targetName
+            << " from field " << index << ", but that object cannot be located.");
+        fieldValues[i].push_back(std::make_pair(index, std::string()));
+      }
+    }
+  }
+
+  // step 3: print, version object first
+  OptionalIddObject versionIdd = m_iddFileAndFactoryWrapper.versionObject();
+  std::unordered_map<std::string, std::vector<std::string> > defaultFieldComments;
+  auto append = [&](std::size_t i) {
+    const detail::IdfObject_Impl& impl = *impls[i];
+    impl.appendIdfText(buffer, fieldValues[i], &defaultFieldComments[impl.iddObject().name()]);
+    flushIfFull();
+  };
+  for (std::size_t i = 0; i < n; ++i) {
+    if (versionIdd && (impls[i]->iddObject() == *versionIdd)) {
+      append(i);
+    }
+  }
+  for (std::size_t i = 0; i < n; ++i) {
+    if (!versionIdd || (impls[i]->iddObject() != *versionIdd)) {
+      append(i);
+    }
+  }
+}
+
+} // openstudio
@@ -0,0 +1,89 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_IDF_IDFWRITER_HPP
+#define UTILITIES_IDF_IDFWRITER_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include "../idd/IddFileAndFactoryWrapper.hpp"
+#include "IdfObject.hpp"
+
+#include "../core/Logger.hpp"
+#include "../core/Path.hpp"
+
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace openstudio {
+
+/** IdfWriter writes a list of \link IdfObject IdfObjects\endlink straight to text, producing
+ *  the same file that adding them to a Workspace with fast naming enabled (at
+ *  StrictnessLevel::None) and then saving it would, without building the Workspace.
+ *
+ *  Like Workspace, the version object is written first and object-list fields are matched to
+ *  their targets by name and reference list, case-insensitively. References that cannot be
+ *  located are cleared, objects without a name (and without a default name) are given a new
+ *  UUID name, and an object whose name conflicts with a later object sharing one of its
+ *  reference lists is renamed to a new UUID, so the last object keeps the name. References
+ *  are matched before renaming and point at the first object with the name, under its new
+ *  name, as they do in a Workspace. */
+class UTILITIES_API IdfWriter {
+ public:
+
+  explicit IdfWriter(IddFileType iddFileType);
+
+  std::string header() const;
+
+  void setHeader(const std::string& header);
+
+  /** Print objects to std::ostream os. Returns false if os is not good after writing. */
+  bool print(const std::vector<IdfObject>& objects, std::ostream& os) const;
+
+  /** Save objects to path p, following the same path rules as IdfFile::save. The file is
+   *  written through an AtomicFileWriter, so an existing file is only replaced once all
+   *  objects are written. Returns true if the save operation is successful. */
+  bool save(const std::vector<IdfObject>& objects, const openstudio::path& p, bool overwrite=false) const;
+
+ private:
+
+  REGISTER_LOGGER("utilities.idf.IdfWriter");
+
+  /** Formats objects into buffer, calling flushIfFull after each object. */
+  void write(const std::vector<IdfObject>& objects, std::string& buffer, const std::function<void()>& flushIfFull) const;
+
+  std::string m_header;
+  IddFileAndFactoryWrapper m_iddFileAndFactoryWrapper;
+};
+
+} // openstudio
+
+#endif // UTILITIES_IDF_IDFWRITER_HPP
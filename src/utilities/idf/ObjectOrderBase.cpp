@@ -43,7 +43,10 @@ ObjectOrderBase::ObjectOrderBase(bool directOrder) : m_orderByIddEnum(!directOrd
 
 ObjectOrderBase::ObjectOrderBase(const IddObjectTypeVector& iddOrder) :
     m_orderByIddEnum(false),
-    m_iddOrder(iddOrder) {}
+    m_iddOrder(iddOrder)
+{
+  indexIddOrder();
+}
 
 // GETTERS AND SETTERS
 
@@ -53,6 +56,7 @@ bool ObjectOrderBase::orderByIddEnum() const {
 
 void ObjectOrderBase::setOrderByIddEnum() {
   m_iddOrder = boost::none;
+  m_iddOrderIndex.clear();
   m_orderByIddEnum = true;
 }
 
@@ -63,10 +67,12 @@ boost::optional<IddObjectTypeVector> ObjectOrderBase::iddOrder() const {
 void ObjectOrderBase::setIddOrder(const IddObjectTypeVector& order) {
   m_iddOrder = order;
   m_orderByIddEnum = false;
+  indexIddOrder();
 }
 
 bool ObjectOrderBase::push_back(IddObjectType type) {
   if (!m_iddOrder) { return false; }
+  m_iddOrderIndex.emplace(type.value(), static_cast<unsigned>(m_iddOrder->size()));
   m_iddOrder->push_back(type);
   return true;
 }
@@ -75,6 +81,7 @@ bool ObjectOrderBase::insert(IddObjectType type, IddObjectType insertBeforeType)
   if (!m_iddOrder) { return false; }
   auto it = getIterator(insertBeforeType);
   m_iddOrder->insert(it,type);
+  indexIddOrder();
   return true;
 }
 
@@ -84,8 +91,9 @@ bool ObjectOrderBase::insert(IddObjectType type, unsigned index) {
     auto it = m_iddOrder->begin();
     for (unsigned i = 0; i < index; ++i, ++it);
     m_iddOrder->insert(it,type);
+    indexIddOrder();
   }
-  else { m_iddOrder->push_back(type); }
+  else { push_back(type); }
   return true;
 }
 
@@ -98,6 +106,7 @@ bool ObjectOrderBase::move(IddObjectType type, IddObjectType insertBeforeType) {
   if (type == insertBeforeType) { return true; }
   // erase type
   m_iddOrder->erase(it);
+  indexIddOrder();
   // reinsert at given location
   return insert(type,insertBeforeType);
 }
@@ -111,6 +120,7 @@ bool ObjectOrderBase::move(IddObjectType type, unsigned index) {
   if ((it - m_iddOrder->begin()) == static_cast<int>(index)) { return true; }
   // erase type
   m_iddOrder->erase(it);
+  indexIddOrder();
   // reinsert at given index
   return insert(type,index);
 }
@@ -124,6 +134,7 @@ bool ObjectOrderBase::swap(IddObjectType type1, IddObjectType type2) {
   if (it1 == it2) { return true; }
   *it1 = type2;
   *it2 = type1;
+  indexIddOrder();
   return true;
 }
 
@@ -132,12 +143,14 @@ bool ObjectOrderBase::erase(IddObjectType type) {
   auto it = getIterator(type);
   if (it == m_iddOrder->end()) { return false; }
   m_iddOrder->erase(it);
+  indexIddOrder();
   return true;
 }
 
 void ObjectOrderBase::setDirectOrder() {
   m_orderByIddEnum = false;
   m_iddOrder = boost::none;
+  m_iddOrderIndex.clear();
 }
 
 // SORTING
@@ -148,7 +161,7 @@ bool ObjectOrderBase::less(IddObjectType left, IddObjectType right) const {
   }
   else {
     OS_ASSERT(m_iddOrder);
-    return (getIterator(left) < getIterator(right));
+    return (iddOrderPosition(left) < iddOrderPosition(right));
   }
 }
 
@@ -185,12 +198,31 @@ OptionalUnsigned ObjectOrderBase::indexInOrder(const IddObjectType& type) const
 // assumes that m_iddOrder == true
 IddObjectTypeVector::iterator ObjectOrderBase::getIterator(const IddObjectType& type) {
   OS_ASSERT(m_iddOrder);
-  return std::find(m_iddOrder->begin(),m_iddOrder->end(),type);
+  return m_iddOrder->begin() + iddOrderPosition(type);
 }
 
 IddObjectTypeVector::const_iterator ObjectOrderBase::getIterator(const IddObjectType& type) const {
   OS_ASSERT(m_iddOrder);
-  return std::find(m_iddOrder->begin(),m_iddOrder->end(),type);
+  return m_iddOrder->begin() + iddOrderPosition(type);
+}
+
+unsigned ObjectOrderBase::iddOrderPosition(const IddObjectType& type) const {
+  OS_ASSERT(m_iddOrder);
+  auto it = m_iddOrderIndex.find(type.value());
+  if (it == m_iddOrderIndex.end()) {
+    return static_cast<unsigned>(m_iddOrder->size());
+  }
+  return it->second;
+}
+
+void ObjectOrderBase::indexIddOrder() {
+  m_iddOrderIndex.clear();
+  if (!m_iddOrder) { return; }
+  m_iddOrderIndex.reserve(m_iddOrder->size());
+  for (unsigned i = 0, n = static_cast<unsigned>(m_iddOrder->size()); i < n; ++i) {
+    // emplace keeps the first occurrence, matching std::find
+    m_iddOrderIndex.emplace((*m_iddOrder)[i].value(), i);
+  }
 }
 
 } // openstudio
@@ -37,6 +37,8 @@
 #include "../core/Logger.hpp"
 #include "../core/Optional.hpp"
 
+#include <unordered_map>
+
 /** \file ObjectOrderBase.hpp
  *
  *  Handles ordering by IddObjectType. Does not explicitly sort any objects, but provides
@@ -129,11 +131,19 @@ class UTILITIES_API ObjectOrderBase {
 
   bool m_orderByIddEnum;
   OptionalIddObjectTypeVector m_iddOrder;
+  // position of the first occurrence of each type in m_iddOrder, kept in sync with m_iddOrder
+  std::unordered_map<int, unsigned> m_iddOrderIndex;
 
   // HELPER FUNCTIONS
   IddObjectTypeVector::iterator getIterator(const IddObjectType& type);
   IddObjectTypeVector::const_iterator getIterator(const IddObjectType& type) const;
 
+  // returns m_iddOrder->size() if type is not in the order
+  unsigned iddOrderPosition(const IddObjectType& type) const;
+
+  // rebuilds m_iddOrderIndex, call after any change to m_iddOrder other than push_back
+  void indexIddOrder();
+
  private:
 
   REGISTER_LOGGER("utilities.idf.ObjectOrderBase");
@@ -145,3 +145,30 @@ TEST_F(IdfFixture,IdfObjectWatcher_Extensible)
   watcher.clearState();
   EXPECT_FALSE(watcher.dirty());
 }
+
+TEST_F(IdfFixture,IdfObjectWatcher_AttachAfterChanges)
+{
+  // field values are not recorded while nothing is watching the object
+  IdfObject object(IddObjectType::Lights);
+  ASSERT_TRUE(object.setString(4,"22.3"));
+  EXPECT_TRUE(object.setName("Unwatched Light"));
+
+  IdfObjectWatcher watcher(object);
+  EXPECT_FALSE(watcher.dirty());
+
+  EXPECT_TRUE(object.setName("Watched Light"));
+  EXPECT_TRUE(watcher.dirty());
+  EXPECT_TRUE(watcher.nameChanged());
+  EXPECT_FALSE(watcher.dataChanged());
+  watcher.clearState();
+
+  // setting the same value is not reported as a data change
+  ASSERT_TRUE(object.setString(4,"22.3"));
+  EXPECT_TRUE(watcher.dirty());
+  EXPECT_FALSE(watcher.dataChanged());
+  watcher.clearState();
+
+  ASSERT_TRUE(object.setString(4,"18.0"));
+  EXPECT_TRUE(watcher.dataChanged());
+  EXPECT_FALSE(watcher.nameChanged());
+}
@@ -0,0 +1,159 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include "IdfFixture.hpp"
+
+#include "../IdfWriter.hpp"
+#include "../IdfFile.hpp"
+#include "../Workspace.hpp"
+#include "../WorkspaceObject.hpp"
+#include "../../core/UUID.hpp"
+
+#include <utilities/idd/IddEnums.hxx>
+#include <utilities/idd/Lights_FieldEnums.hxx>
+
+#include <chrono>
+#include <fstream>
+#include <sstream>
+
+using namespace openstudio;
+
+namespace {
+  // what ForwardTranslator did with its objects before IdfWriter
+  std::string printThroughWorkspace(const IdfObjectVector& idfObjects) {
+    Workspace workspace(StrictnessLevel::None, IddFileType::EnergyPlus);
+    OptionalWorkspaceObject vo = workspace.versionObject();
+    workspace.removeObject(vo->handle());
+    workspace.setFastNaming(true);
+    workspace.addObjects(idfObjects);
+    workspace.setFastNaming(false);
+    std::stringstream ss;
+    workspace.toIdfFile().print(ss);
+    return ss.str();
+  }
+}
+
+TEST_F(IdfFixture, IdfWriter_SameAsWorkspace) {
+  // version object last, writer moves it to the front like Workspace does
+  IdfObjectVector idfObjects = epIdfFile.objects();
+  ASSERT_TRUE(epIdfFile.versionObject());
+  idfObjects.push_back(*epIdfFile.versionObject());
+
+  std::stringstream ss;
+  EXPECT_TRUE(IdfWriter(IddFileType::EnergyPlus).print(idfObjects, ss));
+  EXPECT_EQ(printThroughWorkspace(idfObjects), ss.str());
+
+  openstudio::path p = outDir / toPath("IdfWriter_SameAsWorkspace.idf");
+  EXPECT_TRUE(IdfWriter(IddFileType::EnergyPlus).save(idfObjects, p, true));
+  std::ifstream file(toString(p));
+  std::stringstream fileText;
+  fileText << file.rdbuf();
+  EXPECT_EQ(ss.str(), fileText.str());
+  EXPECT_FALSE(IdfWriter(IddFileType::EnergyPlus).save(idfObjects, p));
+}
+
+TEST_F(IdfFixture, IdfWriter_Names) {
+  IdfObjectVector idfObjects;
+
+  IdfObject zone(IddObjectType::Zone);
+  zone.setName("Zone A");
+  idfObjects.push_back(zone);
+
+  IdfObject duplicateZone(IddObjectType::Zone);
+  duplicateZone.setName("ZONE A");
+  idfObjects.push_back(duplicateZone);
+
+  IdfObject unnamedZone(IddObjectType::Zone);
+  idfObjects.push_back(unnamedZone);
+
+  IdfObject lights(IddObjectType::Lights);
+  lights.setName("Lights");
+  lights.setString(LightsFields::ZoneorZoneListName, "zone a");
+  idfObjects.push_back(lights);
+
+  IdfObject lostLights(IddObjectType::Lights);
+  lostLights.setName("Lost Lights");
+  lostLights.setString(LightsFields::ZoneorZoneListName, "Missing Zone");
+  idfObjects.push_back(lostLights);
+
+  std::stringstream ss;
+  EXPECT_TRUE(IdfWriter(IddFileType::EnergyPlus).print(idfObjects, ss));
+
+  OptionalIdfFile idfFile = IdfFile::load(ss, IddFileType::EnergyPlus);
+  ASSERT_TRUE(idfFile);
+  IdfObjectVector zones = idfFile->getObjectsByType(IddObjectType::Zone);
+  ASSERT_EQ(3u, zones.size());
+  // like the Workspace, the first object is renamed and the pointer follows it
+  EXPECT_NE("Zone A", zones[0].name().get());
+  EXPECT_FALSE(zones[0].name().get().empty());
+  EXPECT_EQ("ZONE A", zones[1].name().get());
+  EXPECT_FALSE(zones[2].name().get().empty());
+  EXPECT_NE(zones[0].name().get(), zones[2].name().get());
+
+  IdfObjectVector allLights = idfFile->getObjectsByType(IddObjectType::Lights);
+  ASSERT_EQ(2u, allLights.size());
+  EXPECT_EQ(zones[0].name().get(), allLights[0].getString(LightsFields::ZoneorZoneListName).get());
+  EXPECT_EQ("", allLights[1].getString(LightsFields::ZoneorZoneListName).get());
+
+  // objects named by fast naming get a new UUID each time
+  EXPECT_EQ(boost::regex_replace(printThroughWorkspace(idfObjects), uuidInString(), "UUID"),
+            boost::regex_replace(ss.str(), uuidInString(), "UUID"));
+
+  // the objects themselves are not changed
+  EXPECT_EQ("ZONE A", duplicateZone.name().get());
+  EXPECT_TRUE(unnamedZone.name().get().empty());
+  EXPECT_EQ("zone a", lights.getString(LightsFields::ZoneorZoneListName).get());
+}
+
+TEST_F(IdfFixture, IdfWriter_Benchmark) {
+  IdfObjectVector idfObjects;
+  for (unsigned i = 0; i < 5000; ++i) {
+    IdfObject zone(IddObjectType::Zone);
+    zone.setName("Zone " + std::to_string(i));
+    idfObjects.push_back(zone);
+    IdfObject lights(IddObjectType::Lights);
+    lights.setName("Lights " + std::to_string(i));
+    lights.setString(LightsFields::ZoneorZoneListName, "Zone " + std::to_string(i));
+    idfObjects.push_back(lights);
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  std::string workspaceText = printThroughWorkspace(idfObjects);
+  auto end = std::chrono::steady_clock::now();
+  RecordProperty("WorkspaceTimeMs", std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()));
+
+  start = std::chrono::steady_clock::now();
+  std::stringstream ss;
+  EXPECT_TRUE(IdfWriter(IddFileType::EnergyPlus).print(idfObjects, ss));
+  end = std::chrono::steady_clock::now();
+  RecordProperty("IdfWriterTimeMs", std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()));
+
+  EXPECT_EQ(workspaceText, ss.str());
+}
@@ -34,6 +34,8 @@
 #include "../WorkspaceObject.hpp"
 #include "../WorkspaceObjectOrder.hpp"
 
+#include <chrono>
+
 using namespace openstudio;
 
 // Test in context of Workspace, since order needs objectGetter.
@@ -128,3 +130,45 @@ TEST_F(IdfFixture,WorkspaceObjectOrder_ByIddObjectType) {
   }
 
 }
+
+TEST_F(IdfFixture,WorkspaceObjectOrder_LargeDirectOrder) {
+  Workspace workspace(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+  IdfObjectVector idfObjects;
+  for (unsigned i = 0; i < 20000; ++i) {
+    idfObjects.push_back(IdfObject(IddObjectType::Zone, true));
+  }
+  WorkspaceObjectVector objects = workspace.addObjects(idfObjects, false);
+  ASSERT_EQ(20000u, objects.size());
+
+  // reverse the order
+  HandleVector reversed;
+  for (auto it = objects.rbegin(), itEnd = objects.rend(); it != itEnd; ++it) {
+    reversed.push_back(it->handle());
+  }
+  WorkspaceObjectOrder wsOrder = workspace.order();
+  wsOrder.setDirectOrder(reversed);
+
+  auto start = std::chrono::steady_clock::now();
+  HandleVector sorted = workspace.handles(true);
+  auto end = std::chrono::steady_clock::now();
+  RecordProperty("SortTimeMs", std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()));
+  EXPECT_TRUE(reversed == sorted);
+
+  // positions stay consistent as the order is edited
+  ASSERT_TRUE(wsOrder.indexInOrder(reversed[10]));
+  EXPECT_EQ(10u, *wsOrder.indexInOrder(reversed[10]));
+  EXPECT_TRUE(wsOrder.erase(reversed[5]));
+  EXPECT_FALSE(wsOrder.inOrder(reversed[5]));
+  EXPECT_EQ(9u, *wsOrder.indexInOrder(reversed[10]));
+  EXPECT_TRUE(wsOrder.move(reversed[10], 0));
+  EXPECT_EQ(0u, *wsOrder.indexInOrder(reversed[10]));
+  EXPECT_EQ(1u, *wsOrder.indexInOrder(reversed[0]));
+  EXPECT_TRUE(wsOrder.push_back(reversed[5]));
+  EXPECT_EQ(19999u, *wsOrder.indexInOrder(reversed[5]));
+  EXPECT_TRUE(wsOrder.swap(reversed[5], reversed[10]));
+  EXPECT_EQ(0u, *wsOrder.indexInOrder(reversed[5]));
+  EXPECT_EQ(19999u, *wsOrder.indexInOrder(reversed[10]));
+  EXPECT_TRUE(wsOrder.insert(reversed[10], reversed[0]));
+  EXPECT_EQ(1u, *wsOrder.indexInOrder(reversed[10]));
+  EXPECT_EQ(2u, *wsOrder.indexInOrder(reversed[0]));
+}
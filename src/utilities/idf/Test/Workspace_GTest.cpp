@@ -55,6 +55,7 @@
 #include <utilities/idd/Sizing_Zone_FieldEnums.hxx>
 #include <utilities/idd/OS_WeatherFile_FieldEnums.hxx>
 #include "../WorkspaceWatcher.hpp"
+#include "../IdfObjectWatcher.hpp"
 #include "IdfTestQObjects.hpp"
 
 #include "../../core/Path.hpp"
@@ -67,6 +68,11 @@
 
 #include <resources.hxx>
 
+#include <fstream>
+
+#include <algorithm>
+#include <chrono>
+
 
 
 
@@ -2149,3 +2155,214 @@ TEST_F(IdfFixture, Workspace_getObjects_Type_StringOverload) {
   }
 
 }
+
+namespace {
+
+  struct ChangeCounter : public Nano::Observer {
+    unsigned count = 0;
+    void change() { ++count; }
+  };
+
+}
+
+TEST_F(IdfFixture, Workspace_BatchEdit) {
+  Workspace workspace(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+  IdfObjectVector idfObjects;
+  for (unsigned i = 0; i < 10000; ++i) {
+    idfObjects.push_back(IdfObject(IddObjectType::Lights));
+  }
+  WorkspaceObjectVector lights = workspace.addObjects(idfObjects, false);
+  ASSERT_EQ(10000u, lights.size());
+
+  ChangeCounter counter;
+  workspace.getImpl<detail::Workspace_Impl>()->onChange.connect<ChangeCounter, &ChangeCounter::change>(&counter);
+  IdfObjectWatcher watcher(lights[0]);
+
+  // 100k field edits
+  auto start = std::chrono::steady_clock::now();
+  {
+    WorkspaceBatchEdit batchEdit(workspace);
+    EXPECT_TRUE(workspace.batchEditing());
+    for (unsigned i = 0; i < 10; ++i) {
+      for (WorkspaceObject& light : lights) {
+        EXPECT_TRUE(light.setDouble(LightsFields::LightingLevel, i));
+      }
+    }
+
+    // onChange of the object is emitted right away, data change is deferred
+    EXPECT_TRUE(watcher.dirty());
+    EXPECT_FALSE(watcher.dataChanged());
+    EXPECT_EQ(0u, counter.count);
+
+    // nested batch edits are merged
+    workspace.beginBatchEdit();
+    EXPECT_TRUE(lights[1].setName("Batch Light"));
+    workspace.endBatchEdit();
+    EXPECT_TRUE(workspace.batchEditing());
+    EXPECT_EQ(0u, counter.count);
+  }
+  auto end = std::chrono::steady_clock::now();
+  RecordProperty("BatchEditTimeMs", std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()));
+
+  EXPECT_FALSE(workspace.batchEditing());
+  EXPECT_TRUE(watcher.dataChanged());
+  EXPECT_FALSE(watcher.nameChanged());
+  EXPECT_EQ(1u, counter.count);
+  ASSERT_TRUE(lights[0].getDouble(LightsFields::LightingLevel));
+  EXPECT_DOUBLE_EQ(9.0, lights[0].getDouble(LightsFields::LightingLevel).get());
+
+  // outside of a batch edit each change is signaled
+  counter.count = 0;
+  EXPECT_TRUE(lights[0].setDouble(LightsFields::LightingLevel, 1.0));
+  EXPECT_TRUE(lights[1].setDouble(LightsFields::LightingLevel, 1.0));
+  EXPECT_EQ(2u, counter.count);
+
+  // removed objects are skipped when deferred signals are emitted
+  counter.count = 0;
+  workspace.beginBatchEdit();
+  EXPECT_TRUE(lights[2].setDouble(LightsFields::LightingLevel, 2.0));
+  EXPECT_TRUE(lights[2].remove().size() == 1u);
+  workspace.endBatchEdit();
+  EXPECT_EQ(1u, counter.count);
+
+  workspace.getImpl<detail::Workspace_Impl>()->onChange.disconnect<ChangeCounter, &ChangeCounter::change>(&counter);
+}
+
+TEST_F(IdfFixture, Workspace_CloneLarge) {
+  Workspace workspace(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+  unsigned n = 20000;
+  auto start = std::chrono::steady_clock::now();
+  IdfObjectVector idfObjects;
+  for (unsigned i = 0; i < n; ++i) {
+    IdfObject zone(IddObjectType::Zone);
+    zone.setName("Zone " + std::to_string(i));
+    idfObjects.push_back(zone);
+    IdfObject light(IddObjectType::Lights);
+    light.setName("Light " + std::to_string(i));
+    light.setString(LightsFields::ZoneorZoneListName, "Zone " + std::to_string(i));
+    idfObjects.push_back(light);
+  }
+  WorkspaceObjectVector objects = workspace.addObjects(idfObjects, false);
+  auto end = std::chrono::steady_clock::now();
+  RecordProperty("CreateTimeMs", std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()));
+  ASSERT_EQ(2 * n, objects.size());
+
+  start = std::chrono::steady_clock::now();
+  Workspace clone = workspace.clone();
+  end = std::chrono::steady_clock::now();
+  RecordProperty("CloneTimeMs", std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()));
+
+  EXPECT_EQ(workspace.numObjects(), clone.numObjects());
+  WorkspaceObjectVector clonedLights = clone.getObjectsByType(IddObjectType::Lights);
+  ASSERT_EQ(n, clonedLights.size());
+  for (const WorkspaceObject& light : clonedLights) {
+    EXPECT_FALSE(workspace.getObject(light.handle()));
+    OptionalWorkspaceObject zone = light.getTarget(LightsFields::ZoneorZoneListName);
+    ASSERT_TRUE(zone);
+    EXPECT_FALSE(workspace.getObject(zone->handle()));
+    ASSERT_TRUE(clone.getObject(zone->handle()));
+    EXPECT_EQ(light.name().get().substr(6), zone->name().get().substr(5));
+    EXPECT_EQ(1u, zone->getSources(IddObjectType::Lights).size());
+  }
+
+  // clone keeping handles
+  Workspace sameHandles = workspace.clone(true);
+  HandleVector handles = workspace.handles();
+  HandleVector cloneHandles = sameHandles.handles();
+  std::sort(handles.begin(), handles.end());
+  std::sort(cloneHandles.begin(), cloneHandles.end());
+  EXPECT_TRUE(handles == cloneHandles);
+
+  // subset clones drop pointers to objects that are not in the subset
+  HandleVector subset;
+  subset.push_back(objects[0].handle());
+  subset.push_back(objects[1].handle());
+  subset.push_back(objects[3].handle());
+  Workspace subsetClone = workspace.cloneSubset(subset);
+  clonedLights = subsetClone.getObjectsByType(IddObjectType::Lights);
+  ASSERT_EQ(2u, clonedLights.size());
+  for (const WorkspaceObject& light : clonedLights) {
+    if (light.name().get() == "Light 0") {
+      ASSERT_TRUE(light.getTarget(LightsFields::ZoneorZoneListName));
+      EXPECT_EQ("Zone 0", light.getTarget(LightsFields::ZoneorZoneListName)->name().get());
+    }
+    else {
+      EXPECT_EQ("Light 1", light.name().get());
+      EXPECT_FALSE(light.getTarget(LightsFields::ZoneorZoneListName));
+    }
+  }
+}
+
+namespace {
+  std::string readFile(const openstudio::path& p) {
+    std::ifstream file(toString(p));
+    std::stringstream ss;
+    ss << file.rdbuf();
+    return ss.str();
+  }
+}
+
+TEST_F(IdfFixture, Workspace_Save) {
+  Workspace workspace(epIdfFile);
+
+  // pointer to a target without a name, save names it
+  OptionalWorkspaceObject zone = workspace.addObject(IdfObject(IddObjectType::Zone));
+  ASSERT_TRUE(zone);
+  IdfObject light(IddObjectType::Lights);
+  light.setName("Light in unnamed zone");
+  OptionalWorkspaceObject lights = workspace.addObject(light);
+  ASSERT_TRUE(lights);
+  EXPECT_TRUE(lights->setPointer(LightsFields::ZoneorZoneListName, zone->handle()));
+
+  openstudio::path p = outDir / toPath("Workspace_Save.idf");
+  if (openstudio::filesystem::exists(p)) {
+    openstudio::filesystem::remove(p);
+  }
+  ASSERT_TRUE(workspace.save(p));
+  EXPECT_FALSE(zone->name().get().empty());
+
+  // same text as the file written by the baseline save, toIdfFile().save(), before it streamed through AtomicFileWriter
+  std::string expected = readFile(resourcesPath() / toPath("utilities/Idf/Workspace_Save_Baseline.idf"));
+  ASSERT_FALSE(expected.empty());
+  EXPECT_EQ(expected, readFile(p));
+
+  // will not overwrite, and the existing file is left untouched
+  EXPECT_FALSE(workspace.save(p));
+  EXPECT_TRUE(workspace.save(p, true));
+  EXPECT_EQ(expected, readFile(p));
+
+  // no temporary files are left behind
+  for (openstudio::filesystem::directory_iterator it(outDir); it != openstudio::filesystem::directory_iterator(); ++it) {
+    EXPECT_NE(".tmp", toString(it->path().extension()));
+  }
+}
+
+TEST_F(IdfFixture, Workspace_SaveLarge) {
+  Workspace workspace(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+  unsigned n = 20000;
+  IdfObjectVector idfObjects;
+  for (unsigned i = 0; i < n; ++i) {
+    IdfObject zone(IddObjectType::Zone);
+    zone.setName("Zone " + std::to_string(i));
+    idfObjects.push_back(zone);
+    IdfObject light(IddObjectType::Lights);
+    light.setName("Light " + std::to_string(i));
+    light.setString(LightsFields::ZoneorZoneListName, "Zone " + std::to_string(i));
+    idfObjects.push_back(light);
+  }
+  workspace.addObjects(idfObjects, false);
+
+  openstudio::path idfFilePath = outDir / toPath("Workspace_SaveLarge_IdfFile.idf");
+  auto start = std::chrono::steady_clock::now();
+  ASSERT_TRUE(workspace.toIdfFile().save(idfFilePath, true));
+  auto end = std::chrono::steady_clock::now();
+  RecordProperty("IdfFileSaveTimeMs", std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()));
+
+  openstudio::path workspacePath = outDir / toPath("Workspace_SaveLarge.idf");
+  start = std::chrono::steady_clock::now();
+  ASSERT_TRUE(workspace.save(workspacePath, true));
+  end = std::chrono::steady_clock::now();
+  RecordProperty("WorkspaceSaveTimeMs", std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()));
+
+  EXPECT_EQ(readFile(idfFilePath), readFile(workspacePath));
+}
@@ -39,7 +39,10 @@
 #include "../plot/ProgressBar.hpp"
 
 #include "../core/Assert.hpp"
+#include "../core/AtomicFileWriter.hpp"
+#include "../core/Parallel.hpp"
 #include "../core/StringHelpers.hpp"
+#include "../idd/Comments.hpp"
 
 #include <boost/lexical_cast.hpp>
 
@@ -58,7 +61,10 @@ namespace detail {
       m_iddFileAndFactoryWrapper(iddFileType),
       m_fastNaming(false),
       m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
-          WorkspaceObjectOrder_Impl(HandleVector(),std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
+          WorkspaceObjectOrder_Impl(HandleVector(),std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1)))),
+      m_batchEditDepth(0),
+      m_emittingDeferredChangeSignals(false),
+      m_batchEditChanged(false)
   {
     m_workspaceObjectMap.reserve(1<<15);
     m_idfReferencesMap.reserve(1<<15);
@@ -71,7 +77,10 @@ namespace detail {
       m_iddFileAndFactoryWrapper(idfFile.iddFileAndFactoryWrapper()),
       m_fastNaming(false),
       m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
-          WorkspaceObjectOrder_Impl(HandleVector(),std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
+          WorkspaceObjectOrder_Impl(HandleVector(),std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1)))),
+      m_batchEditDepth(0),
+      m_emittingDeferredChangeSignals(false),
+      m_batchEditChanged(false)
   {
     m_workspaceObjectMap.reserve(1<<15);
     m_idfReferencesMap.reserve(1<<15);
@@ -83,7 +92,10 @@ namespace detail {
     m_iddFileAndFactoryWrapper(other.m_iddFileAndFactoryWrapper),
     m_fastNaming(other.fastNaming()),
     m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
-          WorkspaceObjectOrder_Impl(std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
+          WorkspaceObjectOrder_Impl(std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1)))),
+    m_batchEditDepth(0),
+    m_emittingDeferredChangeSignals(false),
+    m_batchEditChanged(false)
   {
     // m_workspaceObjectOrder
     OptionalIddObjectTypeVector iddOrderVector = other.order().iddOrder();
@@ -107,7 +119,10 @@ namespace detail {
       m_iddFileAndFactoryWrapper(other.m_iddFileAndFactoryWrapper),
       m_fastNaming(other.fastNaming()),
       m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
-          WorkspaceObjectOrder_Impl(hs,std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
+          WorkspaceObjectOrder_Impl(hs,std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1)))),
+      m_batchEditDepth(0),
+      m_emittingDeferredChangeSignals(false),
+      m_batchEditChanged(false)
   {
     // m_workspaceObjectOrder
     OptionalIddObjectTypeVector iddOrderVector = other.order().iddOrder();
@@ -621,10 +636,15 @@ namespace detail {
       this->progressValue.nano_emit(++i);
     }
 
-    // step 2: apply handle map to pointers
+    // step 2: apply handle map to pointers. the remap only touches each object's own pointer
+    // data, so it is done in parallel; registering the results with the workspace is serial.
     if (!oldNewHandleMap.empty()) {
-      for (const WorkspaceObject_ImplPtr& ptr : objectImplPtrs) {
-        ptr->initializeOnClone(oldNewHandleMap);
+      std::vector<std::vector<unsigned> > unmappedFields(objectImplPtrs.size());
+      parallelFor(objectImplPtrs.size(), [&](std::size_t j) {
+        unmappedFields[j] = objectImplPtrs[j]->remapPointersOnClone(oldNewHandleMap);
+      });
+      for (std::size_t j = 0, n = objectImplPtrs.size(); j < n; ++j) {
+        objectImplPtrs[j]->registerPointersOnClone(unmappedFields[j]);
         this->progressValue.nano_emit(++i);
       }
     }
@@ -1512,7 +1532,7 @@ namespace detail {
     if ((m_strictnessLevel < StrictnessLevel::Final) || isValid()) {
       std::vector<Handle> removedHandles(1, handle);
       registerRemovalOfObject(objectData->objectImplPtr,sources,removedHandles);
-      this->onChange.nano_emit();
+      this->change();
       return true;
     }
     else {
@@ -1544,7 +1564,7 @@ namespace detail {
 
     if ((m_strictnessLevel < StrictnessLevel::Final) || isValid()) {
       registerRemovalOfObjects(objectData,sources,handles);
-      this->onChange.nano_emit();
+      this->change();
       return true;
     }
     else {
@@ -1887,7 +1907,52 @@ namespace detail {
   // SERIALIZATION
 
   bool Workspace_Impl::save(const openstudio::path& p, bool overwrite) {
-    return toIdfFile().save(p,overwrite);
+
+    boost::optional<path> wp = IdfFile::savePath(p, overwrite, m_iddFileAndFactoryWrapper);
+    if (!wp) {
+      return false;
+    }
+
+    // writes the same text as toIdfFile().save, but formats each object straight into the
+    // writer's buffer instead of copying every object into an IdfFile first
+    AtomicFileWriter writer(*wp);
+    if (!writer.good()) {
+      LOG(Error,"Unable to write file to path '" << toString(*wp) << "'.");
+      return false;
+    }
+    std::string& buffer = writer.buffer();
+
+    // header
+    std::string header = makeComment(m_header);
+    if (!header.empty()) {
+      buffer += header;
+      buffer += '\n';
+    }
+    buffer += '\n';
+
+    std::vector<std::pair<unsigned, std::string> > pointerFields;
+    std::unordered_map<std::string, std::vector<std::string> > defaultFieldComments;
+    auto append = [&](const WorkspaceObject& obj) {
+      std::shared_ptr<WorkspaceObject_Impl> impl = obj.getImpl<WorkspaceObject_Impl>();
+      impl->appendIdfText(buffer, pointerFields, &defaultFieldComments[impl->iddObject().name()]);
+      writer.flushIfFull();
+    };
+
+    // version object
+    if (OptionalWorkspaceObject vo = versionObject()) {
+      append(*vo);
+    }
+
+    // objects, with handle pointers replaced by names
+    for (const WorkspaceObject& obj : objects(true)) { // sorted objects
+      append(obj);
+    }
+
+    if (!writer.commit()) {
+      LOG(Error,"Unable to write file to path '" << toString(*wp) << "'.");
+      return false;
+    }
+    return true;
   }
 
   IdfFile Workspace_Impl::toIdfFile() {
@@ -2351,7 +2416,7 @@ namespace detail {
     auto sh_ptr = object.getImpl<WorkspaceObject_Impl>();
     this->addWorkspaceObject.nano_emit(object, object.iddObject().type(), object.handle());
     this->addWorkspaceObjectPtr.nano_emit(sh_ptr, object.iddObject().type(), object.handle());
-    this->onChange.nano_emit();
+    this->change();
   }
 
   void Workspace_Impl::restoreObject(SavedWorkspaceObject& savedObject) {
@@ -2494,24 +2559,75 @@ namespace detail {
   }
 
   void Workspace_Impl::change() {
+    if (m_batchEditDepth > 0) {
+      m_batchEditChanged = true;
+      return;
+    }
     this->onChange.nano_emit();
   }
 
+  void Workspace_Impl::beginBatchEdit() {
+    ++m_batchEditDepth;
+  }
+
+  void Workspace_Impl::endBatchEdit() {
+    if (m_batchEditDepth == 0) {
+      LOG(Warn, "endBatchEdit called without a matching beginBatchEdit.");
+      return;
+    }
+    if (m_batchEditDepth > 1 || m_emittingDeferredChangeSignals) {
+      --m_batchEditDepth;
+      return;
+    }
+
+    // emit deferred signals while still in the batch edit so that onChange is only emitted once,
+    // objects edited by slots connected to these signals emit their signals immediately
+    m_emittingDeferredChangeSignals = true;
+    std::vector<Handle> deferred;
+    deferred.swap(m_deferredChangeSignals);
+    m_deferredChangeSignalsSet.clear();
+    for (const Handle& handle : deferred) {
+      auto it = m_workspaceObjectMap.find(handle);
+      if (it != m_workspaceObjectMap.end()) {
+        // keep the object alive in case a slot removes it
+        std::shared_ptr<WorkspaceObject_Impl> objectImpl = it->second;
+        objectImpl->emitChangeSignals();
+      }
+    }
+    m_emittingDeferredChangeSignals = false;
+    m_batchEditDepth = 0;
+
+    if (m_batchEditChanged) {
+      m_batchEditChanged = false;
+      this->onChange.nano_emit();
+    }
+  }
+
+  bool Workspace_Impl::batchEditing() const {
+    return (m_batchEditDepth > 0);
+  }
+
+  bool Workspace_Impl::deferChangeSignals(const Handle& handle) {
+    if ((m_batchEditDepth == 0) || m_emittingDeferredChangeSignals) {
+      return false;
+    }
+    if (m_deferredChangeSignalsSet.insert(handle).second) {
+      m_deferredChangeSignals.push_back(handle);
+    }
+    return true;
+  }
+
   void Workspace_Impl::createAndAddClonedObjects(
       const std::shared_ptr<detail::Workspace_Impl>& thisImpl,
       std::shared_ptr<detail::Workspace_Impl> cloneImpl,
       bool keepHandles) const
   {
-    detail::WorkspaceObject_ImplPtrVector newObjectImplPtrs;
-    HandleMap oldNewHandleMap;
-    for (const WorkspaceObject& object : allObjects()) {
-      newObjectImplPtrs.push_back(cloneImpl->createObject(
-          object.getImpl<detail::WorkspaceObject_Impl>(),keepHandles));
-      Handle h = newObjectImplPtrs.back()->handle();
-      if (!keepHandles) { oldNewHandleMap.insert(HandleMap::value_type(object.handle(),h)); }
+    std::vector<WorkspaceObject_ImplPtr> originalObjectImplPtrs;
+    originalObjectImplPtrs.reserve(m_workspaceObjectMap.size());
+    for (const WorkspaceObjectMap::value_type& p : m_workspaceObjectMap) {
+      originalObjectImplPtrs.push_back(p.second);
     }
-    // add Object_ImplPtrs to clone's Workspace_Impl
-    cloneImpl->addClones(newObjectImplPtrs,oldNewHandleMap,true);
+    createAndAddClones(originalObjectImplPtrs,cloneImpl,keepHandles);
   }
 
   void Workspace_Impl::createAndAddSubsetClonedObjects(
@@ -2528,16 +2644,34 @@ namespace detail {
       }
     }
 
-    // construct clone's WorkspaceObject_ImplPtrs
-    detail::WorkspaceObject_ImplPtrVector newObjectImplPtrs;
-    HandleMap oldNewHandleMap;
+    std::vector<WorkspaceObject_ImplPtr> originalObjectImplPtrs;
+    originalObjectImplPtrs.reserve(wHandles.size());
     for (const Handle& h : wHandles) {
-      OptionalWorkspaceObject object = thisImpl->getObject(h);
-      if (object) {
-        newObjectImplPtrs.push_back(cloneImpl->createObject(
-            object->getImpl<detail::WorkspaceObject_Impl>(),keepHandles));
-        Handle newH = newObjectImplPtrs.back()->handle();
-        if (!keepHandles) { oldNewHandleMap.insert(HandleMap::value_type(h,newH)); }
+      auto it = thisImpl->m_workspaceObjectMap.find(h);
+      if (it != thisImpl->m_workspaceObjectMap.end()) {
+        originalObjectImplPtrs.push_back(it->second);
+      }
+    }
+    createAndAddClones(originalObjectImplPtrs,cloneImpl,keepHandles);
+  }
+
+  void Workspace_Impl::createAndAddClones(
+      const std::vector<WorkspaceObject_ImplPtr>& originalObjectImplPtrs,
+      const std::shared_ptr<detail::Workspace_Impl>& cloneImpl,
+      bool keepHandles) const
+  {
+    // construct clone's WorkspaceObject_ImplPtrs. each copy only reads its original (and creates
+    // its own handle), so they are built in parallel, in the original order.
+    std::size_t n = originalObjectImplPtrs.size();
+    detail::WorkspaceObject_ImplPtrVector newObjectImplPtrs(n);
+    parallelFor(n, [&](std::size_t i) {
+      newObjectImplPtrs[i] = cloneImpl->createObject(originalObjectImplPtrs[i],keepHandles);
+    });
+
+    HandleMap oldNewHandleMap;
+    if (!keepHandles) {
+      for (std::size_t i = 0; i < n; ++i) {
+        oldNewHandleMap.insert(HandleMap::value_type(originalObjectImplPtrs[i]->handle(),newObjectImplPtrs[i]->handle()));
       }
     }
 
@@ -2870,6 +3004,18 @@ bool Workspace::operator!=(const Workspace& other) const {
   return !(operator==(other));
 }
 
+void Workspace::beginBatchEdit() {
+  m_impl->beginBatchEdit();
+}
+
+void Workspace::endBatchEdit() {
+  m_impl->endBatchEdit();
+}
+
+bool Workspace::batchEditing() const {
+  return m_impl->batchEditing();
+}
+
 // connect a progress bar
 bool Workspace::connectProgressBar(openstudio::ProgressBar& progressBar)
 {
@@ -2971,6 +3117,17 @@ void Workspace::addVersionObject() {
   }
 }
 
+WorkspaceBatchEdit::WorkspaceBatchEdit(const Workspace& workspace)
+  : m_workspace(workspace)
+{
+  m_workspace.beginBatchEdit();
+}
+
+WorkspaceBatchEdit::~WorkspaceBatchEdit()
+{
+  m_workspace.endBatchEdit();
+}
+
 std::ostream& operator<<(std::ostream& os, const Workspace& workspace)
 {
   os << workspace.toIdfFile();
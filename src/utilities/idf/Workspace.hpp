@@ -443,6 +443,23 @@ class UTILITIES_API Workspace {
    *  serialized as names. */
   IdfFile toIdfFile() const;
 
+  //@}
+  /** @name Batch Editing */
+  //@{
+
+  /** Starts a batch edit. Until the matching endBatchEdit, objects in this Workspace only emit
+   *  their own onChange signal when edited (so cached values stay correct); name, data and
+   *  relationship change signals are collected and emitted once per edited object when the
+   *  outermost batch edit ends, followed by a single Workspace onChange. Calls may be nested.
+   *  Prefer WorkspaceBatchEdit, which ends the batch edit when it goes out of scope. */
+  void beginBatchEdit();
+
+  /** Ends a batch edit started with beginBatchEdit. */
+  void endBatchEdit();
+
+  /** Returns true if a batch edit is in progress. */
+  bool batchEditing() const;
+
   //@}
   /** @name GUI Helpers */
   //@{
@@ -510,6 +527,29 @@ class UTILITIES_API Workspace {
   std::shared_ptr<detail::Workspace_Impl> m_impl;
 };
 
+/** Starts a batch edit of workspace on construction and ends it on destruction. For instance,
+ *
+ *  \code
+ *  {
+ *    WorkspaceBatchEdit batchEdit(model);
+ *    for (WorkspaceObject& object : model.objects()) {
+ *      object.setName(object.nameString() + " renamed");
+ *    }
+ *  } // deferred change signals are emitted here
+ *  \endcode */
+class UTILITIES_API WorkspaceBatchEdit {
+ public:
+  explicit WorkspaceBatchEdit(const Workspace& workspace);
+
+  ~WorkspaceBatchEdit();
+
+  WorkspaceBatchEdit(const WorkspaceBatchEdit&) = delete;
+  WorkspaceBatchEdit& operator=(const WorkspaceBatchEdit&) = delete;
+
+ private:
+  Workspace m_workspace;
+};
+
 /** \relates Workspace */
 typedef boost::optional<Workspace> OptionalWorkspace;
 
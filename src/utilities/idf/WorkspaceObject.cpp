@@ -141,7 +141,12 @@ namespace detail {
   }
 
   void WorkspaceObject_Impl::initializeOnClone(const HandleMap& oldNewHandleMap) {
-    OS_ASSERT(m_workspace);
+    std::vector<unsigned> unmappedFields = remapPointersOnClone(oldNewHandleMap);
+    registerPointersOnClone(unmappedFields);
+  }
+
+  std::vector<unsigned> WorkspaceObject_Impl::remapPointersOnClone(const HandleMap& oldNewHandleMap) {
+    std::vector<unsigned> unmappedFields;
     if (m_sourceData) {
       SourceData::pointer_set mappedPointers;
       for (const ForwardPointer& fp : m_sourceData->pointers) {
@@ -149,17 +154,10 @@ namespace detail {
         if (th.isNull() && !fp.targetHandle.isNull() && !oldNewHandleMap.empty()) {
           // if cloned object is also in this workspace, and fp.targetHandle not in
           // the map, may be in the workspace
-          OptionalWorkspaceObject target = workspace().getObject(fp.targetHandle);
-          if (target) {
-            // need to set reverse pointer
-            target->getImpl<WorkspaceObject_Impl>()->setReversePointer(handle(),fp.fieldIndex);
-            th = fp.targetHandle;
-          }
+          unmappedFields.push_back(fp.fieldIndex);
+          th = fp.targetHandle;
         }
         mappedPointers.insert(ForwardPointer(fp.fieldIndex,th));
-        if (!th.isNull()) {
-          m_workspace->forwardReferences(m_handle,fp.fieldIndex,th);
-        }
       }
       m_sourceData->pointers = mappedPointers;
     }
@@ -173,6 +171,32 @@ namespace detail {
       }
       m_targetData->reversePointers = mappedPointers;
     }
+    return unmappedFields;
+  }
+
+  void WorkspaceObject_Impl::registerPointersOnClone(const std::vector<unsigned>& unmappedFields) {
+    OS_ASSERT(m_workspace);
+    if (!m_sourceData) {
+      return;
+    }
+    for (unsigned index : unmappedFields) {
+      auto it = getIteratorAtFieldIndex<SourceData>(m_sourceData->pointers,index);
+      OS_ASSERT(it != m_sourceData->pointers.end());
+      OptionalWorkspaceObject target = workspace().getObject(it->targetHandle);
+      if (target) {
+        // need to set reverse pointer
+        target->getImpl<WorkspaceObject_Impl>()->setReversePointer(handle(),index);
+      }
+      else {
+        m_sourceData->pointers.erase(it);
+        m_sourceData->pointers.insert(ForwardPointer(index,Handle()));
+      }
+    }
+    for (const ForwardPointer& fp : m_sourceData->pointers) {
+      if (!fp.targetHandle.isNull()) {
+        m_workspace->forwardReferences(m_handle,fp.fieldIndex,fp.targetHandle);
+      }
+    }
   }
 
   // GETTERS
@@ -559,7 +583,11 @@ namespace detail {
         newValue = m_workspace->name(targetHandle);
       }
 
-      m_diffs.push_back(WorkspaceObjectDiff(index, oldValue, newValue, oldHandle, targetHandle));
+      if (diffsObserved()){
+        m_diffs.push_back(WorkspaceObjectDiff(index, oldValue, newValue, oldHandle, targetHandle));
+      } else {
+        recordDiff(index, oldValue, newValue);
+      }
 
       if (checkValid && !isValid(level,false)) {
         if (n) {
@@ -920,6 +948,49 @@ namespace detail {
     return result;
   }
 
+  void WorkspaceObject_Impl::appendIdfText(std::string& buffer,
+                                           std::vector<std::pair<unsigned, std::string> >& pointerFields,
+                                           std::vector<std::string>* defaultFieldComments)
+  {
+    if (!initialized()) {
+      LOG_AND_THROW("Attempt to write a disconnected WorkspaceObject out to Idf.");
+    }
+
+    // same values as idfObjectImplPtr sets with setString
+    pointerFields.clear();
+    if (m_sourceData) {
+      bool serializeHandle = m_iddObject.hasHandleField();
+      OptionalUnsigned nameFieldIndex = m_iddObject.nameFieldIndex();
+      for (const ForwardPointer& ptr : m_sourceData->pointers) {
+        if (!ptr.targetHandle.isNull()) {
+          if (nameFieldIndex && (*nameFieldIndex == ptr.fieldIndex)) {
+            // setString goes through setName for the name field, let the copy handle it
+            idfObjectImplPtr()->appendIdfText(buffer, std::vector<std::pair<unsigned, std::string> >(), defaultFieldComments);
+            return;
+          }
+          if (serializeHandle) {
+            pointerFields.push_back(std::make_pair(ptr.fieldIndex, toString(ptr.targetHandle)));
+          }
+          else {
+            OptionalString targetName = m_workspace->name(ptr.targetHandle);
+            OS_ASSERT(targetName);
+            if (targetName->empty()) {
+              // give target a name
+              OptionalWorkspaceObject target = m_workspace->getObject(ptr.targetHandle);
+              OS_ASSERT(target);
+              target->createName(false);
+              targetName = target->name();
+              OS_ASSERT(targetName);
+            }
+            pointerFields.push_back(std::make_pair(ptr.fieldIndex, encodeString(*targetName)));
+          }
+        }
+      }
+    }
+
+    IdfObject_Impl::appendIdfText(buffer, pointerFields, defaultFieldComments);
+  }
+
   /** Returns equivalent IdfObject, naming targets if necessary. All data is cloned. */
   IdfObject WorkspaceObject_Impl::idfObject()
   {
@@ -938,6 +1009,13 @@ namespace detail {
       return;
     }
 
+    // during a batch edit only onChange is emitted right away, it keeps cached values up to date;
+    // the other signals are emitted for all of the collected diffs when the batch edit ends
+    if (m_workspace && m_workspace->deferChangeSignals(m_handle)){
+      this->onChange.nano_emit();
+      return;
+    }
+
     bool nameChange = false;
     bool dataChange = false;
 
@@ -986,7 +1064,12 @@ namespace detail {
 
     this->onChange.nano_emit();
 
-    m_diffs.clear();
+    clearDiffs();
+  }
+
+  bool WorkspaceObject_Impl::diffsObserved() const
+  {
+    return (IdfObject_Impl::diffsObserved() || !this->onRelationshipChange.empty());
   }
 
   // PROTECTED
@@ -1033,6 +1116,7 @@ namespace detail {
     auto it = m_targetData->reversePointers.find(ReversePointer(sourceHandle,index));
     OS_ASSERT(it != m_targetData->reversePointers.end());
     m_targetData->reversePointers.erase(it);
+    this->onSourcesChange.nano_emit();
   }
 
   // Pre-condition:  ReversePointer(sourceHandle,index) is not in m_targetData.
@@ -1045,6 +1129,7 @@ namespace detail {
     std::pair<TargetData::pointer_set::iterator,bool> insertResult;
     insertResult = m_targetData->reversePointers.insert(ReversePointer(sourceHandle,index));
     OS_ASSERT(insertResult.second);
+    this->onSourcesChange.nano_emit();
   }
 
   void WorkspaceObject_Impl::restorePointers() {
@@ -1174,7 +1259,7 @@ namespace detail {
     // last field must be nonextensible, and final size must satisfy minimum number of fields
     if ((index >= minFields()) && (numExtensibleGroups() == 0)) {
       // delete field
-      m_diffs.push_back(IdfObjectDiff(index, m_fields[index], boost::none));
+      recordDiff(index, m_fields[index], boost::none);
       m_fields.pop_back();
       if (m_fieldComments.size() > m_fields.size()) {
         m_fieldComments.resize(m_fields.size());
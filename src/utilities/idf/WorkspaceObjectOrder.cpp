@@ -44,7 +44,10 @@ namespace detail {
 
   WorkspaceObjectOrder_Impl::WorkspaceObjectOrder_Impl(const std::vector<Handle>& directOrder,
                                                        const ObjectGetter& objectGetter)
-    : ObjectOrderBase(true), m_objectGetter(objectGetter), m_directOrder(directOrder) {}
+    : ObjectOrderBase(true), m_objectGetter(objectGetter), m_directOrder(directOrder)
+  {
+    indexDirectOrder();
+  }
 
   WorkspaceObjectOrder_Impl::WorkspaceObjectOrder_Impl(
       const std::vector<IddObjectType>& iddOrder,const ObjectGetter& objectGetter)
@@ -63,10 +66,12 @@ namespace detail {
     /// may get unexpected results.
     ObjectOrderBase::setDirectOrder();
     m_directOrder = order;
+    indexDirectOrder();
   }
 
   bool WorkspaceObjectOrder_Impl::push_back(const Handle& handle) {
     if (!m_directOrder) { return false; }
+    m_directOrderIndex.emplace(handle, static_cast<unsigned>(m_directOrder->size()));
     m_directOrder->push_back(handle);
     return true;
   }
@@ -75,6 +80,7 @@ namespace detail {
     if (!m_directOrder) { return false; }
     auto it = getIterator(insertBeforeHandle);
     m_directOrder->insert(it,handle);
+    indexDirectOrder();
     return true;
   }
 
@@ -84,11 +90,11 @@ namespace detail {
       auto it = m_directOrder->begin();
       for (unsigned i = 0; i < index; ++i, ++it);
       m_directOrder->insert(it,handle);
+      indexDirectOrder();
       return true;
     }
     else {
-      m_directOrder->push_back(handle);
-      return true;
+      return push_back(handle);
     }
   }
 
@@ -101,6 +107,7 @@ namespace detail {
     if (handle == insertBeforeHandle) { return true; }
     // erase handle
     m_directOrder->erase(it);
+    indexDirectOrder();
     // reinsert at given location
     return insert(handle,insertBeforeHandle);
   }
@@ -114,6 +121,7 @@ namespace detail {
     if ((it - m_directOrder->begin()) == static_cast<int>(index)) { return true; }
     // erase handle
     m_directOrder->erase(it);
+    indexDirectOrder();
     // reinsert at given location
     return insert(handle,index);
   }
@@ -126,6 +134,7 @@ namespace detail {
     if (it1 == it2) { return true; }
     *it1 = handle2;
     *it2 = handle1;
+    indexDirectOrder();
     return true;
   }
 
@@ -134,17 +143,20 @@ namespace detail {
     auto it = getIterator(handle);
     if (it == m_directOrder->end()) { return false; }
     m_directOrder->erase(it);
+    indexDirectOrder();
     return true;
   }
 
   void WorkspaceObjectOrder_Impl::setOrderByIddEnum() {
     ObjectOrderBase::setOrderByIddEnum();
     m_directOrder = boost::none;
+    m_directOrderIndex.clear();
   }
 
   void WorkspaceObjectOrder_Impl::setIddOrder(const std::vector<IddObjectType>& order) {
     ObjectOrderBase::setIddOrder(order);
     m_directOrder = boost::none;
+    m_directOrderIndex.clear();
   }
 
   // SORTING
@@ -155,7 +167,7 @@ namespace detail {
       return ObjectOrderBase::less(getIddObjectType(left),getIddObjectType(right));
     }
     else {
-      return (getIterator(left) < getIterator(right));
+      return (directOrderPosition(left) < directOrderPosition(right));
     }
   }
 
@@ -167,7 +179,7 @@ namespace detail {
       return ObjectOrderBase::less(left.iddObject().type(),right.iddObject().type());
     }
     else {
-      return (getIterator(left) < getIterator(right));
+      return (directOrderPosition(left.handle()) < directOrderPosition(right.handle()));
     }
   }
 
@@ -256,7 +268,7 @@ namespace detail {
   // only call when m_directOrder == true
   std::vector<Handle>::iterator WorkspaceObjectOrder_Impl::getIterator(const Handle& handle) {
     OS_ASSERT(m_directOrder);
-    return std::find(m_directOrder->begin(),m_directOrder->end(),handle);
+    return m_directOrder->begin() + directOrderPosition(handle);
   }
 
   std::vector<Handle>::iterator WorkspaceObjectOrder_Impl::getIterator(IddObjectType type) {
@@ -273,14 +285,14 @@ namespace detail {
       const WorkspaceObject& object)
   {
     OS_ASSERT(m_directOrder);
-    return std::find(m_directOrder->begin(),m_directOrder->end(),object.handle());
+    return m_directOrder->begin() + directOrderPosition(object.handle());
   }
 
   std::vector<Handle>::const_iterator WorkspaceObjectOrder_Impl::getIterator(
       const Handle& handle) const
   {
     OS_ASSERT(m_directOrder);
-    return std::find(m_directOrder->begin(),m_directOrder->end(),handle);
+    return m_directOrder->begin() + directOrderPosition(handle);
   }
 
   std::vector<Handle>::const_iterator WorkspaceObjectOrder_Impl::getIterator(IddObjectType type) const {
@@ -296,7 +308,26 @@ namespace detail {
       const WorkspaceObject& object) const
   {
     OS_ASSERT(m_directOrder);
-    return std::find(m_directOrder->begin(),m_directOrder->end(),object.handle());
+    return m_directOrder->begin() + directOrderPosition(object.handle());
+  }
+
+  unsigned WorkspaceObjectOrder_Impl::directOrderPosition(const Handle& handle) const {
+    OS_ASSERT(m_directOrder);
+    auto it = m_directOrderIndex.find(handle);
+    if (it == m_directOrderIndex.end()) {
+      return static_cast<unsigned>(m_directOrder->size());
+    }
+    return it->second;
+  }
+
+  void WorkspaceObjectOrder_Impl::indexDirectOrder() {
+    m_directOrderIndex.clear();
+    if (!m_directOrder) { return; }
+    m_directOrderIndex.reserve(m_directOrder->size());
+    for (unsigned i = 0, n = static_cast<unsigned>(m_directOrder->size()); i < n; ++i) {
+      // emplace keeps the first occurrence, matching std::find
+      m_directOrderIndex.emplace((*m_directOrder)[i], i);
+    }
   }
 
   boost::optional<IddObjectType> WorkspaceObjectOrder_Impl::getIddObjectType(
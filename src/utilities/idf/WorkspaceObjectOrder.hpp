@@ -37,6 +37,9 @@
 #include "ObjectOrderBase.hpp"
 
 #include <optional>
+#include <unordered_map>
+
+#include <boost/functional/hash.hpp>
 
 namespace openstudio {
 
@@ -126,6 +129,8 @@ namespace detail {
    private:
     ObjectGetter m_objectGetter;
     boost::optional< std::vector<Handle> > m_directOrder;
+    // position of the first occurrence of each handle in m_directOrder, kept in sync with m_directOrder
+    std::unordered_map<Handle, unsigned, boost::hash<boost::uuids::uuid> > m_directOrderIndex;
 
     REGISTER_LOGGER("utilities.idf.WorkspaceObjectOrder");
 
@@ -140,6 +145,12 @@ namespace detail {
     std::vector<Handle>::const_iterator getIterator(IddObjectType type) const;
     std::vector<Handle>::const_iterator getIterator(const WorkspaceObject& object) const;
 
+    // returns m_directOrder->size() if handle is not in the order
+    unsigned directOrderPosition(const Handle& handle) const;
+
+    // rebuilds m_directOrderIndex, call after any change to m_directOrder other than push_back
+    void indexDirectOrder();
+
     boost::optional<IddObjectType> getIddObjectType(const Handle& handle) const;
 
     // returns empty vector if can't convert all.
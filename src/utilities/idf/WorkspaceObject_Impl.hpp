@@ -133,6 +133,16 @@ namespace detail {
     /** Complete copy construction process by updating pointer handles. */
     virtual void initializeOnClone(const HandleMap& oldNewHandleMap);
 
+    /** First half of initializeOnClone. Applies oldNewHandleMap to this object's pointer data
+     *  without touching the Workspace, so it may be called concurrently on different objects.
+     *  Returns the indices of forward pointer fields whose targets are not in the map; those keep
+     *  their original handles until registerPointersOnClone is called. */
+    std::vector<unsigned> remapPointersOnClone(const HandleMap& oldNewHandleMap);
+
+    /** Second half of initializeOnClone. Resolves unmappedFields against the Workspace and
+     *  registers the forward pointers' references. Must be called serially. */
+    void registerPointersOnClone(const std::vector<unsigned>& unmappedFields);
+
     virtual ~WorkspaceObject_Impl();
 
     /// remove the object from the workspace
@@ -273,6 +283,14 @@ namespace detail {
     /** Returns equivalent IdfObject, leaving unnamed target objects unnamed. All data is cloned. */
     IdfObject_ImplPtr idfObjectImplPtr() const;
 
+    /** Appends this object to buffer as Idf text, exactly as idfObject().print writes it, naming
+     *  targets if necessary. Unlike idfObject, no data is cloned. pointerFields is scratch space
+     *  that may be reused between calls. defaultFieldComments is as for
+     *  IdfObject_Impl::appendIdfText. */
+    void appendIdfText(std::string& buffer,
+                       std::vector<std::pair<unsigned, std::string> >& pointerFields,
+                       std::vector<std::string>* defaultFieldComments);
+
     /** Returns equivalent IdfObject, naming targets if necessary. All data is cloned. */
     IdfObject idfObject();
 
@@ -286,6 +304,9 @@ namespace detail {
     /** Emits signals after batch update and error checking is complete, clears the diffs */
     virtual void emitChangeSignals() override;
 
+    /** Also true if a slot is connected to onRelationshipChange. */
+    virtual bool diffsObserved() const override;
+
     //@}
 
    //@}
@@ -295,6 +316,10 @@ namespace detail {
     /** Emitted when a pointer field is changed. */
     Nano::Signal<void(int, Handle, Handle)> onRelationshipChange;
 
+    /** Emitted when another object starts or stops pointing to this object, e.g. when a child is
+     *  added to or removed from its parent. */
+    Nano::Signal<void()> onSourcesChange;
+
     /** Emitted when this object is disconnected from the workspace.  Do not
      *  access any methods of this object as it is invalid. */
     Nano::Signal<void(const Handle &)> onRemoveFromWorkspace;
@@ -50,6 +50,7 @@
 #include <set>
 #include <map>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace openstudio {
 
@@ -490,6 +491,21 @@ namespace detail {
 
     void change();
 
+    /** @name Batch Editing */
+    //@{
+
+    void beginBatchEdit();
+
+    void endBatchEdit();
+
+    bool batchEditing() const;
+
+    /** Called by objects emitting change signals. Returns false if not batch editing, otherwise
+     *  records that the object's signals should be emitted when the batch edit ends. */
+    bool deferChangeSignals(const Handle& handle);
+
+    //@}
+
    protected:
 
     // helper for non-virtual part of clone implementation
@@ -503,6 +519,11 @@ namespace detail {
                                          const std::vector<Handle>& handles,
                                          bool keepHandles) const;
 
+    // copies originalObjectImplPtrs into cloneImpl and adds them as a collection clone
+    void createAndAddClones(const std::vector<std::shared_ptr<WorkspaceObject_Impl> >& originalObjectImplPtrs,
+                            const std::shared_ptr<Workspace_Impl>& cloneImpl,
+                            bool keepHandles) const;
+
    private:
 
     // DATA
@@ -526,6 +547,13 @@ namespace detail {
     typedef std::unordered_map<std::string, WorkspaceObjectMap> IdfReferencesMap; // , IstringCompare
     IdfReferencesMap m_idfReferencesMap;
 
+    // batch edit state, objects with deferred change signals are kept in the order they were first edited
+    unsigned m_batchEditDepth;
+    bool m_emittingDeferredChangeSignals;
+    bool m_batchEditChanged;
+    std::vector<Handle> m_deferredChangeSignals;
+    std::unordered_set<Handle, boost::hash<boost::uuids::uuid> > m_deferredChangeSignalsSet;
+
     // data object for undos
     struct SavedWorkspaceObject {
       Handle                   handle;